@@ -248,6 +248,13 @@ option(DNNL_ENABLE_ITT_TASKS
     on those ITT tasks and show corresponding timeline information."
     ON)
 
+option(DNNL_ENABLE_PERF_COUNTERS
+    "Enable collection of hardware performance counters (cycles, instructions,
+    last level cache misses) around primitive executions (off by default).
+    The counters are reported in the verbose output and can be queried for
+    each primitive. This feature is only available on Linux."
+    OFF)
+
 # ===================
 # Engine capabilities
 # ===================
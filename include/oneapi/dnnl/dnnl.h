@@ -233,6 +233,21 @@ dnnl_status_t DNNL_API dnnl_primitive_get_primitive_desc(
 dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
         const_dnnl_primitive_t primitive, size_t *size, uint8_t *cache_blob);
 
+/// Retrieves hardware performance counters accumulated over all executions of
+/// the given primitive.
+///
+/// @param primitive Primitive to query for the counters.
+/// @param counters Output counters.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+///
+/// @note The counters are only collected for CPU primitives on Linux when
+///     the library is built with `ONEDNN_ENABLE_PERF_COUNTERS=ON`. Otherwise,
+///     the function returns #dnnl_unimplemented. Executions overlapping with
+///     other ones aren't counted.
+dnnl_status_t DNNL_API dnnl_primitive_get_perf_counters(
+        const_dnnl_primitive_t primitive, dnnl_perf_counters_t *counters);
+
 /// Destroys a primitive.
 ///
 /// @param primitive The primitive to destroy.
@@ -357,6 +372,30 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_deterministic(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_deterministic(
         dnnl_primitive_attr_t attr, int value);
 
+/// Returns the weights replication primitive attribute value.
+///
+/// @param attr Primitive attributes.
+/// @param value Output weights replication attribute value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_weights_replication(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the weights replication primitive attribute value.
+///
+/// When set, CPU implementations have each thread read the copy of the weights
+/// local to its NUMA node if the weights have copies on each node. Copies are
+/// made only for weights buffers owned by the library, such as the graph
+/// constant tensor cache; weights in user buffers are always read from the
+/// user buffer. The attribute is ignored on systems with a single NUMA node.
+///
+/// @param attr Primitive attributes.
+/// @param value Boolean value to set weights replication attribute.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_weights_replication(
+        dnnl_primitive_attr_t attr, int value);
+
 /// Returns the accumulation mode primitive attribute.
 ///
 /// @param attr Primitive attributes.
@@ -553,6 +592,27 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_set_precomputed_reductions(
         dnnl_primitive_attr_t attr, int arg, int mask, int group_ndims,
         const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
 
+/// Sets primitive attributes dynamic quantization for a given memory argument.
+/// The primitive quantizes the argument to @p data_type on the fly with
+/// symmetric scales computed from the absolute maximum of the values each
+/// scale covers, and takes the scales into account in the result. No
+/// additional arguments are passed at execution time.
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call. Only #DNNL_ARG_SRC is supported.
+/// @param mask Dynamic quantization correspondence mask that defines the
+///     correspondence between the tensor dimensions and the computed scales.
+///     The set i-th bit indicates that a dedicated scale is computed for each
+///     index along that dimension. For example, a matmul source quantized
+///     per token uses a mask with all the bits but the last one set.
+/// @param data_type Data type the argument is quantized to.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dynamic_quantization(
+        dnnl_primitive_attr_t attr, int arg, int mask,
+        dnnl_data_type_t data_type);
+
 /// Sets primitive attributes zero points for primitive operations for a given
 /// memory argument. The zero points must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_ZERO_POINTS | arg.
@@ -1055,6 +1115,36 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
         dnnl_data_type_t data_type, dnnl_dim_t nnz,
         dnnl_data_type_t indices_dt);
 
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split into blocks of `block_dims[0] x block_dims[1]`
+/// elements, the last blocks of each dimension being padded with zeros.
+/// Only the blocks with non-zero elements are stored, in the CSR manner.
+/// The created memory descriptor will describe a memory object that
+/// contains 3 buffers. The buffers have the following meaning and assigned
+/// numbers (index):
+///  - 0: values, the elements of the stored blocks, each block being dense
+///    and row-major
+///  - 1: indices, the column index of each stored block
+///  - 2: pointers, the offsets of the first stored block of each row of
+///    blocks, `ceil(dims[0] / block_dims[0]) + 1` values
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions, must be 2.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param nnz Number of stored (non-zero) blocks.
+/// @param block_dims Array of 2 block dimensions.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
 /// Creates a memory descriptor for packed sparse encoding.
 ///
 /// The created memory descriptor cannot be used to create a memory
@@ -3664,6 +3754,37 @@ dnnl_status_t DNNL_API dnnl_matmul_primitive_desc_create(
         const_dnnl_memory_desc_t bias_desc, const_dnnl_memory_desc_t dst_desc,
         const_dnnl_primitive_attr_t attr);
 
+/// Creates a primitive descriptor for a grouped matrix multiplication
+/// primitive.
+///
+/// The rows of the source are split into groups of variable sizes, the rows
+/// of group `g` are multiplied by the `g`-th weights matrix. The sizes are
+/// provided at execution time with the #DNNL_ARG_GROUP_OFFSETS argument.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor of shape `M x K` (matrix A).
+/// @param weights_desc Weights memory descriptor of shape `G x K x N`
+///     (matrices B).
+/// @param bias_desc Bias memory descriptor of shape `G x N` or `1 x N`.
+///     Passing NULL, a zero memory descriptor, or a memory descriptor with
+///     format_kind set to #dnnl_format_kind_undef disables the bias term.
+/// @param group_offsets_desc Group offsets memory descriptor of shape `G`
+///     and #dnnl_s32 data type. The `g`-th value is the end of the rows of
+///     group `g`, groups are stored one after another starting from row 0.
+/// @param dst_desc Destination memory descriptor of shape `M x N`
+///     (matrix C).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_grouped_matmul_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t bias_desc,
+        const_dnnl_memory_desc_t group_offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_matmul
 
 /// @addtogroup dnnl_api_resampling Resampling
@@ -3779,8 +3900,124 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns hit, miss and eviction counters of the primitive cache and of the
+/// kernel cache.
+///
+/// @param stats Primitive cache statistics to query. The counters are
+///     updated concurrently with primitive creation, so the returned values
+///     are a snapshot.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats);
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_arena
+/// @{
+
+/// Enables or disables the scratchpad arena.
+///
+/// With the arena, primitives created for CPU engines with
+/// #dnnl_scratchpad_mode_library take their scratchpad from a pool shared by
+/// all the primitives, engines and streams for the duration of each
+/// execution, instead of holding a buffer from creation to destruction.
+/// Buffers are grouped in size classes, idle buffers are reused by later
+/// executions and trimmed to the recent peak usage.
+///
+/// @note
+///     The setting affects primitives created after the call. It overrides
+///     the ONEDNN_SCRATCHPAD_ARENA environment variable.
+///
+/// @param enable Flag value. Set to 0 to disable and set to 1 to enable.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p enable value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_set_scratchpad_arena(int enable);
+
+/// Returns whether the scratchpad arena is enabled.
+///
+/// @param enable Flag value to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p enable value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_get_scratchpad_arena(int *enable);
+
+/// Sets the maximum size of idle buffers kept by the scratchpad arena. Idle
+/// buffers in excess are freed immediately, starting from the largest ones.
+///
+/// @param size Size in bytes. The default value is `SIZE_MAX`, meaning the
+///     idle buffers are only trimmed to the recent peak usage.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_scratchpad_arena_idle_limit(size_t size);
+
+/// Frees all the idle buffers held by the scratchpad arena.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_trim_scratchpad_arena(void);
+
+/// Returns scratchpad arena statistics.
+///
+/// @param stats Statistics to query. The arena is used concurrently with the
+///     query, so the returned values are a snapshot.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_scratchpad_arena_stats(
+        dnnl_scratchpad_arena_stats_t *stats);
+
+/// @} dnnl_api_scratchpad_arena
+
+/// @addtogroup dnnl_api_huge_pages
+/// @{
+
+/// Sets the policy for backing the large buffers allocated by the library on
+/// CPU with 2 MiB pages, such as the memory objects created by the library,
+/// the packed weights and the scratchpads. Large buffers read at random
+/// offsets cause fewer TLB misses with huge pages.
+///
+/// @note
+///     The setting affects the buffers allocated after the call. It
+///     overrides the ONEDNN_HUGE_PAGES and ONEDNN_HUGE_PAGES_THRESHOLD
+///     environment variables.
+///
+/// @param policy Huge pages policy.
+/// @param threshold Size in bytes from which buffers are backed by huge
+///     pages. The buffers are rounded up to the size of a huge page, so
+///     that small thresholds waste memory.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p policy value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+/// @returns #dnnl_unimplemented/#dnnl::status::unimplemented if the @p
+///     policy is not #dnnl_huge_pages_none on systems other than Linux.
+dnnl_status_t DNNL_API dnnl_set_huge_pages_policy(
+        dnnl_huge_pages_policy_t policy, size_t threshold);
+
+/// Returns the policy for backing large CPU buffers with huge pages.
+///
+/// @param policy Huge pages policy to query.
+/// @param threshold Size in bytes from which buffers are backed by huge
+///     pages to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p policy or @p threshold value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_huge_pages_policy(
+        dnnl_huge_pages_policy_t *policy, size_t *threshold);
+
+/// Returns huge pages statistics. The resident size is read from
+/// `/proc/self/smaps`, which takes time proportional to the number of
+/// mappings of the process.
+///
+/// @param stats Statistics to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_huge_pages_stats(
+        dnnl_huge_pages_stats_t *stats);
+
+/// @} dnnl_api_huge_pages
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -3846,6 +4083,31 @@ dnnl_status_t DNNL_API dnnl_set_jit_profiling_flags(unsigned flags);
 /// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on Windows.
 dnnl_status_t DNNL_API dnnl_set_jit_profiling_jitdumpdir(const char *dir);
 
+/// Sets the directory of the persistent JIT kernel cache. Only applicable to
+/// Linux and to CPU kernels.
+///
+/// When the directory is set, the code of JIT kernels created as a part of
+/// CPU primitives is stored in the directory and is mapped back into memory
+/// when the same primitive is created again, including by another process.
+/// Only kernels that do not embed process-specific addresses are stored.
+///
+/// @note
+///     This setting overrides the ONEDNN_JIT_CACHE_DIR environment variable.
+///     If the variable is not set, and this function is never called, the
+///     persistent JIT kernel cache is disabled. Passing NULL or an empty
+///     string disables the cache.
+///
+/// @note
+///     The directory must exist. Failures to access it or to store a kernel
+///     are not reported and make the library generate the kernels as usual.
+///
+/// @param dir Persistent JIT kernel cache directory.
+/// @returns #dnnl_success/#dnnl::status::success if the
+///     directory was set correctly and an error status otherwise.
+/// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on systems other
+///     than Linux.
+dnnl_status_t DNNL_API dnnl_set_jit_cache_dir(const char *dir);
+
 /// Sets the maximal ISA the library can dispatch to on the CPU. See
 /// #dnnl_cpu_isa_t and #dnnl::cpu_isa for the list of the values accepted by
 /// the C and C++ API functions respectively.
@@ -201,6 +201,15 @@ struct primitive : public handle<dnnl_primitive_t> {
     ///     constructor.
     inline std::vector<uint8_t> get_cache_blob() const;
 
+    /// Returns hardware performance counters accumulated over all executions
+    /// of the primitive.
+    ///
+    /// @returns Performance counters.
+    ///
+    /// @note The counters are only available when the library is built with
+    ///     `ONEDNN_ENABLE_PERF_COUNTERS=ON`.
+    inline dnnl_perf_counters_t get_perf_counters() const;
+
     /// Executes computations specified by the primitive in a specified stream.
     ///
     /// Arguments are passed via an arguments map containing <index,
@@ -255,6 +264,13 @@ std::vector<uint8_t> primitive::get_cache_blob() const {
     return cache_blob;
 }
 
+dnnl_perf_counters_t primitive::get_perf_counters() const {
+    dnnl_perf_counters_t counters {};
+    error::wrap_c_api(dnnl_primitive_get_perf_counters(get(), &counters),
+            "could not get performance counters from a primitive");
+    return counters;
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -954,6 +970,8 @@ struct memory : public handle<dnnl_memory_t> {
         packed = dnnl_packed,
         /// Coordinate Sparse (COO) encoding.
         coo = dnnl_coo,
+        /// Block Compressed Sparse Row (BSR) encoding.
+        bsr = dnnl_bsr,
     };
 
     /// Memory format tag specification.
@@ -2928,6 +2946,48 @@ struct memory : public handle<dnnl_memory_t> {
             return desc {md};
         }
 
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The tensor is split into blocks of `block_dims[0] x block_dims[1]`
+        /// elements padded with zeros, and only the non-zero blocks are
+        /// stored. The created memory descriptor will describe a memory
+        /// object that contains 3 buffers. The buffers have the following
+        /// meaning and assigned numbers (index):
+        ///  - 0: values, the stored blocks, each one dense and row-major
+        ///  - 1: indices, the column index of each stored block
+        ///  - 2: pointers, the offset of the first stored block of each row
+        ///    of blocks
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz Number of stored (non-zero) blocks.
+        /// @param block_dims Block dimensions.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        /// @sa @ref dev_guide_sparsity
+        static desc bsr(const dims &adims, data_type adata_type, dim nnz,
+                const dims &block_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_container_size(block_dims,
+                    "block dimensions don't match tensor dimensions",
+                    (int)adims.size(), (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz, block_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
         /// Function for creating a memory descriptor for packed sparse
         /// encoding.
         ///
@@ -4115,6 +4175,27 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set deterministic primitive attribute");
     }
 
+    /// Returns the weights replication attribute value
+    bool get_weights_replication() const {
+        int result;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_weights_replication(get(), &result),
+                "could not get weights replication primitive attribute");
+        return static_cast<bool>(result);
+    }
+
+    /// Sets weights replication attribute value
+    ///
+    /// @param value Specified weights replication mode. When set, CPU
+    ///     implementations read the copy of the weights local to the NUMA
+    ///     node of the thread if the weights are in a buffer owned by the
+    ///     library which has copies, such as the graph constant tensor cache.
+    void set_weights_replication(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_weights_replication(
+                                  get(), static_cast<int>(value)),
+                "could not set weights replication primitive attribute");
+    }
+
     /// Returns the rounding mode attribute value
     ///
     /// @param arg Argument for which rounding mode query applies.
@@ -4328,6 +4409,26 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set precomputed reductions primitive attribute");
     }
 
+    /// Sets dynamic quantization for a given memory argument. The primitive
+    /// quantizes the argument on the fly with symmetric scales computed from
+    /// the absolute maximum of the values each scale covers.
+    ///
+    /// @sa dnnl_primitive_attr_set_dynamic_quantization
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call. Only #DNNL_ARG_SRC is supported.
+    /// @param mask Dynamic quantization correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the computed
+    ///     scales. The set i-th bit indicates that a dedicated scale is
+    ///     computed for each index along that dimension.
+    /// @param data_type Data type the argument is quantized to.
+    void set_dynamic_quantization(int arg, int mask,
+            memory::data_type data_type = memory::data_type::s8) {
+        error::wrap_c_api(dnnl_primitive_attr_set_dynamic_quantization(get(),
+                                  arg, mask, memory::convert_to_c(data_type)),
+                "could not set dynamic quantization primitive attribute");
+    }
+
     /// Returns post-ops previously set via set_post_ops().
     ///
     /// @returns Post-ops.
@@ -13040,6 +13141,133 @@ struct matmul : public primitive {
         : primitive(pd, cache_blob) {}
 };
 
+/// Grouped matrix multiplication (matmul) primitive.
+///
+/// The rows of the source are split into groups of variable sizes and the
+/// rows of each group are multiplied by their own weights matrix. The group
+/// sizes are passed at execution time with the #DNNL_ARG_GROUP_OFFSETS
+/// argument, so a single primitive serves any distribution of the rows.
+struct grouped_matmul : public primitive {
+    /// Primitive descriptor for a grouped matmul primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        ///     without bias.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source of shape `M x K`.
+        /// @param weights_desc Memory descriptor for weights of shape
+        ///     `G x K x N`.
+        /// @param group_offsets_desc Memory descriptor for group offsets of
+        ///     shape `G` and #dnnl::memory::data_type::s32 data type.
+        /// @param dst_desc Memory descriptor for destination of shape
+        ///     `M x N`.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc,
+                const memory::desc &group_offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, src_desc, weights_desc, nullptr,
+                    group_offsets_desc, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        ///     with bias.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Memory descriptor for source of shape `M x K`.
+        /// @param weights_desc Memory descriptor for weights of shape
+        ///     `G x K x N`.
+        /// @param bias_desc Memory descriptor for bias of shape `G x N` or
+        ///     `1 x N`.
+        /// @param group_offsets_desc Memory descriptor for group offsets of
+        ///     shape `G` and #dnnl::memory::data_type::s32 data type.
+        /// @param dst_desc Memory descriptor for destination of shape
+        ///     `M x N`.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc &bias_desc,
+                const memory::desc &group_offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, src_desc, weights_desc, &bias_desc,
+                    group_offsets_desc, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a grouped matmul primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a grouped matmul
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::matmul) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return query_md(query::src_md, 0); }
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const {
+            return query_md(query::weights_md, 0);
+        }
+
+        /// @copydoc dnnl::convolution_forward::primitive_desc::bias_desc()const
+        memory::desc bias_desc() const {
+            return query_md(query::weights_md, 1);
+        }
+
+        /// Returns a memory descriptor for group offsets.
+        /// @returns Group offsets memory descriptor.
+        memory::desc group_offsets_desc() const {
+            return query_md(query::src_md, 1);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return query_md(query::dst_md, 0); }
+
+    private:
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &weights_desc, const memory::desc *bias_desc,
+                const memory::desc &group_offsets_desc,
+                const memory::desc &dst_desc, const primitive_attr &attr,
+                bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_grouped_matmul_primitive_desc_create(
+                    &pd, aengine.get(), src_desc.get(), weights_desc.get(),
+                    optional_arg(bias_desc), group_offsets_desc.get(),
+                    dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for "
+                        "the grouped matmul primitive. Run workload with "
+                        "environment variable ONEDNN_VERBOSE=all to get "
+                        "additional diagnostic information.");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    grouped_matmul() = default;
+
+    /// Constructs a grouped matmul primitive.
+    /// @param pd Primitive descriptor for a grouped matmul primitive.
+    grouped_matmul(const primitive_desc &pd) : primitive(pd) {}
+};
+
 /// @} dnnl_api_matmul
 
 /// @addtogroup dnnl_api_resampling Resampling
@@ -13954,6 +14182,11 @@ inline status set_jit_profiling_jitdumpdir(const std::string &dir) {
     return static_cast<status>(dnnl_set_jit_profiling_jitdumpdir(dir.c_str()));
 }
 
+/// @copydoc dnnl_set_jit_cache_dir()
+inline status set_jit_cache_dir(const std::string &dir) {
+    return static_cast<status>(dnnl_set_jit_cache_dir(dir.c_str()));
+}
+
 /// @copydoc dnnl_cpu_isa_t
 enum class cpu_isa {
     /// @copydoc dnnl_cpu_isa_default
@@ -14103,8 +14336,122 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Primitive cache statistics.
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+
+/// @copydoc dnnl_get_primitive_cache_stats(dnnl_primitive_cache_stats_t *stats)
+inline primitive_cache_stats_t get_primitive_cache_stats() {
+    primitive_cache_stats_t result {};
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(&result),
+            "could not get primitive cache stats");
+    return result;
+}
+
 /// @} dnnl_api_primitive_cache
 
+/// @addtogroup dnnl_api_scratchpad_arena Scratchpad Arena
+///
+/// A set of functions that control the scratchpad arena shared by primitives.
+///
+/// @{
+
+/// @copydoc dnnl_set_scratchpad_arena(int enable)
+inline void set_scratchpad_arena(bool enable) {
+    error::wrap_c_api(dnnl_set_scratchpad_arena(enable),
+            "could not set scratchpad arena");
+}
+
+/// Returns whether the scratchpad arena is enabled.
+inline bool get_scratchpad_arena() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_scratchpad_arena(&result),
+            "could not get scratchpad arena");
+    return result != 0;
+}
+
+/// @copydoc dnnl_set_scratchpad_arena_idle_limit(size_t size)
+inline void set_scratchpad_arena_idle_limit(size_t size) {
+    error::wrap_c_api(dnnl_set_scratchpad_arena_idle_limit(size),
+            "could not set scratchpad arena idle limit");
+}
+
+/// @copydoc dnnl_trim_scratchpad_arena()
+inline void trim_scratchpad_arena() {
+    error::wrap_c_api(
+            dnnl_trim_scratchpad_arena(), "could not trim scratchpad arena");
+}
+
+/// Scratchpad arena statistics.
+using scratchpad_arena_stats_t = dnnl_scratchpad_arena_stats_t;
+
+/// @copydoc dnnl_get_scratchpad_arena_stats(dnnl_scratchpad_arena_stats_t *stats)
+inline scratchpad_arena_stats_t get_scratchpad_arena_stats() {
+    scratchpad_arena_stats_t result {};
+    error::wrap_c_api(dnnl_get_scratchpad_arena_stats(&result),
+            "could not get scratchpad arena stats");
+    return result;
+}
+
+/// @} dnnl_api_scratchpad_arena
+
+/// @addtogroup dnnl_api_huge_pages Huge Pages
+///
+/// A set of functions that control the backing of large CPU buffers with
+/// huge pages.
+///
+/// @{
+
+/// @copydoc dnnl_huge_pages_policy_t
+enum class huge_pages_policy {
+    /// @copydoc dnnl_huge_pages_none
+    none = dnnl_huge_pages_none,
+    /// @copydoc dnnl_huge_pages_madvise
+    madvise = dnnl_huge_pages_madvise,
+    /// @copydoc dnnl_huge_pages_hugetlb
+    hugetlb = dnnl_huge_pages_hugetlb,
+};
+
+/// @copydoc dnnl_set_huge_pages_policy(dnnl_huge_pages_policy_t policy, size_t threshold)
+inline void set_huge_pages_policy(
+        huge_pages_policy policy, size_t threshold = 2 * 1024 * 1024) {
+    error::wrap_c_api(
+            dnnl_set_huge_pages_policy(
+                    static_cast<dnnl_huge_pages_policy_t>(policy), threshold),
+            "could not set huge pages policy");
+}
+
+/// Returns the policy for backing large CPU buffers with huge pages.
+inline huge_pages_policy get_huge_pages_policy() {
+    dnnl_huge_pages_policy_t result = dnnl_huge_pages_none;
+    size_t threshold = 0;
+    error::wrap_c_api(dnnl_get_huge_pages_policy(&result, &threshold),
+            "could not get huge pages policy");
+    return static_cast<huge_pages_policy>(result);
+}
+
+/// Returns the size in bytes from which CPU buffers are backed by huge
+/// pages.
+inline size_t get_huge_pages_threshold() {
+    dnnl_huge_pages_policy_t policy = dnnl_huge_pages_none;
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_huge_pages_policy(&policy, &result),
+            "could not get huge pages policy");
+    return result;
+}
+
+/// Huge pages statistics.
+using huge_pages_stats_t = dnnl_huge_pages_stats_t;
+
+/// @copydoc dnnl_get_huge_pages_stats(dnnl_huge_pages_stats_t *stats)
+inline huge_pages_stats_t get_huge_pages_stats() {
+    huge_pages_stats_t result {};
+    error::wrap_c_api(dnnl_get_huge_pages_stats(&result),
+            "could not get huge pages stats");
+    return result;
+}
+
+/// @} dnnl_api_huge_pages
+
 /// @addtogroup dnnl_api_blas BLAS functions
 ///
 /// A subset of Basic Linear Algebra (BLAS) functions that perform
@@ -773,6 +773,34 @@ dnnl_status_t DNNL_API dnnl_graph_get_constant_tensor_cache_capacity(
 
 /// @} dnnl_graph_api_constant_tensor_cache
 
+/// @addtogroup dnnl_graph_api_scratchpad_sharing
+/// @{
+
+/// Controls sharing of temporary memory between compiled partitions. When
+/// enabled, compiled partitions executed on a CPU engine with the library
+/// allocator lease their internal temporary buffer from a pool owned by the
+/// library for the duration of each execution instead of allocating their
+/// own buffer. Buffers given back to the pool are reused by later executions
+/// and freed when the library is unloaded. The sharing is disabled by default
+/// and can also be enabled with the `ONEDNN_GRAPH_SCRATCHPAD_SHARING`
+/// environment variable.
+///
+/// @param flag Set to positive value to enable the sharing and set to 0 to
+/// disable it. Negative values are invalid.
+/// @returns #dnnl_invalid_arguments if the @p flag value is
+/// invalid, and #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_set_scratchpad_sharing(int flag);
+
+/// Returns the enabling status of temporary memory sharing between compiled
+/// partitions.
+///
+/// @param flag The sharing status to query.
+/// @returns #dnnl_invalid_arguments if the @p flag value is
+/// nullptr, and #dnnl_success on success.
+dnnl_status_t DNNL_API dnnl_graph_get_scratchpad_sharing(int *flag);
+
+/// @} dnnl_graph_api_scratchpad_sharing
+
 /// @} dnnl_graph_api
 
 /// @} dnnl_api
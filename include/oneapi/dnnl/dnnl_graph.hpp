@@ -862,6 +862,7 @@ public:
         Wildcard = dnnl_graph_op_wildcard,
         GenIndex = dnnl_graph_op_gen_index,
         GreaterEqual = dnnl_graph_op_greater_equal,
+        GroupedMatMul = dnnl_graph_op_grouped_matmul,
         // Sentinel
         LastSymbol = dnnl_graph_op_last_symbol,
     };
@@ -1637,6 +1638,35 @@ inline size_t get_constant_tensor_cache_capacity(engine::kind kind) {
 
 /// @} dnnl_graph_api_constant_tensor_cache
 
+/// @addtogroup dnnl_graph_api_scratchpad_sharing Scratchpad Sharing
+///
+/// A set of functions that control sharing of temporary memory between
+/// compiled partitions
+///
+/// @{
+
+/// Controls sharing of temporary memory between compiled partitions executed
+/// on a CPU engine with the library allocator. By default, the sharing is
+/// disabled.
+///
+/// @param flag Set to positive value to enable the sharing and set to 0 to
+/// disable it. Negative values are invalid.
+inline void set_scratchpad_sharing(int flag) {
+    error::wrap_c_api(dnnl_graph_set_scratchpad_sharing(flag),
+            "fail to set scratchpad sharing");
+}
+
+/// Returns the enabling status of temporary memory sharing between compiled
+/// partitions.
+inline int get_scratchpad_sharing() {
+    int result = 0;
+    error::wrap_c_api(dnnl_graph_get_scratchpad_sharing(&result),
+            "fail to get scratchpad sharing");
+    return result;
+}
+
+/// @} dnnl_graph_api_scratchpad_sharing
+
 } // namespace graph
 
 /// @} dnnl_graph_api
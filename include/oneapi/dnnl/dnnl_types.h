@@ -77,6 +77,9 @@ typedef enum {
     dnnl_packed,
     /// Coordinate Sparse Encoding (COO).
     dnnl_coo,
+    /// Block Compressed Sparse Row (BSR) encoding: CSR encoding of the
+    /// non-zero dense blocks of a tensor.
+    dnnl_bsr,
 } dnnl_sparse_encoding_t;
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -2496,6 +2499,9 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input recurrent hidden state vector. An alias
 /// for #DNNL_ARG_SRC_1.
 #define DNNL_ARG_SRC_ITER DNNL_ARG_SRC_1
+/// A special mnemonic for the group offsets of a grouped matrix
+/// multiplication. An alias for #DNNL_ARG_SRC_1.
+#define DNNL_ARG_GROUP_OFFSETS DNNL_ARG_SRC_1
 
 /// Source argument #2.
 #define DNNL_ARG_SRC_2 3
@@ -2854,6 +2860,20 @@ typedef enum {
     dnnl_query_max = 0x7fff,
 } dnnl_query_t;
 
+/// Hardware performance counters accumulated over executions of a primitive.
+typedef struct {
+    /// Number of CPU cycles.
+    uint64_t cycles;
+    /// Number of retired instructions.
+    uint64_t instructions;
+    /// Number of last level cache misses.
+    uint64_t llc_misses;
+    /// Memory traffic in bytes estimated from last level cache misses.
+    uint64_t bytes;
+    /// Number of executions the counters were collected for.
+    uint64_t executions;
+} dnnl_perf_counters_t;
+
 /// @} dnnl_api_primitives_common
 
 /// @} dnnl_api_primitives
@@ -2959,6 +2979,83 @@ typedef enum {
 
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive cache statistics accumulated since the library was loaded.
+typedef struct {
+    /// Number of primitive creations served by the cache.
+    uint64_t hits;
+    /// Number of primitive creations that missed the cache.
+    uint64_t misses;
+    /// Number of primitives evicted from the cache, including the ones evicted
+    /// because of a capacity change.
+    uint64_t evictions;
+    /// Number of kernel creations served by the kernel cache. Kernels are
+    /// shared between primitives that generate identical code.
+    uint64_t kernel_hits;
+    /// Number of kernel creations that missed the kernel cache.
+    uint64_t kernel_misses;
+    /// Number of kernels evicted from the kernel cache.
+    uint64_t kernel_evictions;
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
+/// @addtogroup dnnl_api_scratchpad_arena
+/// @{
+
+/// Scratchpad arena statistics.
+typedef struct {
+    /// Number of executions that took a buffer from the arena.
+    uint64_t acquisitions;
+    /// Number of buffers allocated by the arena.
+    uint64_t allocations;
+    /// Number of idle buffers freed by trimming.
+    uint64_t trims;
+    /// Size in bytes of the buffers used by executions in progress.
+    uint64_t used_size;
+    /// Size in bytes of the idle buffers kept for reuse.
+    uint64_t idle_size;
+    /// Maximum size in bytes of all the buffers held by the arena at once.
+    uint64_t peak_size;
+} dnnl_scratchpad_arena_stats_t;
+
+/// @} dnnl_api_scratchpad_arena
+
+/// @addtogroup dnnl_api_huge_pages
+/// @{
+
+/// Policy for backing large CPU buffers with huge pages.
+typedef enum {
+    /// Buffers are allocated with the default page size.
+    dnnl_huge_pages_none = 0x0,
+    /// Buffers are advised to be backed by transparent huge pages with
+    /// `madvise(MADV_HUGEPAGE)`.
+    dnnl_huge_pages_madvise = 0x1,
+    /// Buffers are mapped from the pool of huge pages with `MAP_HUGETLB`,
+    /// falling back to #dnnl_huge_pages_madvise when the pool is exhausted.
+    dnnl_huge_pages_hugetlb = 0x2,
+} dnnl_huge_pages_policy_t;
+
+/// Huge pages statistics.
+typedef struct {
+    /// Number of buffers mapped with `MAP_HUGETLB`.
+    uint64_t hugetlb_allocations;
+    /// Number of buffers advised with `MADV_HUGEPAGE`.
+    uint64_t madvise_allocations;
+    /// Number of buffers which could not be mapped with `MAP_HUGETLB` and
+    /// were advised instead.
+    uint64_t fallbacks;
+    /// Size in bytes of the live buffers backed by huge pages or advised to
+    /// be.
+    uint64_t size;
+    /// Size in bytes of the live buffers which resides in huge pages.
+    uint64_t resident_size;
+} dnnl_huge_pages_stats_t;
+
+/// @} dnnl_api_huge_pages
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
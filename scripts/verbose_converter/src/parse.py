@@ -651,6 +651,11 @@ class Parser:
                 continue
             if event not in self.events:
                 continue
+            # Performance counters, if any, follow the execution time.
+            if event == "exec":
+                head, tail = args.rsplit(",", 1)
+                if tail.startswith("perf:"):
+                    args = head
             leading_args, last_arg = args.rsplit(",", 1)
             try:
                 time = float(last_arg)
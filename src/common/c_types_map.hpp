@@ -217,6 +217,7 @@ const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
 const sparse_encoding_t coo = dnnl_coo;
 const sparse_encoding_t packed = dnnl_packed;
+const sparse_encoding_t bsr = dnnl_bsr;
 } // namespace sparse_encoding
 
 using format_kind_t = dnnl_format_kind_t;
@@ -2067,6 +2068,11 @@ const query_t zero_pad_d = internal_only_start;
 const query_t preferred_gpu_threads_per_eu = (query_t)(internal_only_start + 1);
 } // namespace query
 
+using perf_counters_t = dnnl_perf_counters_t;
+using scratchpad_arena_stats_t = dnnl_scratchpad_arena_stats_t;
+using huge_pages_policy_t = dnnl_huge_pages_policy_t;
+using huge_pages_stats_t = dnnl_huge_pages_stats_t;
+
 // There are no external values to map to because this is an internal feature
 // for now.
 using matmul_reduce_kind_t = int;
@@ -18,6 +18,7 @@
 #define COMMON_CACHE_HIT_TYPES_HPP
 
 #include <cassert>
+#include <cstddef>
 #include <string>
 
 namespace dnnl {
@@ -32,6 +33,14 @@ enum class cache_state_t {
     compiled_partition_hit //< graph partition cache hit, already compiled
 };
 
+// Counters of a cache, requests for an object are either served by the cache
+// (hits) or create a new object (misses).
+struct cache_stats_t {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+};
+
 inline const char *cache_state2str(const cache_state_t cache_hit) {
     switch (cache_hit) {
         case cache_state_t::miss: return ":cache_miss";
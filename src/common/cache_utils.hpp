@@ -17,9 +17,12 @@
 #ifndef COMMON_CACHE_UTILS_HPP
 #define COMMON_CACHE_UTILS_HPP
 
-#include <algorithm>
+#include <array>
+#include <atomic>
 #include <future>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -35,7 +38,8 @@
 #include <windows.h>
 #endif
 
-#include "rw_mutex.hpp"
+#include "cache_hit_types.hpp"
+#include "utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -63,6 +67,8 @@ struct cache_t {
 
     virtual int get_size() const = 0;
 
+    virtual cache_stats_t get_stats() const = 0;
+
     // Returns the cached value or cache_object_t() on a miss
     virtual cache_object_t get(const key_t &key) = 0;
 
@@ -115,13 +121,20 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy.
+//
+// Entries are distributed over shards by the key hash. Each shard has its own
+// lock and keeps its entries in a list ordered from the most to the least
+// recently used one, so the replacement order is exact within a shard only.
+//
+// A miss takes the lock of the shard owning the key. When the cache is full,
+// the least recently used entry of that shard is evicted if the shard holds
+// at least its share of the capacity. Otherwise the entry is taken from the
+// largest shard when its lock is free, so that a shard doesn't keep stale
+// entries while others are thrashing. If no entry can be evicted without
+// waiting, the cache exceeds its capacity until a subsequent miss.
 template <typename K, typename O, typename C,
         key_merge_t<K, O> key_merge = nullptr>
 struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
@@ -133,20 +146,22 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     lru_cache_t(int capacity) : capacity_(capacity) {}
 
     ~lru_cache_t() override {
-        if (cache_mapper().empty()) return;
+        if (get_size() == 0) return;
 
         if (!is_destroying_cache_safe()) {
             // It is safe to remove those entries that are not affected by the
             // unloading order issue e.g. native CPU.
-            for (auto it = cache_mapper().begin();
-                    it != cache_mapper().end();) {
-                if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
-                } else {
-                    ++it;
+            for (auto &s : shards_) {
+                for (auto it = s.entries.begin(); it != s.entries.end();) {
+                    if (!it->first.has_runtime_dependencies()) {
+                        s.lru.erase(it->second.lru_it);
+                        it = s.entries.erase(it);
+                    } else {
+                        ++it;
+                    }
                 }
+                s.release();
             }
-            release_cache();
             return;
         }
     }
@@ -154,99 +169,135 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     cache_object_t get(const key_t &key) override {
         value_t e;
         {
-            utils::lock_read_t lock_r(this->rw_mutex());
+            auto &s = shard(key);
+            std::lock_guard<std::mutex> lock(s.mutex);
             if (capacity_ == 0) { return cache_object_t(); }
-            e = get_future(key);
+            e = get_future(s, key);
+            if (e.valid())
+                s.hits++;
+            else
+                s.misses++;
         }
 
         if (e.valid()) return e.get();
         return cache_object_t();
     }
 
-    int get_capacity() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return capacity_;
-    };
+    int get_capacity() const override { return capacity_; };
 
     status_t set_capacity(int capacity) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        lock_all();
         capacity_ = capacity;
-        // Check if number of entries exceeds the new capacity
-        if (get_size_no_lock() > capacity_) {
-            // Evict excess entries
-            int n_excess_entries = get_size_no_lock() - capacity_;
-            evict(n_excess_entries);
-        }
+        // Evict excess entries
+        while (size_ > capacity_)
+            evict_lru_no_lock();
+        unlock_all();
         return status::success;
     }
-    void set_capacity_without_clearing(int capacity) {
-        utils::lock_write_t lock_w(this->rw_mutex());
-        capacity_ = capacity;
-    }
+    void set_capacity_without_clearing(int capacity) { capacity_ = capacity; }
+
+    int get_size() const override { return size_; }
 
-    int get_size() const override {
-        utils::lock_read_t lock_r(this->rw_mutex());
-        return get_size_no_lock();
+    cache_stats_t get_stats() const override {
+        cache_stats_t stats;
+        for (auto &s : shards_) {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            stats.hits += s.hits;
+            stats.misses += s.misses;
+            stats.evictions += s.evictions;
+        }
+        return stats;
     }
 
 protected:
-    int get_size_no_lock() const { return (int)cache_mapper().size(); }
-
     value_t get_or_add(const key_t &key, const value_t &value) override {
-        {
-            // 1. Section with shared access (read lock)
-            utils::lock_read_t lock_r(this->rw_mutex());
-            // Check if the cache is enabled.
-            if (capacity_ == 0) { return value_t(); }
-            // Check if the requested entry is present in the cache (likely
-            // cache_hit)
-            auto e = get_future(key);
-            if (e.valid()) { return e; }
-        }
-
-        utils::lock_write_t lock_w(this->rw_mutex());
-        // 2. Section with exclusive access (write lock).
-        // In a multithreaded scenario, in the context of one thread the cache
-        // may have changed by another thread between releasing the read lock
-        // and acquiring the write lock (a.k.a. ABA problem), therefore
-        // additional checks have to be performed for correctness. Double check
-        // the capacity due to possible race condition
+        auto &s = shard(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        // Check if the cache is enabled.
         if (capacity_ == 0) { return value_t(); }
-
-        // Double check if the requested entry is present in the cache (unlikely
-        // cache_hit).
-        auto e = get_future(key);
-        if (!e.valid()) {
-            // If the entry is missing in the cache then add it (cache_miss)
-            add(key, value);
+        // Check if the requested entry is present in the cache (cache_hit)
+        auto e = get_future(s, key);
+        if (e.valid()) {
+            s.hits++;
+            return e;
         }
-        return e;
+        // If the entry is missing in the cache then add it (cache_miss)
+        s.misses++;
+        add(s, key, value);
+        while (size_ > capacity_ && evict_for_no_lock(s)) {}
+        return value_t();
     }
 
     void remove_if_invalidated(const key_t &key) override {
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &s = shard(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
 
         if (capacity_ == 0) { return; }
 
-        auto it = cache_mapper().find(key);
+        auto it = s.entries.find(key);
         // The entry has been already evicted at this point
-        if (it == cache_mapper().end()) { return; }
+        if (it == s.entries.end()) { return; }
 
         const auto &value = it->second.value_;
         // If the entry is not invalidated
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        erase(s, it);
     }
 
 private:
-    static size_t get_timestamp() {
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-        return cpu::platform::get_timestamp();
-#else
-        return std::chrono::steady_clock::now().time_since_epoch().count();
-#endif
+    struct lru_node_t {
+        const key_t *key;
+        size_t timestamp;
+    };
+    using lru_list_t = std::list<lru_node_t>;
+
+    struct entry_t {
+        value_t value_;
+        typename lru_list_t::iterator lru_it;
+        entry_t(const value_t &value) : value_(value) {}
+    };
+    using entries_t = std::unordered_map<key_t, entry_t>;
+
+    struct shard_t {
+        mutable std::mutex mutex;
+        entries_t entries;
+        // Entries from the most to the least recently used one, the nodes
+        // point to the keys stored in `entries`.
+        lru_list_t lru;
+        // Number of entries, read without the lock to pick a shard to evict
+        // from.
+        std::atomic<int> size {0};
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+
+        // Leaks cached resources. Used to avoid issues with calling
+        // destructors allocated by an already unloaded dynamic library.
+        void release() {
+            auto e = utils::make_unique<entries_t>();
+            std::swap(*e, entries);
+            e.release();
+            auto l = utils::make_unique<lru_list_t>();
+            std::swap(*l, lru);
+            l.release();
+        }
+    };
+
+    static constexpr size_t n_shards = 16;
+
+    shard_t &shard(const key_t &key) {
+        return shards_[std::hash<key_t>()(key) % n_shards];
+    }
+
+    void lock_all() {
+        for (auto &s : shards_)
+            s.mutex.lock();
+    }
+    void unlock_all() {
+        for (auto it = shards_.rbegin(); it != shards_.rend(); ++it)
+            it->mutex.unlock();
     }
 
     void update_entry(const key_t &key, const object_t &p) override {
@@ -255,7 +306,8 @@ private:
         // intended behavior
         if ((void *)key_merge == nullptr) return;
 
-        utils::lock_write_t lock_w(this->rw_mutex());
+        auto &s = shard(key);
+        std::lock_guard<std::mutex> lock(s.mutex);
 
         if (capacity_ == 0) { return; }
 
@@ -264,8 +316,8 @@ private:
         //    by another thread
         // 2. After the requested entry had been evicted it was inserted again
         //    by another thread
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()
+        auto it = s.entries.find(key);
+        if (it == s.entries.end()
                 || it->first.thread_id() != key.thread_id()) {
             return;
         }
@@ -273,95 +325,94 @@ private:
         key_merge(it->first, p);
     }
 
-    void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
+    void erase(shard_t &s, typename entries_t::iterator it) {
+        s.lru.erase(it->second.lru_it);
+        s.entries.erase(it);
+        s.size--;
+        size_--;
+    }
 
-        if (n == capacity_) {
-            cache_mapper().clear();
-            return;
-        }
+    void evict_tail(shard_t &s) {
+        auto it = s.entries.find(*s.lru.back().key);
+        assert(it != s.entries.end());
+        erase(s, it);
+        s.evictions++;
+    }
 
-        for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                        // By default, load() and operator T use sequentially
-                        // consistent memory ordering, which enforces writing
-                        // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
-                        // microseconds performance improvement for default
-                        // cache capacity.
-                        return left.second.timestamp_.load(
-                                       std::memory_order_relaxed)
-                                < right.second.timestamp_.load(
-                                        std::memory_order_relaxed);
-                    });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
-        }
+    static size_t get_timestamp() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        return cpu::platform::get_timestamp();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
     }
-    void add(const key_t &key, const value_t &value) {
-        // std::list::size() method has linear complexity. Check the cache size
-        // using std::unordered_map::size();
-        if (get_size_no_lock() == capacity_) {
-            // Evict the least recently used entry
-            evict(1);
+
+    // Evicts the least recently used entry of the whole cache, all shards
+    // must be locked.
+    void evict_lru_no_lock() {
+        shard_t *victim = nullptr;
+        for (auto &s : shards_)
+            if (!s.lru.empty()
+                    && (!victim
+                            || s.lru.back().timestamp
+                                    < victim->lru.back().timestamp))
+                victim = &s;
+        if (victim) evict_tail(*victim);
+    }
+
+    // Evicts an entry to make room for the one just added to shard `s`,
+    // which must be locked. Returns false if no entry could be evicted.
+    bool evict_for_no_lock(shard_t &s) {
+        const int share = nstl::max(1, capacity_.load() / (int)n_shards);
+        if (s.size > share) {
+            evict_tail(s);
+            return true;
         }
 
-        size_t timestamp = get_timestamp();
+        shard_t *victim = nullptr;
+        for (auto &o : shards_)
+            if (&o != &s && o.size > 0 && (!victim || o.size > victim->size))
+                victim = &o;
+        // Waiting for the lock of another shard while holding the one of `s`
+        // could deadlock.
+        if (victim && victim->mutex.try_lock()) {
+            const bool evicted = !victim->lru.empty();
+            if (evicted) evict_tail(*victim);
+            victim->mutex.unlock();
+            if (evicted) return true;
+        }
+        // The new entry is at the head of the list.
+        if (s.size <= 1) return false;
+        evict_tail(s);
+        return true;
+    }
 
-        auto res = cache_mapper().emplace(std::piecewise_construct,
-                std::forward_as_tuple(key),
-                std::forward_as_tuple(value, timestamp));
+    void add(shard_t &s, const key_t &key, const value_t &value) {
+        auto res = s.entries.emplace(std::piecewise_construct,
+                std::forward_as_tuple(key), std::forward_as_tuple(value));
         MAYBE_UNUSED(res);
         assert(res.second);
+        s.lru.push_front({&res.first->first, get_timestamp()});
+        res.first->second.lru_it = s.lru.begin();
+        s.size++;
+        size_++;
     }
-    value_t get_future(const key_t &key) {
-        auto it = cache_mapper().find(key);
-        if (it == cache_mapper().end()) return value_t();
 
-        size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+    value_t get_future(shard_t &s, const key_t &key) {
+        auto it = s.entries.find(key);
+        if (it == s.entries.end()) return value_t();
+
+        // Mark the entry as the most recently used one
+        auto &lru_it = it->second.lru_it;
+        lru_it->timestamp = get_timestamp();
+        s.lru.splice(s.lru.begin(), s.lru, lru_it);
         // Return the entry
         return it->second.value_;
     }
 
-    int capacity_;
-    struct timed_entry_t {
-        value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
-    };
-
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return cache_mapper_;
-    }
-
-    // Leaks cached resources. Used to avoid issues with calling destructors
-    // allocated by an already unloaded dynamic library.
-    void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
-        std::swap(*t, cache_mapper_);
-        t.release();
-    }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+    std::atomic<int> capacity_;
+    std::atomic<int> size_ {0};
+    std::array<shard_t, n_shards> shards_;
 };
 
 } // namespace utils
@@ -100,6 +100,7 @@ const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_csr) return "csr";
     if (v == dnnl_packed) return "packed";
     if (v == dnnl_coo) return "coo";
+    if (v == dnnl_bsr) return "bsr";
     assert(!"unknown sparse_encoding");
     return "unknown sparse_encoding";
 }
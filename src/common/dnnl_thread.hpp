@@ -18,7 +18,9 @@
 #define COMMON_DNNL_THREAD_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 
 #include "utils.hpp"
@@ -245,6 +247,80 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
     balance211(ny, grp_nthr, grp_ithr, ny_start, ny_end);
 }
 
+// Same as balance211 but the amount of work of thread `tid` is proportional to
+// `weights[tid]`, e.g. to account for threads running on cores of different
+// performance. Splits the work evenly if `weights` is nullptr.
+template <typename T, typename U>
+inline void balance211(
+        T n, U team, U tid, const float *weights, T &n_start, T &n_end) {
+    if (weights == nullptr || team <= 1 || n == 0) {
+        balance211(n, team, tid, n_start, n_end);
+        return;
+    }
+
+    // Both bounds are computed by the same summation order, so the end of one
+    // thread is exactly the start of the next one.
+    double total = 0, before = 0, after = 0;
+    for (U i = 0; i < team; i++) {
+        total += weights[i];
+        if (i == tid) after = total;
+        if (i < tid) before = total;
+    }
+    if (total <= 0) {
+        balance211(n, team, tid, n_start, n_end);
+        return;
+    }
+    n_start = tid == 0 ? 0 : (T)((double)n * (before / total) + 0.5);
+    n_end = tid == team - 1 ? n : (T)((double)n * (after / total) + 0.5);
+}
+
+// Same as balance2D but the work is distributed according to the weights of
+// the threads, see the weighted balance211.
+template <typename T, typename U>
+void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
+        T &nx_end, T nx_divider, const float *weights) {
+    if (weights == nullptr) {
+        balance2D(nthr, ithr, ny, ny_start, ny_end, nx, nx_start, nx_end,
+                nx_divider);
+        return;
+    }
+
+    const int grp_count
+            = static_cast<int>(nstl::min(nx_divider, static_cast<T>(nthr)));
+    const int grp_size_big = nthr / grp_count + 1;
+    const int grp_size_small = nthr / grp_count;
+    const int n_grp_big = nthr % grp_count;
+
+    // Threads of a group are contiguous, the weight of a group is the total
+    // weight of its threads.
+    const auto grp_first_thr = [&](int grp) {
+        return grp < n_grp_big ? grp * grp_size_big
+                               : n_grp_big * grp_size_big
+                        + (grp - n_grp_big) * grp_size_small;
+    };
+    // Groups are split evenly if there are too many of them.
+    constexpr int max_weighted_groups = 64;
+    float grp_weights[max_weighted_groups];
+    const bool weigh_groups = grp_count <= max_weighted_groups;
+    int grp = 0;
+    for (int g = 0; g < grp_count; g++) {
+        const int first = grp_first_thr(g);
+        const int last = grp_first_thr(g + 1);
+        if (first <= (int)ithr && (int)ithr < last) grp = g;
+        if (!weigh_groups) continue;
+        grp_weights[g] = 0.f;
+        for (int i = first; i < last; i++)
+            grp_weights[g] += weights[i];
+    }
+    const int grp_first = grp_first_thr(grp);
+    const int grp_nthr = grp_first_thr(grp + 1) - grp_first;
+
+    balance211(nx, grp_count, grp, weigh_groups ? grp_weights : nullptr,
+            nx_start, nx_end);
+    balance211(ny, grp_nthr, (int)ithr - grp_first, weights + grp_first,
+            ny_start, ny_end);
+}
+
 /* Functions:
  *  - parallel(nthr, f)                  - executes f in parallel using at
  *                                         most nthr threads. If nthr equals
@@ -259,6 +335,16 @@ void balance2D(U nthr, U ithr, T ny, T &ny_start, T &ny_end, T nx, T &nx_start,
  *                                         calls for_nd
  *  - parallel_nd_ext(nthr, dims..., f)  - creates a parallel section and then
  *                                         calls for_nd_ext
+ *  - parallel_dynamic(nthr, work, f)    - creates a parallel section and
+ *                                         distributes [0, work) in chunks
+ *                                         with work stealing
+ *  - parallel_nd_dynamic(dims..., f)    - same as parallel_nd but the
+ *                                         iterations are scheduled by
+ *                                         parallel_dynamic
+ *  - parallel_nd_dynamic_ext(nthr, dims..., f)
+ *                                       - same as parallel_nd_ext but the
+ *                                         iterations are scheduled by
+ *                                         parallel_dynamic
  */
 
 /* general parallelization */
@@ -641,6 +727,134 @@ static inline void parallel_nd(dim_t D0, dim_t D1, dim_t D2, dim_t D3, dim_t D4,
         });
 }
 
+/* dynamic scheduling section */
+// Static partitioning makes a loop as slow as its slowest thread, which is
+// a problem for iterations of uneven cost (ragged batches, causal attention,
+// sparse rows) and for hybrid CPUs with cores of different performance.
+//
+// The dynamic scheduler starts each thread on the part of the iteration space
+// balance211() would give it, split into chunks. Once a thread is done with
+// its own part it takes the remaining chunks of the other threads. The
+// scheduler is built on `parallel()` only, so it works with every threading
+// runtime. With threadpool it also covers pools that start some of the tasks
+// late: the work of such tasks is taken over by the running ones.
+
+// Returns the number of iterations threads take at once.
+inline dim_t dynamic_chunk_size(dim_t work_amount, int nthr) {
+    // Several chunks per thread leave room for balancing while keeping the
+    // number of atomic operations low.
+    constexpr dim_t chunks_per_thread = 8;
+    return std::max(
+            (dim_t)1, utils::div_up(work_amount, nthr * chunks_per_thread));
+}
+
+// Calls f(ithr, nthr, start, end) for disjoint ranges covering
+// [0, work_amount). A thread may process several ranges.
+static inline void parallel_dynamic(int nthr, dim_t work_amount,
+        const std::function<void(int, int, dim_t, dim_t)> &f) {
+    if (work_amount <= 0) return;
+    nthr = adjust_num_threads(nthr, work_amount);
+    if (nthr <= 1) {
+        f(0, 1, 0, work_amount);
+        return;
+    }
+
+    // Ranges are padded to avoid false sharing of their cursors.
+    struct range_t {
+        std::atomic<dim_t> next;
+        dim_t end;
+        char pad[64 - sizeof(std::atomic<dim_t>) - sizeof(dim_t)];
+    };
+    std::unique_ptr<range_t[]> ranges(new range_t[nthr]);
+    for (int i = 0; i < nthr; i++) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, i, start, end);
+        ranges[i].next = start;
+        ranges[i].end = end;
+    }
+
+    const int nranges = nthr;
+    const dim_t chunk = dynamic_chunk_size(work_amount, nthr);
+    parallel(nthr, [&](int ithr, int nthr) {
+        // The runtime may provide fewer threads than requested, hence the
+        // loop over all the ranges rather than over `nthr` of them.
+        for (int i = 0; i < nranges; i++) {
+            range_t &r = ranges[(ithr + i) % nranges];
+            for (dim_t start = r.next.fetch_add(chunk); start < r.end;
+                    start = r.next.fetch_add(chunk))
+                f(ithr, nthr, start, std::min(start + chunk, r.end));
+        }
+    });
+}
+
+/* parallel_nd_dynamic section */
+static inline void parallel_nd_dynamic(
+        dim_t D0, const std::function<void(dim_t)> &f) {
+    parallel_dynamic(
+            0, D0, [&](int ithr, int nthr, dim_t start, dim_t end) {
+                for (dim_t d0 = start; d0 < end; ++d0)
+                    f(d0);
+            });
+}
+static inline void parallel_nd_dynamic(
+        dim_t D0, dim_t D1, const std::function<void(dim_t, dim_t)> &f) {
+    parallel_dynamic(
+            0, D0 * D1, [&](int ithr, int nthr, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1);
+                    utils::nd_iterator_step(d0, D0, d1, D1);
+                }
+            });
+}
+static inline void parallel_nd_dynamic(dim_t D0, dim_t D1, dim_t D2,
+        const std::function<void(dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(
+            0, D0 * D1 * D2, [&](int ithr, int nthr, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(d0, d1, d2);
+                    utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+                }
+            });
+}
+
+/* parallel_nd_dynamic_ext section */
+static inline void parallel_nd_dynamic_ext(
+        int nthr, dim_t D0, const std::function<void(int, int, dim_t)> &f) {
+    parallel_dynamic(
+            nthr, D0, [&](int ithr, int nthr, dim_t start, dim_t end) {
+                for (dim_t d0 = start; d0 < end; ++d0)
+                    f(ithr, nthr, d0);
+            });
+}
+static inline void parallel_nd_dynamic_ext(int nthr, dim_t D0, dim_t D1,
+        const std::function<void(int, int, dim_t, dim_t)> &f) {
+    parallel_dynamic(
+            nthr, D0 * D1, [&](int ithr, int nthr, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(ithr, nthr, d0, d1);
+                    utils::nd_iterator_step(d0, D0, d1, D1);
+                }
+            });
+}
+static inline void parallel_nd_dynamic_ext(int nthr, dim_t D0, dim_t D1,
+        dim_t D2, const std::function<void(int, int, dim_t, dim_t, dim_t)> &f) {
+    parallel_dynamic(nthr, D0 * D1 * D2,
+            [&](int ithr, int nthr, dim_t start, dim_t end) {
+                dim_t d0 {0}, d1 {0}, d2 {0};
+                utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+                for (dim_t iwork = start; iwork < end; ++iwork) {
+                    f(ithr, nthr, d0, d1, d2);
+                    utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+                }
+            });
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/huge_pages.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#ifdef __linux__
+#include <fstream>
+#include <sstream>
+#include <stdlib.h>
+#include <sys/mman.h>
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace huge_pages {
+
+namespace {
+
+huge_pages_policy_t init_policy() {
+    const std::string val = getenv_string_user("HUGE_PAGES");
+    if (val == "madvise") return dnnl_huge_pages_madvise;
+    if (val == "hugetlb") return dnnl_huge_pages_hugetlb;
+    return dnnl_huge_pages_none;
+}
+
+// The settings and the registry are never destroyed, as buffers may be freed
+// by static destructors.
+std::atomic<int> &policy_setting() {
+    static auto *p = new std::atomic<int>(init_policy());
+    return *p;
+}
+
+std::atomic<size_t> &threshold_setting() {
+    static auto *t = new std::atomic<size_t>(
+            (size_t)getenv_int_user("HUGE_PAGES_THRESHOLD", (int)page_size));
+    return *t;
+}
+
+struct block_t {
+    size_t size;
+    bool hugetlb;
+};
+
+struct registry_t {
+    std::mutex mutex;
+    std::unordered_map<void *, block_t> blocks;
+    // The number of blocks is checked without the lock, so that freeing the
+    // other buffers costs nothing while there are no huge pages.
+    std::atomic<size_t> nblocks {0};
+    std::atomic<uint64_t> hugetlb_allocations {0};
+    std::atomic<uint64_t> madvise_allocations {0};
+    std::atomic<uint64_t> fallbacks {0};
+};
+
+registry_t &registry() {
+    static auto *r = new registry_t();
+    return *r;
+}
+
+#ifdef __linux__
+struct mapping_t {
+    uintptr_t start, end;
+    size_t anon_huge_size;
+};
+
+// Returns the mappings of the process with their memory in transparent huge
+// pages, as listed in /proc/self/smaps.
+std::vector<mapping_t> read_mappings() {
+    std::vector<mapping_t> mappings;
+    std::ifstream f("/proc/self/smaps");
+    std::string line;
+    while (std::getline(f, line)) {
+        if (line.compare(0, 14, "AnonHugePages:") == 0) {
+            if (mappings.empty()) continue;
+            std::istringstream ss(line.substr(14));
+            size_t kb = 0;
+            ss >> kb;
+            mappings.back().anon_huge_size = kb * 1024;
+            continue;
+        }
+        // The header of a mapping starts with its address range, e.g.
+        // `7f0000000000-7f0000200000 rw-p ...`, while the fields start with
+        // a name followed by a colon.
+        const size_t dash = line.find('-');
+        const size_t space = line.find(' ');
+        if (dash == std::string::npos || space == std::string::npos
+                || dash > space || line.find(':') < dash)
+            continue;
+        mapping_t m;
+        m.start = std::stoull(line.substr(0, dash), nullptr, 16);
+        m.end = std::stoull(
+                line.substr(dash + 1, space - dash - 1), nullptr, 16);
+        m.anon_huge_size = 0;
+        mappings.push_back(m);
+    }
+    return mappings;
+}
+
+// Returns the size of [p, p + size) which resides in transparent huge pages.
+size_t resident_size(
+        const std::vector<mapping_t> &mappings, const void *p, size_t size) {
+    const uintptr_t start = reinterpret_cast<uintptr_t>(p);
+    const uintptr_t end = start + size;
+    size_t resident = 0;
+    for (const auto &m : mappings) {
+        if (m.end <= start || m.start >= end) continue;
+        // A mapping may hold other buffers, so that its huge pages are
+        // bounded by the part of the buffer it covers.
+        const size_t overlap = std::min(m.end, end) - std::max(m.start, start);
+        resident += std::min(m.anon_huge_size, overlap);
+    }
+    return resident;
+}
+#endif
+
+} // namespace
+
+const char *policy2str(huge_pages_policy_t policy) {
+    switch (policy) {
+        case dnnl_huge_pages_madvise: return "madvise";
+        case dnnl_huge_pages_hugetlb: return "hugetlb";
+        default: return "none";
+    }
+}
+
+status_t set_policy(huge_pages_policy_t policy, size_t threshold) {
+    if (!utils::one_of(policy, dnnl_huge_pages_none, dnnl_huge_pages_madvise,
+                dnnl_huge_pages_hugetlb))
+        return status::invalid_arguments;
+#ifndef __linux__
+    if (policy != dnnl_huge_pages_none) return status::unimplemented;
+#endif
+    policy_setting().store(policy);
+    threshold_setting().store(threshold);
+    return status::success;
+}
+
+void get_policy(huge_pages_policy_t &policy, size_t &threshold) {
+    policy = static_cast<huge_pages_policy_t>(policy_setting().load());
+    threshold = threshold_setting().load();
+}
+
+huge_pages_stats_t get_stats() {
+    auto &r = registry();
+    huge_pages_stats_t stats {};
+    stats.hugetlb_allocations = r.hugetlb_allocations.load();
+    stats.madvise_allocations = r.madvise_allocations.load();
+    stats.fallbacks = r.fallbacks.load();
+#ifdef __linux__
+    // The mappings are read before taking the lock, as reading them
+    // allocates memory.
+    const auto mappings = r.nblocks.load() ? read_mappings()
+                                           : std::vector<mapping_t>();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (const auto &b : r.blocks) {
+        stats.size += b.second.size;
+        stats.resident_size += b.second.hugetlb
+                ? b.second.size
+                : resident_size(mappings, b.first, b.second.size);
+    }
+#endif
+    return stats;
+}
+
+void *malloc(size_t size, int alignment) {
+#ifdef __linux__
+    const auto policy
+            = static_cast<huge_pages_policy_t>(policy_setting().load());
+    if (policy == dnnl_huge_pages_none || size < threshold_setting().load())
+        return nullptr;
+
+    auto &r = registry();
+    const size_t mapped_size = utils::rnd_up(size, page_size);
+    void *ptr = nullptr;
+    bool hugetlb = false;
+    if (policy == dnnl_huge_pages_hugetlb) {
+#ifdef MAP_HUGETLB
+        ptr = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        hugetlb = ptr != MAP_FAILED;
+#endif
+        if (!hugetlb) {
+            ptr = nullptr;
+            r.fallbacks++;
+        }
+    }
+    if (!hugetlb) {
+        // The buffer is aligned on a huge page so that it is fully covered by
+        // huge pages. Advising fails when transparent huge pages are disabled
+        // and the buffer is then backed by regular pages.
+        const size_t align = std::max((size_t)alignment, page_size);
+        if (::posix_memalign(&ptr, align, mapped_size) != 0) return nullptr;
+        ::madvise(ptr, mapped_size, MADV_HUGEPAGE);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.blocks[ptr] = {mapped_size, hugetlb};
+        r.nblocks++;
+    }
+    (hugetlb ? r.hugetlb_allocations : r.madvise_allocations)++;
+
+    if (get_verbose(verbose_t::create_profile))
+        verbose_printf("common,info,huge_pages,alloc,%s,size:%zu\n",
+                hugetlb ? "hugetlb" : "madvise", mapped_size);
+    return ptr;
+#else
+    UNUSED(size);
+    UNUSED(alignment);
+    return nullptr;
+#endif
+}
+
+bool free(void *p) {
+#ifdef __linux__
+    auto &r = registry();
+    if (p == nullptr || r.nblocks.load() == 0) return false;
+
+    block_t b;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        auto it = r.blocks.find(p);
+        if (it == r.blocks.end()) return false;
+        b = it->second;
+        r.blocks.erase(it);
+        r.nblocks--;
+    }
+
+    // The residency of the buffer is known once it has been used.
+    if (get_verbose(verbose_t::create_profile)) {
+        const size_t resident = b.hugetlb
+                ? b.size
+                : resident_size(read_mappings(), p, b.size);
+        verbose_printf(
+                "common,info,huge_pages,free,%s,size:%zu,resident:%zu\n",
+                b.hugetlb ? "hugetlb" : "madvise", b.size, resident);
+    }
+
+    if (b.hugetlb)
+        ::munmap(p, b.size);
+    else
+        ::free(p);
+    return true;
+#else
+    UNUSED(p);
+    return false;
+#endif
+}
+
+} // namespace huge_pages
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl_status_t dnnl_set_huge_pages_policy(
+        dnnl_huge_pages_policy_t policy, size_t threshold) {
+    return dnnl::impl::huge_pages::set_policy(policy, threshold);
+}
+
+dnnl_status_t dnnl_get_huge_pages_policy(
+        dnnl_huge_pages_policy_t *policy, size_t *threshold) {
+    if (policy == nullptr || threshold == nullptr)
+        return dnnl_invalid_arguments;
+    dnnl::impl::huge_pages::get_policy(*policy, *threshold);
+    return dnnl_success;
+}
+
+dnnl_status_t dnnl_get_huge_pages_stats(dnnl_huge_pages_stats_t *stats) {
+    if (stats == nullptr) return dnnl_invalid_arguments;
+    *stats = dnnl::impl::huge_pages::get_stats();
+    return dnnl_success;
+}
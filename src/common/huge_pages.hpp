@@ -0,0 +1,51 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_HUGE_PAGES_HPP
+#define COMMON_HUGE_PAGES_HPP
+
+#include <cstddef>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Backing of the large buffers allocated by `impl::malloc()` with 2 MiB
+// pages, see dnnl_set_huge_pages_policy().
+namespace huge_pages {
+
+constexpr size_t page_size = 2 * 1024 * 1024;
+
+status_t set_policy(huge_pages_policy_t policy, size_t threshold);
+void get_policy(huge_pages_policy_t &policy, size_t &threshold);
+huge_pages_stats_t get_stats();
+
+// Returns a buffer of `size` bytes backed by huge pages according to the
+// policy, or nullptr if the policy doesn't apply to the buffer.
+void *malloc(size_t size, int alignment);
+// Frees `p` and returns true if it was returned by huge_pages::malloc(),
+// returns false otherwise.
+bool free(void *p);
+
+const char *policy2str(huge_pages_policy_t policy);
+
+} // namespace huge_pages
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
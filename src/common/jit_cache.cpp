@@ -0,0 +1,279 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/dnnl_thread.hpp"
+#include "common/engine.hpp"
+#include "common/jit_cache.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/primitive_serialization.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace jit_cache {
+
+namespace {
+
+thread_local const scope_t *current_scope = nullptr;
+
+#ifdef __linux__
+// File layout: header, relocations, identity of the kernel, code. All the
+// fields of the header are 8 bytes wide to keep relocations aligned in the
+// mapped file.
+constexpr char file_magic[8] = {'D', 'N', 'N', 'L', 'J', 'I', 'T', '1'};
+
+struct header_t {
+    char magic[8];
+    uint64_t id_size;
+    uint64_t n_relocs;
+    uint64_t code_size;
+    uint64_t checksum;
+};
+
+// FNV-1a, protects against truncated or otherwise corrupted files.
+uint64_t checksum(const uint8_t *data, size_t size, uint64_t seed) {
+    for (size_t i = 0; i < size; i++) {
+        seed ^= data[i];
+        seed *= 0x100000001b3ULL;
+    }
+    return seed;
+}
+
+constexpr uint64_t checksum_seed = 0xcbf29ce484222325ULL;
+
+std::string file_path(const std::string &dir, const scope_t &scope,
+        const serialization_stream_t &kernel_id) {
+    const size_t hash
+            = hash_combine(scope.id().get_hash(), kernel_id.get_hash());
+    ostringstream_t oss;
+    oss << dir << "/dnnl_jit_" << std::hex << std::setfill('0')
+        << std::setw(16) << hash << ".bin";
+    return oss.str();
+}
+
+// Keeps the cache files mapped for the library lifetime since the code of
+// loaded kernels is copied lazily by their generators.
+struct mapped_files_t {
+    ~mapped_files_t() {
+        for (const auto &f : files_)
+            if (f.second.addr) munmap(f.second.addr, f.second.size);
+    }
+
+    // Returns the mapping of the file or {nullptr, 0} if it can't be mapped.
+    std::pair<const uint8_t *, size_t> get(const std::string &path) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = files_.find(path);
+        if (it == files_.end()) it = files_.emplace(path, map(path)).first;
+        return {static_cast<const uint8_t *>(it->second.addr),
+                it->second.size};
+    }
+
+private:
+    struct mapping_t {
+        void *addr;
+        size_t size;
+    };
+
+    static mapping_t map(const std::string &path) {
+        mapping_t m {nullptr, 0};
+        const int fd = open(path.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+        if (fd < 0) return m;
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)
+                && st.st_size >= (off_t)sizeof(header_t)) {
+            void *addr = mmap(nullptr, (size_t)st.st_size, PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) m = {addr, (size_t)st.st_size};
+        }
+        close(fd);
+        return m;
+    }
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, mapping_t> files_;
+};
+
+mapped_files_t &mapped_files() {
+    static mapped_files_t files;
+    return files;
+}
+
+bool write_all(int fd, const void *data, size_t size) {
+    const auto *p = static_cast<const uint8_t *>(data);
+    while (size > 0) {
+        const ssize_t n = write(fd, p, size);
+        if (n <= 0) return false;
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+#endif
+
+} // namespace
+
+bool is_enabled() {
+#ifdef __linux__
+    return !get_jit_cache_dir().empty();
+#else
+    return false;
+#endif
+}
+
+scope_t::scope_t(const engine_t *engine, const primitive_desc_t *pd)
+    : prev_(current_scope) {
+    current_scope = this;
+    if (engine->kind() != engine_kind::cpu || !is_enabled()) return;
+
+    // The identity follows the one of cache blob IDs, with the CPU ISA
+    // and implementation name added since the generated code depends on them.
+    if (serialize_desc(id_, pd->op_desc()) != status::success) return;
+    serialize(id_, *pd->attr());
+    id_.append(dnnl_get_max_threads());
+    for (const auto &md : pd->hint_mds(false /* is_hint */))
+        serialize(id_, md);
+    id_.append(pd->pd_iterator_offset());
+    id_.append(pd->skip_idx());
+    id_.append_array(std::strlen(pd->name()), pd->name());
+    id_.append(dnnl_get_effective_cpu_isa());
+
+    auto version = dnnl_version();
+    id_.append(version->major);
+    id_.append(version->minor);
+    id_.append(version->patch);
+    id_.append_array(std::strlen(version->hash), version->hash);
+
+    active_ = true;
+}
+
+scope_t::~scope_t() {
+    current_scope = prev_;
+}
+
+const scope_t *scope_t::current() {
+    // An inactive scope hides the outer ones: kernels of a nested primitive
+    // must not be attributed to its parent.
+    return current_scope && current_scope->active_ ? current_scope : nullptr;
+}
+
+bool load(const scope_t &scope, const serialization_stream_t &kernel_id,
+        entry_t &entry) {
+#ifdef __linux__
+    const std::string dir = get_jit_cache_dir();
+    if (dir.empty()) return false;
+
+    const auto file = mapped_files().get(file_path(dir, scope, kernel_id));
+    const uint8_t *data = file.first;
+    const size_t size = file.second;
+    if (!data) return false;
+
+    header_t h;
+    std::memcpy(&h, data, sizeof(h));
+    if (std::memcmp(h.magic, file_magic, sizeof(file_magic)) != 0)
+        return false;
+
+    const auto &sid = scope.id().get_data();
+    const auto &kid = kernel_id.get_data();
+    if (h.id_size != sid.size() + kid.size()) return false;
+    const size_t payload = size - sizeof(h);
+    if (h.n_relocs > payload / sizeof(uint64_t)
+            || h.code_size > payload - h.n_relocs * sizeof(uint64_t)
+            || h.id_size != payload - h.n_relocs * sizeof(uint64_t)
+                            - h.code_size)
+        return false;
+    if (checksum(data + sizeof(h), payload, checksum_seed) != h.checksum)
+        return false;
+
+    const auto *relocs = reinterpret_cast<const uint64_t *>(data + sizeof(h));
+    const uint8_t *id = data + sizeof(h) + h.n_relocs * sizeof(uint64_t);
+    if (std::memcmp(id, sid.data(), sid.size()) != 0
+            || std::memcmp(id + sid.size(), kid.data(), kid.size()) != 0)
+        return false;
+    for (size_t i = 0; i < h.n_relocs; i++)
+        if (h.code_size < sizeof(uint64_t)
+                || relocs[i] > h.code_size - sizeof(uint64_t))
+            return false;
+
+    entry.code = id + h.id_size;
+    entry.code_size = h.code_size;
+    entry.relocs = relocs;
+    entry.n_relocs = h.n_relocs;
+    return true;
+#else
+    return false;
+#endif
+}
+
+void store(const scope_t &scope, const serialization_stream_t &kernel_id,
+        const entry_t &entry) {
+#ifdef __linux__
+    const std::string dir = get_jit_cache_dir();
+    if (dir.empty()) return;
+
+    const auto &sid = scope.id().get_data();
+    const auto &kid = kernel_id.get_data();
+    const size_t relocs_size = entry.n_relocs * sizeof(uint64_t);
+
+    header_t h;
+    std::memcpy(h.magic, file_magic, sizeof(file_magic));
+    h.id_size = sid.size() + kid.size();
+    h.n_relocs = entry.n_relocs;
+    h.code_size = entry.code_size;
+    h.checksum = checksum(reinterpret_cast<const uint8_t *>(entry.relocs),
+            relocs_size, checksum_seed);
+    h.checksum = checksum(sid.data(), sid.size(), h.checksum);
+    h.checksum = checksum(kid.data(), kid.size(), h.checksum);
+    h.checksum = checksum(entry.code, entry.code_size, h.checksum);
+
+    // The file is written under a unique name and renamed afterwards, so
+    // concurrent readers never observe a partially written kernel.
+    static std::atomic<unsigned> counter {0};
+    const std::string path = file_path(dir, scope, kernel_id);
+    const std::string tmp_path = path + "." + std::to_string(getpid()) + "."
+            + std::to_string(counter++) + ".tmp";
+    const int fd = open(tmp_path.c_str(),
+            O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0644);
+    if (fd < 0) return;
+
+    const bool ok = write_all(fd, &h, sizeof(h))
+            && write_all(fd, entry.relocs, relocs_size)
+            && write_all(fd, sid.data(), sid.size())
+            && write_all(fd, kid.data(), kid.size())
+            && write_all(fd, entry.code, entry.code_size);
+    if (close(fd) != 0 || !ok || rename(tmp_path.c_str(), path.c_str()) != 0)
+        unlink(tmp_path.c_str());
+#endif
+}
+
+} // namespace jit_cache
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
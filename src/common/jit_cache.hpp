@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_JIT_CACHE_HPP
+#define COMMON_JIT_CACHE_HPP
+
+#include <cstdint>
+
+#include "common/c_types_map.hpp"
+#include "common/serialization.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+struct primitive_desc_t;
+
+// Persistent cache of JIT kernel code shared between processes through the
+// directory set by `dnnl_set_jit_cache_dir()` or ONEDNN_JIT_CACHE_DIR.
+//
+// A kernel is identified by the primitive it is created for and by its own
+// identity provided by the kernel generator. Each kernel is stored in a
+// separate file holding the full identity, so a hash collision of file names
+// can't result in using a wrong kernel.
+namespace jit_cache {
+
+bool is_enabled();
+
+// Marks the primitive created by the current thread while the object is
+// alive. Kernels generated outside of any scope are never cached.
+struct scope_t {
+    scope_t(const engine_t *engine, const primitive_desc_t *pd);
+    ~scope_t();
+
+    // Returns the innermost scope of the calling thread or nullptr.
+    static const scope_t *current();
+
+    const serialization_stream_t &id() const { return id_; }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+
+private:
+    serialization_stream_t id_;
+    const scope_t *prev_ = nullptr;
+    bool active_ = false;
+};
+
+// Kernel code with the list of 64-bit slots holding offsets within the code,
+// that must be rebased on the code address after copying it.
+struct entry_t {
+    const uint8_t *code = nullptr;
+    size_t code_size = 0;
+    const uint64_t *relocs = nullptr;
+    size_t n_relocs = 0;
+};
+
+// Looks up the kernel `kernel_id` created within `scope`. The memory the
+// entry points to is mapped until the library is unloaded.
+bool load(const scope_t &scope, const serialization_stream_t &kernel_id,
+        entry_t &entry);
+
+// Stores the kernel, failures are silently ignored.
+void store(const scope_t &scope, const serialization_stream_t &kernel_id,
+        const entry_t &entry);
+
+} // namespace jit_cache
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -47,6 +47,7 @@ struct iface_t::cache_t {
     }
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
+    cache_stats_t get_stats() const { return cache_.get_stats(); }
 
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context) {
@@ -83,6 +84,10 @@ int iface_t::get_size() const {
     return cache_.get_size();
 }
 
+cache_stats_t iface_t::get_stats() const {
+    return cache_.get_stats();
+}
+
 iface_t::result_t iface_t::get_or_create(
         const key_t &key, create_func_t create, void *create_context) {
     auto r = cache_.get_or_create(key, create, create_context);
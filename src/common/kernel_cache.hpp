@@ -22,6 +22,7 @@
 #include <thread>
 
 #include "c_types_map.hpp"
+#include "cache_hit_types.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -125,6 +126,7 @@ struct iface_t {
     status_t set_capacity(int capacity);
     int get_capacity() const;
     int get_size() const;
+    cache_stats_t get_stats() const;
 
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context);
@@ -78,6 +78,13 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         attr_mask |= smask_t::scales_groups;
     }
 
+    // Matmul supports dynamic quantization of a floating point source for
+    // 8-bit integer weights.
+    const bool src_is_fp = utils::one_of(
+            src_dt, data_type::f32, data_type::bf16, data_type::f16);
+    if (src_is_fp && utils::one_of(wei_dt, data_type::s8, data_type::u8))
+        attr_mask |= smask_t::dynamic_quantization;
+
     // Matmul supports fpmath mode and accumulation mode
     attr_mask |= smask_t::fpmath_mode | smask_t::accumulation_mode;
 
@@ -327,6 +334,22 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         }
     }
 
+    // Check dynamic quantization
+    if (!attr->dynamic_quantization_.has_default_values()) {
+        const auto &dq = attr->dynamic_quantization_;
+
+        // Only per-token source quantization is supported: a scale per row
+        // of the source, computed over the K dimension.
+        VCHECK_MATMUL_UNIMPL(
+                dq.get_mask(DNNL_ARG_SRC) == (full_tensor_mask & ~src_qmask_K),
+                VERBOSE_UNSUPPORTED_DQ_CFG);
+
+        // Source quantization parameters are computed by the primitive.
+        VCHECK_MATMUL_UNIMPL(attr->scales_.has_default_values(DNNL_ARG_SRC)
+                        && attr->zero_points_.has_default_values(DNNL_ARG_SRC),
+                VERBOSE_UNSUPPORTED_DQ_CFG);
+    }
+
     // Check post-ops
     if (!attr->post_ops_.has_default_values()) {
         const auto &po = attr->post_ops_;
@@ -508,6 +531,73 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
             dst_desc, nullptr, matmul_reduce_kind::undef);
 }
 
+status_t grouped_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc,
+        const memory_desc_t *group_offsets_desc,
+        const memory_desc_t *dst_desc) {
+    VCHECK_MATMUL(!any_null(src_desc, weights_desc, group_offsets_desc,
+                          dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_MATMUL(!any_memory_desc_host_scalar(src_desc, weights_desc,
+                          bias_desc, group_offsets_desc, dst_desc),
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    auto op_d = matmul_desc_t();
+    op_d.primitive_kind = primitive_kind::matmul;
+
+    op_d.src_desc = *src_desc;
+    op_d.weights_desc = *weights_desc;
+    if (bias_desc) op_d.bias_desc = *bias_desc;
+    op_d.group_offsets_desc = *group_offsets_desc;
+    op_d.dst_desc = *dst_desc;
+
+    const bool with_bias = op_d.bias_desc.ndims != 0;
+    VCHECK_MATMUL(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_MATMUL(weights_desc->ndims == 3, VERBOSE_BAD_NDIMS, "weights",
+            weights_desc->ndims);
+    VCHECK_MATMUL(
+            dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst", dst_desc->ndims);
+    VCHECK_MATMUL(group_offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "group_offsets", group_offsets_desc->ndims);
+    VCHECK_MATMUL(IMPLICATION(with_bias, op_d.bias_desc.ndims == 2),
+            VERBOSE_BAD_NDIMS, "bias", op_d.bias_desc.ndims);
+
+    VCHECK_MATMUL(group_offsets_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "group_offsets");
+    VCHECK_MATMUL(group_offsets_desc->format_kind != format_kind::any,
+            VERBOSE_UNSUPPORTED_FORMAT_KIND);
+
+    // The number of groups and the matrices sizes are fixed, only the total
+    // number of rows may be defined at execution time.
+    const dim_t G = weights_desc->dims[0];
+    const dim_t K = weights_desc->dims[1];
+    const dim_t N = weights_desc->dims[2];
+    VCHECK_MATMUL(!one_of(DNNL_RUNTIME_DIM_VAL, G, K, N),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_MATMUL(group_offsets_desc->dims[0] == G, VERBOSE_INCONSISTENT_DIM,
+            "group_offsets", 0, "weights", 0);
+    VCHECK_MATMUL(dst_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+    VCHECK_MATMUL(src_desc->dims[1] == K, VERBOSE_INCONSISTENT_DIM, "src", 1,
+            "weights", 1);
+    VCHECK_MATMUL(dst_desc->dims[1] == N, VERBOSE_INCONSISTENT_DIM, "dst", 1,
+            "weights", 2);
+    VCHECK_MATMUL(
+            IMPLICATION(with_bias, one_of(op_d.bias_desc.dims[0], 1, G)),
+            VERBOSE_INCONSISTENT_DIM, "bias", 0, "weights", 0);
+    VCHECK_MATMUL(IMPLICATION(with_bias, op_d.bias_desc.dims[1] == N),
+            VERBOSE_INCONSISTENT_DIM, "bias", 1, "dst", 1);
+
+    op_d.accum_data_type = types::default_accum_data_type(src_desc->data_type,
+            weights_desc->data_type, dst_desc->data_type, prop_kind::forward);
+    VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
+            VERBOSE_INVALID_DATATYPE, "accumulation");
+    *matmul_desc = op_d;
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -523,3 +613,16 @@ status_t dnnl_matmul_primitive_desc_create(
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&matmul_desc, nullptr, attr);
 }
+
+status_t dnnl_grouped_matmul_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc, const memory_desc_t *group_offsets_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+    auto matmul_desc = matmul_desc_t();
+    CHECK(grouped_matmul_desc_init(&matmul_desc, src_desc, weights_desc,
+            bias_desc, group_offsets_desc, dst_desc));
+    CHECK(matmul_attr_check(matmul_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&matmul_desc, nullptr, attr);
+}
@@ -49,6 +49,12 @@ status_t matmul_desc_init(matmul_desc_t *matmul_desc,
         const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
         const memory_desc_t *bias_desc, const memory_desc_t *dst_desc);
 
+status_t grouped_matmul_desc_init(matmul_desc_t *matmul_desc,
+        const memory_desc_t *src_desc, const memory_desc_t *weights_desc,
+        const memory_desc_t *bias_desc,
+        const memory_desc_t *group_offsets_desc,
+        const memory_desc_t *dst_desc);
+
 // NOLINTBEGIN(google-default-arguments)
 struct matmul_pd_t : public primitive_desc_t {
     static constexpr auto base_pkind = primitive_kind::matmul;
@@ -68,6 +74,9 @@ struct matmul_pd_t : public primitive_desc_t {
         if (arg == DNNL_ARG_BIAS)
             return with_bias() ? arg_usage_t::input : arg_usage_t::unused;
 
+        if (arg == DNNL_ARG_GROUP_OFFSETS)
+            return is_grouped() ? arg_usage_t::input : arg_usage_t::unused;
+
         if (arg == DNNL_ARG_REDUCE)
             return with_reduce() ? arg_usage_t::output : arg_usage_t::unused;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
@@ -79,6 +88,7 @@ struct matmul_pd_t : public primitive_desc_t {
             int arg, bool user_input = false) const override {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_GROUP_OFFSETS: return src_md(1);
             case DNNL_ARG_WEIGHTS: return weights_md(0);
             case DNNL_ARG_BIAS: return weights_md(1);
             case DNNL_ARG_DST: return dst_md(0, user_input);
@@ -90,6 +100,9 @@ struct matmul_pd_t : public primitive_desc_t {
     const memory_desc_t *src_md(
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        if (index == 1)
+            return user_input ? &desc()->group_offsets_desc
+                              : &group_offsets_md_;
         return &glob_zero_md;
     }
 
@@ -114,7 +127,8 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
+        return 2 + with_bias() + is_grouped() + n_binary_po_inputs()
+                + n_prelu_po_inputs();
     }
     int n_outputs() const override { return 1 + with_reduce(); }
 
@@ -137,6 +151,14 @@ struct matmul_pd_t : public primitive_desc_t {
 
     matmul_reduce_kind_t reduce_kind() const { return desc_.reduce_kind; }
 
+    // A grouped matmul multiplies consecutive row ranges of a 2D source by
+    // the matrices of 3D weights. The ranges are known at execution time
+    // only.
+    bool is_grouped() const { return group_offsets_md_.ndims != 0; }
+    dim_t n_groups() const {
+        return is_grouped() ? group_offsets_md_.dims[0] : 1;
+    }
+
     bool batched() const { return ndims() > 2; }
 
     dim_t batch() const {
@@ -256,6 +278,7 @@ protected:
     memory_desc_t bias_md_;
     memory_desc_t dst_md_;
     memory_desc_t reduce_md_;
+    memory_desc_t group_offsets_md_;
 
     matmul_pd_t(const op_desc_t *adesc, const primitive_attr_t *attr,
             const matmul_pd_t *hint_fwd_pd)
@@ -265,7 +288,8 @@ protected:
         , weights_md_(desc_.weights_desc)
         , bias_md_(desc_.bias_desc)
         , dst_md_(desc_.dst_desc)
-        , reduce_md_(desc_.reduce_desc) {}
+        , reduce_md_(desc_.reduce_desc)
+        , group_offsets_md_(desc_.group_offsets_desc) {}
 
     // temporary solution to deal with format `any`
     bool set_default_formats() {
@@ -38,7 +38,12 @@ enum class wino_memory_format_t {
     // Tensor of weights for 4x3 convolution.
     //
     // Internal weights format for 4x3 Winograd.
-    wino_wei_OBaaIBOIio
+    wino_wei_OBaaIBOIio,
+    // Internal weights format for 4x3 brgemm-based Winograd: blocks of
+    // `oc_block` output channels, then the `alpha` x `alpha` points, then the
+    // input channels padded to `ic_block` and packed by `ic_block` elements
+    // next to each other (VNNI layout).
+    wino_wei_OBaaIoi
 };
 
 enum class rnn_packed_memory_format_t { undef, ldigo_p, ldgoi_p, ldio_p };
@@ -180,17 +185,25 @@ struct sparse_desc_t {
     //  - 0: values
     //  - 1: offsets
     //  - 2: bitmask
+    //
+    // BSR: Number of handles is 3:
+    //  - 0: values of the non-zero blocks
+    //  - 1: block column indices
+    //  - 2: block row pointers
     sparse_encoding_t encoding;
 
-    // Number of non-zero entries.
+    // Number of non-zero entries, or of non-zero blocks for BSR.
     dnnl_dim_t nnz;
 
     // Metadata types. Each encoding defines how to interpret these.
-    // - CSR: 0th - index data type
-    //        1st - pointer data type
+    // - CSR, BSR: 0th - index data type
+    //             1st - pointer data type
     // - packed: N/A
     dnnl_data_type_t metadata_types[max_metadata_types];
 
+    // BSR: dimensions of a block, the blocks are stored row-major.
+    dnnl_dims_t block_dims;
+
     // The packed sparse encoding is described with `blocking_desc_t` and
     // can only be initialized by the implementation. The special encoding
     // `packed` will instruct the implementation to do that.
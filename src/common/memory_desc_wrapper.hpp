@@ -312,6 +312,24 @@ struct memory_desc_wrapper : public c_compatible {
                     assert(!"unknown index");
                     return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                const dim_t *blk = sparse_desc().block_dims;
+                switch (index) {
+                    // Return size for values of the stored blocks.
+                    case 0: return nnz() * blk[0] * blk[1] * data_type_size();
+                    // Return size for block column indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return nnz() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block row pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        return (utils::div_up(dims()[0], blk[0]) + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown index"); return 0;
+                }
             } else if (sparse_desc().encoding == sparse_encoding::packed) {
                 // If the size if queried from a user-created memory descriptor.
                 if (blocking_desc().strides[0] == 0) return 0;
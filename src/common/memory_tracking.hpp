@@ -166,6 +166,7 @@ enum {
     key_brgemm_primitive_buffer_d,
     key_brgemm_primitive_zp_comp_a,
     key_brgemm_primitive_zp_comp_b,
+    key_brgemm_primitive_src_dq_scales,
     key_brgemm_primitive_buffer_reduce,
     key_concat_iptrs,
     key_concat_istrides,
@@ -275,7 +276,12 @@ enum {
     key_matmul_dst_trans,
     key_matmul_dst_cast_acc,
     key_matmul_dst_scales,
+    key_matmul_group_acc,
+    key_matmul_group_work,
     key_matmul_sparse_tmp_ptr,
+    key_matmul_sparse_wei_blocks,
+    key_matmul_sparse_wei_vnni,
+    key_matmul_vec_f32,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -322,6 +328,12 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_k_buffer,
+    key_sdpa_probs,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_v_buffer,
     key_softmax_dst_scales,
     key_softmax_reduction,
     key_softmax_interim_store,
@@ -277,6 +277,10 @@ struct matmul_desc_t : public op_desc_t {
     memory_desc_t reduce_desc;
     // Reduce kind.
     matmul_reduce_kind_t reduce_kind {};
+    // Group offsets memory descriptor. Set for a grouped matmul only, where
+    // the rows of a 2D source are split into groups multiplied by the
+    // matrices of 3D weights.
+    memory_desc_t group_offsets_desc;
     // The accumulator data type. Initialized automatically.
     data_type_t accum_data_type {};
 };
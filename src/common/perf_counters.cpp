@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <mutex>
+
+#if defined(DNNL_ENABLE_PERF_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define DNNL_PERF_COUNTERS_SUPPORTED 1
+#else
+#define DNNL_PERF_COUNTERS_SUPPORTED 0
+#endif
+
+#include "common/dnnl_thread.hpp"
+#include "common/engine.hpp"
+#include "common/perf_counters.hpp"
+#include "common/verbose.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace perf_counters {
+
+namespace {
+
+#if DNNL_PERF_COUNTERS_SUPPORTED
+enum { cycles_idx = 0, instructions_idx, llc_misses_idx, n_events };
+
+// Counters of a single thread opened as one perf_event group, so that all
+// the events are scheduled on the PMU together and read with one syscall.
+struct group_t {
+    group_t() {
+        static const uint64_t configs[n_events] = {PERF_COUNT_HW_CPU_CYCLES,
+                PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+        for (int i = 0; i < n_events; i++) {
+            struct perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            // Counting user space only keeps the counters available under
+            // the default perf_event_paranoid setting.
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            const int group_fd = i == 0 ? -1 : fd_[0];
+            fd_[i] = (int)syscall(SYS_perf_event_open, &attr, 0 /* thread */,
+                    -1 /* cpu */, group_fd, PERF_FLAG_FD_CLOEXEC);
+            if (fd_[i] < 0) {
+                close_all();
+                return;
+            }
+        }
+    }
+
+    ~group_t() { close_all(); }
+
+    bool is_open() const { return fd_[0] >= 0; }
+
+    bool read(values_t &v) const {
+        uint64_t buf[1 + n_events];
+        if (::read(fd_[0], buf, sizeof(buf)) != (ssize_t)sizeof(buf)
+                || buf[0] != n_events)
+            return false;
+        v.cycles = buf[1 + cycles_idx];
+        v.instructions = buf[1 + instructions_idx];
+        v.llc_misses = buf[1 + llc_misses_idx];
+        return true;
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(group_t);
+
+private:
+    void close_all() {
+        for (int i = n_events - 1; i >= 0; i--) {
+            if (fd_[i] >= 0) close(fd_[i]);
+            fd_[i] = -1;
+        }
+    }
+
+    int fd_[n_events] = {-1, -1, -1};
+};
+
+// Groups of all the threads that ever executed a sampled primitive. A perf
+// event file can be read from any thread, so the values of all the groups are
+// collected by the thread that executes the primitive.
+struct registry_t {
+    void add(uint64_t id, const group_t *g) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        groups_[id] = g;
+    }
+
+    void remove(uint64_t id) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        groups_.erase(id);
+    }
+
+    void read(std::unordered_map<uint64_t, values_t> &res) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        res.reserve(groups_.size());
+        for (const auto &e : groups_) {
+            values_t v;
+            if (e.second->read(v)) res[e.first] = v;
+        }
+    }
+
+private:
+    std::mutex mutex_;
+    std::unordered_map<uint64_t, const group_t *> groups_;
+};
+
+registry_t &registry() {
+    // Thread-local groups unregister themselves on thread exit, which may
+    // happen during the library unloading, so the registry is never
+    // destroyed.
+    static registry_t *r = new registry_t();
+    return *r;
+}
+
+std::atomic<bool> &is_unavailable() {
+    static std::atomic<bool> flag {false};
+    return flag;
+}
+
+struct thread_group_t {
+    thread_group_t() : id_(next_id()) {
+        if (group_.is_open())
+            registry().add(id_, &group_);
+        else if (!is_unavailable().exchange(true))
+            VWARN(common, common,
+                    "perf_event counters are unavailable, check "
+                    "/proc/sys/kernel/perf_event_paranoid");
+    }
+
+    ~thread_group_t() {
+        if (group_.is_open()) registry().remove(id_);
+    }
+
+private:
+    static uint64_t next_id() {
+        static std::atomic<uint64_t> id {0};
+        return id++;
+    }
+
+    uint64_t id_;
+    group_t group_;
+};
+
+// Opens the counters of the calling thread on first use.
+void init_thread_group() {
+    thread_local thread_group_t g;
+    MAYBE_UNUSED(g);
+}
+
+// Number of samplers running and number of samplers started so far, used to
+// detect executions sampled at the same time.
+std::atomic<int> &n_running() {
+    static std::atomic<int> n {0};
+    return n;
+}
+
+std::atomic<uint64_t> &n_started() {
+    static std::atomic<uint64_t> n {0};
+    return n;
+}
+#endif
+
+} // namespace
+
+std::string values_t::str(double duration_ms) const {
+    const double gbs = duration_ms > 0 ? 1e-6 * bytes() / duration_ms : 0.;
+    ostringstream_t oss;
+    oss << "perf:cycles:" << cycles << " instructions:" << instructions
+        << " llc_misses:" << llc_misses << " bandwidth:" << gbs << "GB/s";
+    return oss.str();
+}
+
+bool is_enabled(const engine_t *engine) {
+#if DNNL_PERF_COUNTERS_SUPPORTED
+    static const bool enabled = getenv_int_user("PERF_COUNTERS", 1) != 0;
+    return enabled && engine->kind() == engine_kind::cpu
+            && !is_unavailable().load(std::memory_order_relaxed);
+#else
+    MAYBE_UNUSED(engine);
+    return false;
+#endif
+}
+
+sampler_t::sampler_t(bool active) : active_(active) {
+#if DNNL_PERF_COUNTERS_SUPPORTED
+    if (!active_) return;
+    // Threads of the runtime open their counters lazily. The check is cheap
+    // once all of them are initialized but still needs a parallel region,
+    // since the pool may have grown since the previous sample.
+    parallel(0, [](int, int) { init_thread_group(); });
+    // An execution running when this one starts, or starting before it
+    // stops, is counted by the same threads.
+    overlapped_ = n_running().fetch_add(1) > 0;
+    id_ = n_started().fetch_add(1) + 1;
+    registry().read(start_);
+#endif
+}
+
+bool sampler_t::stop(values_t &res) {
+#if DNNL_PERF_COUNTERS_SUPPORTED
+    if (!active_) return false;
+    std::unordered_map<uint64_t, values_t> end;
+    registry().read(end);
+    overlapped_ = overlapped_ || n_started().load() != id_;
+    n_running().fetch_sub(1);
+    if (overlapped_) {
+        static std::atomic<bool> warned {false};
+        if (!warned.exchange(true))
+            VWARN(common, common,
+                    "perf_event counters of overlapping executions are "
+                    "discarded");
+        return false;
+    }
+
+    values_t v;
+    // Threads that appeared or exited during the execution are skipped.
+    for (const auto &e : end) {
+        const auto it = start_.find(e.first);
+        if (it == start_.end()) continue;
+        v.cycles += e.second.cycles - it->second.cycles;
+        v.instructions += e.second.instructions - it->second.instructions;
+        v.llc_misses += e.second.llc_misses - it->second.llc_misses;
+    }
+    res = v;
+    return true;
+#else
+    MAYBE_UNUSED(res);
+    return false;
+#endif
+}
+
+} // namespace perf_counters
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_PERF_COUNTERS_HPP
+#define COMMON_PERF_COUNTERS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Hardware performance counters sampled around primitive executions.
+//
+// The counters are read with Linux perf_event and are only available when the
+// library is built with ONEDNN_ENABLE_PERF_COUNTERS=ON. The collection can be
+// disabled at run time with ONEDNN_PERF_COUNTERS=0.
+//
+// Each thread of the CPU threading runtime counts its own events in user
+// space. A sample covers all the threads of the process that opened the
+// counters, so it can only be attributed to an execution when no other one
+// runs at the same time. Samples of overlapping executions, e.g. from several
+// application threads or streams, are discarded.
+namespace perf_counters {
+
+// Memory traffic is estimated from last level cache misses, each one
+// transferring a cache line.
+constexpr uint64_t bytes_per_miss = 64;
+
+struct values_t {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llc_misses = 0;
+
+    uint64_t bytes() const { return llc_misses * bytes_per_miss; }
+
+    // Returns the counters as a verbose field, e.g.
+    // `perf:cycles:100 instructions:200 llc_misses:3 bandwidth:0.19GB/s`.
+    std::string str(double duration_ms) const;
+};
+
+// Returns true if counters can be collected for primitives of `engine`.
+bool is_enabled(const engine_t *engine);
+
+// Collects the values of the counters between construction and `stop()`.
+// An inactive sampler doesn't touch the counters.
+struct sampler_t {
+    sampler_t(bool active);
+
+    // Returns false if the sampler is inactive or if another execution was
+    // sampled at the same time, `res` is left unchanged then.
+    bool stop(values_t &res);
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(sampler_t);
+
+private:
+    bool active_;
+    bool overlapped_ = false;
+    uint64_t id_ = 0;
+    std::unordered_map<uint64_t, values_t> start_;
+};
+
+// Counters accumulated over executions of a primitive.
+struct accumulator_t {
+    void add(const values_t &v) {
+        cycles_ += v.cycles;
+        instructions_ += v.instructions;
+        llc_misses_ += v.llc_misses;
+        executions_++;
+    }
+
+    void get(perf_counters_t &res) const {
+        res.cycles = cycles_;
+        res.instructions = instructions_;
+        res.llc_misses = llc_misses_;
+        res.bytes = llc_misses_ * bytes_per_miss;
+        res.executions = executions_;
+    }
+
+private:
+    std::atomic<uint64_t> cycles_ {0};
+    std::atomic<uint64_t> instructions_ {0};
+    std::atomic<uint64_t> llc_misses_ {0};
+    std::atomic<uint64_t> executions_ {0};
+};
+
+} // namespace perf_counters
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
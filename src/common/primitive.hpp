@@ -25,6 +25,7 @@
 #include "c_types_map.hpp"
 #include "cache_blob.hpp"
 #include "cache_hit_types.hpp"
+#include "jit_cache.hpp"
 #include "memory_storage.hpp"
 #include "memory_tracking.hpp"
 #include "primitive_desc.hpp"
@@ -111,6 +112,7 @@ protected:
         primitive_cache_iface_t::create_func_ptr_t create = [](void *context) {
             auto &c = *static_cast<create_context_t *>(context);
             std::shared_ptr<primitive_t> p = std::make_shared<impl_type>(c.pd);
+            jit_cache::scope_t jit_cache_scope(c.engine, c.pd);
             status_t status
                     = p->init(c.engine, c.use_global_scratchpad, c.cache_blob);
             c.cache_status = p->creation_cache_state();
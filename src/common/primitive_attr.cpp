@@ -105,6 +105,7 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::zero_points_data_type),
             zero_points_.has_default_data_type()));
     CHECK_MASK(smask_t::precomputed_reductions, precomputed_reductions_);
+    CHECK_MASK(smask_t::dynamic_quantization, dynamic_quantization_);
     CHECK_MASK(smask_t::post_ops, post_ops_);
     CHECK_MASK(smask_t::rnn_data_qparams, rnn_data_qparams_);
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
@@ -550,6 +551,20 @@ status_t dnnl_primitive_attr_set_deterministic(primitive_attr_t *attr, int d) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_weights_replication(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+    *value = attr->weights_replication_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_weights_replication(
+        primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    attr->weights_replication_ = value;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -667,6 +682,20 @@ status_t dnnl_primitive_attr_set_precomputed_reductions(
             arg, mask, data_type, group_ndims, group_dims);
 }
 
+status_t dnnl_primitive_attr_set_dynamic_quantization(
+        dnnl_primitive_attr_t attr, int arg, int mask,
+        dnnl_data_type_t data_type) {
+    using namespace data_type;
+    VCHECK_ATTR(attr, VERBOSE_NULL_ARG);
+    VCHECK_ATTR(mask >= 0, VERBOSE_BAD_PARAM, "mask");
+    VCHECK_ATTR(arg == DNNL_ARG_SRC, VERBOSE_BAD_PARAM, "arg");
+    // Symmetric quantization only, so far.
+    VCHECK_ATTR(data_type == s8, VERBOSE_INVALID_DATATYPE,
+            "dynamic quantization");
+
+    return attr->dynamic_quantization_.set(arg, mask, data_type, 0, {});
+}
+
 status_t dnnl_primitive_attr_get_rounding(
         primitive_attr_t *attr, int arg, dnnl_rounding_mode_t *mode) {
     if (any_null(attr, mode)) return invalid_arguments;
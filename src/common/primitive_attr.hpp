@@ -535,7 +535,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
         , fpmath_(dnnl::impl::get_fpmath_mode(), false)
         , acc_mode_(dnnl::impl::accumulation_mode::strict)
-        , deterministic_(false) {}
+        , deterministic_(false)
+        , weights_replication_(false) {}
 
     ~dnnl_primitive_attr() = default;
 
@@ -555,11 +556,13 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         scales_ = other.scales_;
         zero_points_ = other.zero_points_;
         precomputed_reductions_ = other.precomputed_reductions_;
+        dynamic_quantization_ = other.dynamic_quantization_;
         rounding_mode_ = other.rounding_mode_;
         scratchpad_mode_ = other.scratchpad_mode_;
         fpmath_ = other.fpmath_;
         acc_mode_ = other.acc_mode_;
         deterministic_ = other.deterministic_;
+        weights_replication_ = other.weights_replication_;
         post_ops_ = other.post_ops_;
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -594,6 +597,7 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         dropout = 1u << 16,
         rounding_mode = 1u << 17,
         precomputed_reductions = 1u << 18,
+        dynamic_quantization = 1u << 19,
     };
 
     /** Returns true if the attributes have default values.
@@ -609,8 +613,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_ == rhs.fpmath_ && acc_mode_ == rhs.acc_mode_
                 && deterministic_ == rhs.deterministic_
+                && weights_replication_ == rhs.weights_replication_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && precomputed_reductions_ == rhs.precomputed_reductions_
+                && dynamic_quantization_ == rhs.dynamic_quantization_
                 && post_ops_ == rhs.post_ops_
                 && rnn_data_qparams_ == rhs.rnn_data_qparams_
                 && rnn_weights_qparams_ == rhs.rnn_weights_qparams_
@@ -687,10 +693,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::scales_t scales_;
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::precomputed_reductions_t precomputed_reductions_;
+    dnnl::impl::dynamic_quantization_t dynamic_quantization_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
     dnnl::impl::fpmath_t fpmath_;
     dnnl::impl::accumulation_mode_t acc_mode_;
     bool deterministic_;
+    bool weights_replication_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::rnn_create_time_scales_t rnn_weights_qparams_;
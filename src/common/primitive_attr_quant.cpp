@@ -135,5 +135,9 @@ precomputed_reductions_t precomputed_reductions_t::deserialize(
     return deserialize_entries<precomputed_reductions_t>(d);
 }
 
+dynamic_quantization_t dynamic_quantization_t::deserialize(deserializer_t &d) {
+    return deserialize_entries<dynamic_quantization_t>(d);
+}
+
 } // namespace impl
 } // namespace dnnl
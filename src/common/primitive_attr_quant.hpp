@@ -407,6 +407,24 @@ private:
     }
 };
 
+// Arguments quantized by the primitive itself. The mask of an entry defines
+// the dimensions along which dedicated scales are computed, each scale being
+// derived from the absolute maximum of the values it covers. The data type of
+// an entry is the type the argument is quantized to.
+struct dynamic_quantization_t : public quant_entries_t {
+    dynamic_quantization_t() : quant_entries_t(default_data_type_) {};
+
+    static dynamic_quantization_t deserialize(deserializer_t &d);
+
+private:
+    static constexpr data_type_t default_data_type_ = data_type::s8;
+
+    bool check_arg(int arg) const override {
+        // So far, only SRC can be quantized dynamically.
+        return arg == DNNL_ARG_SRC;
+    }
+};
+
 } // namespace impl
 } // namespace dnnl
 
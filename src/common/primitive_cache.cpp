@@ -41,6 +41,7 @@ struct primitive_cache_t {
     }
     int get_capacity() const { return cache_.get_capacity(); }
     int get_size() const { return cache_.get_size(); }
+    cache_stats_t get_stats() const { return cache_.get_stats(); }
 
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
         result_t result = cache_.get(key);
@@ -122,6 +123,10 @@ int primitive_cache_iface_t::get_size() const {
     return cache_.get_size();
 }
 
+cache_stats_t primitive_cache_iface_t::get_stats() const {
+    return cache_.get_stats();
+}
+
 std::shared_ptr<primitive_desc_t> primitive_cache_iface_t::get_pd(
         const key_t &key) {
     return cache_.get_pd(key);
@@ -165,3 +170,20 @@ dnnl::impl::status_t dnnl_get_primitive_cache_capacity(int *capacity) {
 dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     return dnnl::impl::set_primitive_cache_capacity(capacity, capacity);
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl_primitive_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl_primitive_cache_stats_t();
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    const auto s = dnnl::impl::global_primitive_cache().get_stats();
+    stats->hits = s.hits;
+    stats->misses = s.misses;
+    stats->evictions = s.evictions;
+    const auto ks = dnnl::impl::kernel_cache::get().get_stats();
+    stats->kernel_hits = ks.hits;
+    stats->kernel_misses = ks.misses;
+    stats->kernel_evictions = ks.evictions;
+#endif
+    return dnnl::impl::status::success;
+}
@@ -18,6 +18,7 @@
 #define COMMON_PRIMITIVE_CACHE_HPP
 
 #include "c_types_map.hpp"
+#include "cache_hit_types.hpp"
 #include "oneapi/dnnl/dnnl.h"
 #include "primitive_hashing.hpp"
 #include "type_helpers.hpp"
@@ -49,6 +50,7 @@ struct primitive_cache_iface_t {
     status_t set_capacity(int capacity);
     int get_capacity() const;
     int get_size() const;
+    cache_stats_t get_stats() const;
 
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key);
     result_t get_or_create(const key_t &key, create_func_t create,
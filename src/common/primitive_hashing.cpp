@@ -182,6 +182,9 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            if (md.format_desc.sparse_desc.encoding == sparse_encoding::bsr)
+                seed = get_array_hash(
+                        seed, md.format_desc.sparse_desc.block_dims, 2);
             // User cannot initialize `packed_desc` therefore `packed_desc`
             // is always zero initialized.
             break;
@@ -228,6 +231,8 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_.apply_to_int_));
     // deterministic
     seed = hash_combine(seed, static_cast<size_t>(attr.deterministic_));
+    // weights_replication
+    seed = hash_combine(seed, static_cast<size_t>(attr.weights_replication_));
     // acc_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.acc_mode_));
     // rounding_mode
@@ -250,6 +255,10 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = hash_combine(seed, attr.precomputed_reductions_.get_hash());
     }
 
+    if (!attr.dynamic_quantization_.has_default_values()) {
+        seed = hash_combine(seed, attr.dynamic_quantization_.get_hash());
+    }
+
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
@@ -542,6 +551,8 @@ size_t get_desc_hash(const matmul_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.reduce_desc));
     // Reduce kind.
     seed = hash_combine(seed, static_cast<size_t>(desc.reduce_kind));
+    // Group offsets
+    seed = hash_combine(seed, get_md_hash(desc.group_offsets_desc));
     // Accumulator type
     seed = hash_combine(seed, static_cast<size_t>(desc.accum_data_type));
     // Combined hash for matmul op desc
@@ -746,6 +757,8 @@ size_t get_desc_hash(const sdpa_desc_t &desc) {
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
     seed = hash_combine(seed, get_md_hash(desc.scale_desc));
+    seed = hash_combine(seed, get_md_hash(desc.kv_block_table_desc));
+    seed = hash_combine(seed, desc.kv_seq_len);
     // Scale type
     seed = hash_combine(seed, static_cast<size_t>(desc.kq_acc_dt));
     seed = hash_combine(seed, static_cast<size_t>(desc.vs_acc_dt));
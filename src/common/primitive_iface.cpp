@@ -24,6 +24,7 @@
 #endif
 
 #include "cache_hit_types.hpp"
+#include "perf_counters.hpp"
 #include "primitive.hpp"
 #include "primitive_desc_iface.hpp"
 #include "primitive_exec_types.hpp"
@@ -98,14 +99,28 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
-    if (get_verbose(verbose_t::exec_profile,
-                prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()))) {
+    const bool with_profile = get_verbose(verbose_t::exec_profile,
+            prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()));
+    const bool with_counters
+            = perf_counters::is_enabled(primitive_iface->engine());
+
+    if (with_profile || with_counters) {
         stream->wait();
+        perf_counters::sampler_t sampler(with_counters);
         double start_ms = get_msec();
         status = stream->enqueue_primitive(primitive_iface, ctx);
         stream->wait();
         double duration_ms = get_msec() - start_ms;
-        if (primitive_iface->pd()->impl()->has_runtime_dims_or_strides()) {
+        perf_counters::values_t counters;
+        const bool with_sample = sampler.stop(counters);
+        if (with_sample) primitive_iface->add_perf_counters(counters);
+
+        // Counters are reported as an extra field after the execution time.
+        const std::string counters_str = with_profile && with_sample
+                ? "," + counters.str(duration_ms)
+                : "";
+        const auto *pd = primitive_iface->pd()->impl().get();
+        if (with_profile && pd->has_runtime_dims_or_strides()) {
             // Take out mds from `ctx` here to avoid primitive_desc dependency
             // on `exec_ctx_t` type.
             // TODO: invariant arg names for training?
@@ -124,11 +139,13 @@ status_t primitive_execute(
 
             std::string info = primitive_iface->pd()->info_with_runtime_dims(
                     src_md, wei_md, bia_md, dst_md);
-            VPROF(start_ms, primitive, exec, VERBOSE_profile, info.c_str(),
-                    duration_ms);
-        } else {
-            VPROF(start_ms, primitive, exec, VERBOSE_profile,
-                    primitive_iface->pd()->info(), duration_ms);
+            VFORMAT(start_ms, verbose_t::exec_profile, primitive, exec,
+                    VERBOSE_profile, "%s,%g%s", info.c_str(), duration_ms,
+                    counters_str.c_str());
+        } else if (with_profile) {
+            VFORMAT(start_ms, verbose_t::exec_profile, primitive, exec,
+                    VERBOSE_profile, "%s,%g%s", primitive_iface->pd()->info(),
+                    duration_ms, counters_str.c_str());
         }
     } else {
         status = stream->enqueue_primitive(primitive_iface, ctx);
@@ -252,6 +269,20 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
     return primitive_iface->get_cache_blob(cb);
 }
 
+status_t dnnl_primitive_get_perf_counters(
+        const primitive_iface_t *primitive_iface, perf_counters_t *counters) {
+    if (utils::any_null(primitive_iface, counters))
+        return status::invalid_arguments;
+#ifdef DNNL_ENABLE_PERF_COUNTERS
+    if (primitive_iface->engine()->kind() != engine_kind::cpu)
+        return status::unimplemented;
+    primitive_iface->get_perf_counters(*counters);
+    return status::success;
+#else
+    return status::unimplemented;
+#endif
+}
+
 status_t dnnl_primitive_destroy(primitive_iface_t *primitive_iface) {
     if (primitive_iface != nullptr) primitive_iface->release();
     return success;
@@ -296,17 +327,15 @@ status_t dnnl_primitive::init() {
         auto *scratchpad_ptr = create_scratchpad(
                 pd_->engine(), scratchpad_size, use_global_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
-        if (scratchpad_ptr->get_memory_storage() == nullptr) {
-            delete scratchpad_ptr;
-            return out_of_memory;
-        }
+        // A scratchpad failing to allocate its memory reports zero size.
+        // Arena scratchpads have no memory until an execution.
+        scratchpad_.reset(scratchpad_ptr);
+        if (scratchpad_ptr->size() < scratchpad_size) return out_of_memory;
 
         if (scratchpad_debug::is_protect_scratchpad()) {
             scratchpad_debug::protect_scratchpad_buffer(
                     scratchpad_ptr->get_memory_storage(), registry);
         }
-        scratchpad_.reset(scratchpad_ptr);
-        if (scratchpad_ptr->size() < scratchpad_size) return out_of_memory;
     }
     return primitive_->create_resource(pd()->engine(), resource_mapper_);
 }
@@ -326,7 +355,8 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
     } else if (scratchpad_) {
-        mem_storage = scratchpad_->get_memory_storage();
+        mem_storage = scratchpad_->acquire(ctx.stream());
+        if (mem_storage == nullptr) return out_of_memory;
     }
 
     auto scratchpad_grantor
@@ -336,6 +366,10 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
 
     auto status = primitive_->execute(ctx);
     ctx.set_scratchpad_grantor(nullptr);
+    if (scratchpad_
+            && primitive_->pd()->attr()->scratchpad_mode_
+                    == scratchpad_mode::library)
+        scratchpad_->release(mem_storage, ctx.stream());
     return status;
 }
 
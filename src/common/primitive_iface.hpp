@@ -23,6 +23,7 @@
 
 #include "c_types_map.hpp"
 #include "cache_blob.hpp"
+#include "perf_counters.hpp"
 #include "primitive_exec_types.hpp"
 #include "resource.hpp"
 #include "scratchpad.hpp"
@@ -66,6 +67,14 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
 
+    void add_perf_counters(
+            const dnnl::impl::perf_counters::values_t &values) const {
+        perf_counters_.add(values);
+    }
+    void get_perf_counters(dnnl::impl::perf_counters_t &counters) const {
+        perf_counters_.get(counters);
+    }
+
     void retain() { counter_++; }
 
     void release() {
@@ -81,6 +90,7 @@ private:
     std::unique_ptr<dnnl::impl::scratchpad_t> scratchpad_;
     std::unique_ptr<primitive_desc_iface_t> pd_;
     dnnl::impl::resource_mapper_t resource_mapper_;
+    mutable dnnl::impl::perf_counters::accumulator_t perf_counters_;
 
     dnnl_primitive() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
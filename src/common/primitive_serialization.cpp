@@ -184,6 +184,8 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
     sstream.append(attr.fpmath_.apply_to_int_);
     // deterministic
     sstream.append(attr.deterministic_);
+    // weights_replication
+    sstream.append(attr.weights_replication_);
     // acc_mode
     sstream.append(attr.acc_mode_);
 
@@ -202,6 +204,11 @@ void serialize(serialization_stream_t &sstream, const primitive_attr_t &attr) {
         attr.precomputed_reductions_.serialize(sstream);
     }
 
+    if (!attr.dynamic_quantization_.has_default_values()) {
+        sstream.append('q');
+        attr.dynamic_quantization_.serialize(sstream);
+    }
+
     // Rounding modes
     if (!attr.rounding_mode_.has_default_values()) sstream.append('r');
     for (const auto &e : attr.rounding_mode_.rounding_modes_map_) {
@@ -423,6 +430,7 @@ void serialize(serialization_stream_t &sstream, const matmul_desc_t &desc) {
     serialize(sstream, desc.weights_desc);
     serialize(sstream, desc.bias_desc);
     serialize(sstream, desc.dst_desc);
+    serialize(sstream, desc.group_offsets_desc);
     // Accumulator type
     sstream.append(desc.accum_data_type);
 }
@@ -590,6 +598,8 @@ void serialize(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
     serialize(sstream, desc.dst_desc);
     serialize(sstream, desc.attn_mask_desc);
     serialize(sstream, desc.scale_desc);
+    serialize(sstream, desc.kv_block_table_desc);
+    sstream.append(desc.kv_seq_len);
     sstream.append(desc.kq_acc_dt);
     sstream.append(desc.vs_acc_dt);
     sstream.append(desc.invert_scale);
@@ -14,9 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
 
 #include "engine.hpp"
+#include "stream.hpp"
 #include "utils.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
@@ -138,11 +146,238 @@ thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
+namespace scratchpad_arena {
+namespace {
+
+std::atomic<bool> &enabled_flag() {
+    static std::atomic<bool> flag {getenv_int_user("SCRATCHPAD_ARENA", 0) > 0};
+    return flag;
+}
+
+// Buffers are allocated in size classes with four classes per power of two,
+// which bounds the waste by 25% while letting buffers of close sizes be
+// reused by each other.
+size_t get_size_class(size_t size) {
+    constexpr size_t min_size = 4096;
+    if (size <= min_size) return min_size;
+    size_t pow2 = min_size;
+    while (pow2 * 2 <= size)
+        pow2 *= 2;
+    const size_t step = pow2 / 4;
+    return utils::rnd_up(size, step);
+}
+
+struct arena_t {
+    memory_storage_t *acquire(size_t size) {
+        const size_t size_class = get_size_class(size);
+        std::unique_lock<std::mutex> lock(mutex_);
+        stats_.acquisitions++;
+
+        // An idle buffer up to twice as large is taken rather than
+        // allocating a new one.
+        memory_storage_t *mem_storage = nullptr;
+        size_t buffer_size = size_class;
+        auto it = idle_.lower_bound(size_class);
+        if (it != idle_.end() && it->first <= 2 * size_class) {
+            buffer_size = it->first;
+            mem_storage = it->second.back();
+            it->second.pop_back();
+            if (it->second.empty()) idle_.erase(it);
+            stats_.idle_size -= buffer_size;
+        } else {
+            // Idle buffers of other classes are freed first if they would
+            // push the arena beyond its recent peak.
+            trim_no_lock(stats_.peak_size > stats_.used_size + size_class
+                            ? stats_.peak_size - stats_.used_size - size_class
+                            : 0);
+            lock.unlock();
+            mem_storage = create_storage(size_class);
+            lock.lock();
+            if (!mem_storage) return nullptr;
+            stats_.allocations++;
+        }
+
+        in_use_[mem_storage] = buffer_size;
+        stats_.used_size += buffer_size;
+        window_peak_ = nstl::max(window_peak_, stats_.used_size);
+        stats_.peak_size = nstl::max(
+                stats_.peak_size, stats_.used_size + stats_.idle_size);
+        return mem_storage;
+    }
+
+    void release(memory_storage_t *mem_storage) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = in_use_.find(mem_storage);
+        assert(it != in_use_.end());
+        const size_t buffer_size = it->second;
+        in_use_.erase(it);
+        stats_.used_size -= buffer_size;
+        stats_.idle_size += buffer_size;
+        idle_[buffer_size].push_back(mem_storage);
+
+        // High-water-mark trimming: every `window_size` releases the buffers
+        // are trimmed to the peak usage observed during the window, so the
+        // memory of a past burst doesn't stay reserved forever.
+        size_t target = idle_limit_;
+        if (++window_count_ == window_size) {
+            const size_t window_idle = window_peak_ > stats_.used_size
+                    ? window_peak_ - stats_.used_size
+                    : 0;
+            target = nstl::min(target, window_idle);
+            window_count_ = 0;
+            window_peak_ = stats_.used_size;
+        }
+        trim_no_lock(target);
+    }
+
+    void set_idle_limit(size_t size) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        idle_limit_ = size;
+        trim_no_lock(idle_limit_);
+    }
+
+    void trim() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        trim_no_lock(0);
+    }
+
+    scratchpad_arena_stats_t get_stats() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return stats_;
+    }
+
+private:
+    static constexpr int window_size = 256;
+
+    static memory_storage_t *create_storage(size_t size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        // Buffers are not bound to engines of the primitives, so that they
+        // can be shared between them and outlive them.
+        return create_scratchpad_memory_storage(
+                cpu::get_service_engine(), size);
+#else
+        MAYBE_UNUSED(size);
+        return nullptr;
+#endif
+    }
+
+    // Frees the largest idle buffers until the idle size doesn't exceed
+    // `idle_size`.
+    void trim_no_lock(size_t idle_size) {
+        while (stats_.idle_size > idle_size) {
+            auto it = std::prev(idle_.end());
+            delete it->second.back();
+            it->second.pop_back();
+            stats_.idle_size -= it->first;
+            stats_.trims++;
+            if (it->second.empty()) idle_.erase(it);
+        }
+    }
+
+    std::mutex mutex_;
+    std::map<size_t, std::vector<memory_storage_t *>> idle_;
+    std::unordered_map<const memory_storage_t *, size_t> in_use_;
+    scratchpad_arena_stats_t stats_ = {};
+    size_t idle_limit_ = SIZE_MAX;
+    size_t window_peak_ = 0;
+    int window_count_ = 0;
+};
+
+arena_t &arena() {
+    // Scratchpads may be released by primitives destroyed at exit after the
+    // static objects, so the arena is never destroyed.
+    static arena_t *a = new arena_t();
+    return *a;
+}
+
+} // namespace
+
+bool is_enabled() {
+    return enabled_flag().load(std::memory_order_relaxed);
+}
+
+void set_enabled(bool enable) {
+    enabled_flag().store(enable);
+}
+
+void set_idle_limit(size_t size) {
+    arena().set_idle_limit(size);
+}
+
+void trim() {
+    arena().trim();
+}
+
+scratchpad_arena_stats_t get_stats() {
+    return arena().get_stats();
+}
+
+} // namespace scratchpad_arena
+
+/*
+  Implementation of the scratchpad_t interface that takes the memory from the
+  scratchpad arena for the duration of each execution
+*/
+struct arena_scratchpad_t : public scratchpad_t {
+    arena_scratchpad_t(size_t size) : size_(size) {}
+
+    ~arena_scratchpad_t() override { delete own_storage_.load(); }
+
+    const memory_storage_t *get_memory_storage() const override {
+        return nullptr;
+    }
+
+    size_t size() const override { return size_; }
+
+    const memory_storage_t *acquire(stream_t *stream) const override {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        // The execution on an asynchronous stream may still be running when
+        // the memory is released, the scratchpad keeps its own buffer then.
+        dnnl::threadpool_interop::threadpool_iface *tp = nullptr;
+        if (stream->get_threadpool(&tp) == status::success && tp
+                && (tp->get_flags()
+                        & dnnl::threadpool_interop::threadpool_iface::
+                                ASYNCHRONOUS)) {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (!own_storage_.load())
+                own_storage_.store(create_scratchpad_memory_storage(
+                        cpu::get_service_engine(), size_));
+            return own_storage_.load();
+        }
+#else
+        MAYBE_UNUSED(stream);
+#endif
+        return scratchpad_arena::arena().acquire(size_);
+    }
+
+    void release(const memory_storage_t *mem_storage,
+            stream_t *stream) const override {
+        MAYBE_UNUSED(stream);
+        if (!mem_storage || mem_storage == own_storage_.load()) return;
+        // Executions on synchronous streams are completed once submitted.
+        scratchpad_arena::arena().release(
+                const_cast<memory_storage_t *>(mem_storage));
+    }
+
+private:
+    size_t size_;
+    mutable std::mutex mutex_;
+    mutable std::atomic<memory_storage_t *> own_storage_ {nullptr};
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(arena_scratchpad_t);
+};
+
 /*
    Scratchpad creation routine
 */
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (use_global_scratchpad && scratchpad_arena::is_enabled()
+            && engine->kind() == engine_kind::cpu
+            && is_native_runtime(engine->runtime_kind()))
+        return new arena_scratchpad_t(size);
+#endif
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
@@ -161,3 +396,33 @@ scratchpad_t *create_scratchpad(
 
 } // namespace impl
 } // namespace dnnl
+
+// API
+dnnl_status_t dnnl_set_scratchpad_arena(int enable) {
+    if (enable != 0 && enable != 1) return dnnl_invalid_arguments;
+    dnnl::impl::scratchpad_arena::set_enabled(enable);
+    return dnnl_success;
+}
+
+dnnl_status_t dnnl_get_scratchpad_arena(int *enable) {
+    if (enable == nullptr) return dnnl_invalid_arguments;
+    *enable = dnnl::impl::scratchpad_arena::is_enabled();
+    return dnnl_success;
+}
+
+dnnl_status_t dnnl_set_scratchpad_arena_idle_limit(size_t size) {
+    dnnl::impl::scratchpad_arena::set_idle_limit(size);
+    return dnnl_success;
+}
+
+dnnl_status_t dnnl_trim_scratchpad_arena() {
+    dnnl::impl::scratchpad_arena::trim();
+    return dnnl_success;
+}
+
+dnnl_status_t dnnl_get_scratchpad_arena_stats(
+        dnnl_scratchpad_arena_stats_t *stats) {
+    if (stats == nullptr) return dnnl_invalid_arguments;
+    *stats = dnnl::impl::scratchpad_arena::get_stats();
+    return dnnl_success;
+}
@@ -28,11 +28,38 @@ struct scratchpad_t {
     virtual ~scratchpad_t() = default;
     virtual const memory_storage_t *get_memory_storage() const = 0;
     virtual size_t size() const = 0;
+
+    // Returns the memory for a single execution on `stream`, nullptr if it
+    // can't be allocated. Scratchpads owning their memory return the same
+    // storage for all executions.
+    virtual const memory_storage_t *acquire(stream_t *stream) const {
+        UNUSED(stream);
+        return get_memory_storage();
+    }
+    // Takes back the memory returned by acquire() once the execution has been
+    // submitted to `stream`.
+    virtual void release(
+            const memory_storage_t *mem_storage, stream_t *stream) const {
+        UNUSED(mem_storage);
+        UNUSED(stream);
+    }
 };
 
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Pool of scratchpad buffers shared by all the CPU primitives with library
+// managed scratchpads, see dnnl_set_scratchpad_arena().
+namespace scratchpad_arena {
+
+bool is_enabled();
+void set_enabled(bool enable);
+void set_idle_limit(size_t size);
+void trim();
+scratchpad_arena_stats_t get_stats();
+
+} // namespace scratchpad_arena
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -32,6 +32,7 @@ namespace impl {
 #define DNNL_ARG_KEYS DNNL_ARG_SRC_1
 #define DNNL_ARG_VALUES DNNL_ARG_SRC_2
 #define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_KV_BLOCK_TABLE DNNL_ARG_SRC_3
 
 // NOLINTBEGIN(modernize-use-using)
 /// Types of attention mask
@@ -80,6 +81,12 @@ struct sdpa_desc_t : public op_desc_t {
     memory_desc_t dst_desc;
     memory_desc_t attn_mask_desc;
     memory_desc_t scale_desc;
+    // Paged K/V cache. When the block table is set, k_desc and v_desc describe
+    // a pool of pages with `page_size` keys each: [pages, heads, D, page_size]
+    // and [pages, heads, page_size, V]. The s32 [batch, max_pages] block table
+    // maps logical key blocks of every batch entry to pages of the pool.
+    memory_desc_t kv_block_table_desc;
+    dim_t kv_seq_len {}; /* number of keys for paged K/V cache */
     data_type_t kq_acc_dt {};
     data_type_t vs_acc_dt {};
     // invert_scale = false: multiply by scale
@@ -95,7 +102,13 @@ struct sdpa_desc_t : public op_desc_t {
     // Head size.
     dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
     // Number of keys.
-    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    dnnl_dim_t keys() const {
+        return with_paged_kv() ? kv_seq_len : k_desc.dims[k_desc.ndims - 1];
+    }
+    // If true, K and V are read through the block table.
+    bool with_paged_kv() const { return kv_block_table_desc.ndims != 0; }
+    // Number of keys in a single page of the paged K/V cache.
+    dnnl_dim_t kv_page_size() const { return k_desc.dims[k_desc.ndims - 1]; }
     // Number of values.
     dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
     // Total batch size.
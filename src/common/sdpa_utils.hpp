@@ -81,6 +81,33 @@ static inline status_t sdpa_desc_check(const memory_desc_t *q_desc,
     return status::success;
 }
 
+static inline status_t sdpa_paged_kv_check(const memory_desc_t *q_desc,
+        const memory_desc_t *k_desc, const memory_desc_t *v_desc,
+        const memory_desc_t *kv_block_table_md, dim_t kv_seq_len) {
+    if (kv_block_table_md == nullptr || kv_block_table_md->ndims == 0)
+        return status::success;
+
+    const int ndims = k_desc->ndims;
+    const dim_t page_size = k_desc->dims[ndims - 1];
+    VCHECK_SDPA_COND(kv_block_table_md->ndims == 2,
+            "block table must be 2D, got %d dimensions",
+            kv_block_table_md->ndims);
+    VCHECK_SDPA_COND(kv_block_table_md->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "block table");
+    VCHECK_SDPA_COND(kv_block_table_md->dims[0] == q_desc->dims[0],
+            "block_table->dims[0](%s) must match q_desc->dims[0](%s)",
+            md2dim_str(kv_block_table_md).c_str(), md2dim_str(q_desc).c_str());
+    VCHECK_SDPA_COND(k_desc->dims[0] == v_desc->dims[0],
+            "k_desc->dims[0](%s) must match v_desc->dims[0](%s)",
+            md2dim_str(k_desc).c_str(), md2dim_str(v_desc).c_str());
+    VCHECK_SDPA_COND(kv_seq_len > 0
+                    && kv_seq_len <= kv_block_table_md->dims[1] * page_size,
+            "kv_seq_len doesn't fit pages of block table(%s)",
+            md2dim_str(kv_block_table_md).c_str());
+
+    return status::success;
+}
+
 static inline status_t sdpa_attr_check(const memory_desc_t *q_desc,
         const memory_desc_t *k_desc, const memory_desc_t *v_desc,
         const engine_t *engine, const primitive_attr_t *attr,
@@ -153,7 +180,9 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
         const memory_desc_t *dst_md, const memory_desc_t *attn_mask_md,
         const memory_desc_t *scale_md, bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
-        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr) {
+        const primitive_attr_t *kq_attr, const primitive_attr_t *vs_attr,
+        const memory_desc_t *kv_block_table_md = nullptr,
+        dim_t kv_seq_len = 0) {
     auto sdpa_desc = sdpa_desc_t();
     sdpa_desc.primitive_kind = primitive_kind::sdpa;
     sdpa_desc.q_desc = *q_md;
@@ -178,6 +207,10 @@ static inline sdpa_desc_t create_sdpa_desc(const memory_desc_t *q_md,
     sdpa_desc.dst_desc = *dst_md;
     if (attn_mask_md) sdpa_desc.attn_mask_desc = *attn_mask_md;
     sdpa_desc.scale_desc = *scale_md;
+    if (kv_block_table_md) {
+        sdpa_desc.kv_block_table_desc = *kv_block_table_md;
+        sdpa_desc.kv_seq_len = kv_seq_len;
+    }
     sdpa_desc.invert_scale = invert_scale;
     sdpa_desc.kv_head_number = kv_head_number;
     sdpa_desc.mask_type = attn_mask_type;
@@ -193,14 +226,17 @@ static inline status_t create_sdpa_pd(
         bool invert_scale, dim_t kv_head_number,
         attn_mask_type_t attn_mask_type, alg_kind_t softmax_alg,
         const primitive_attr_t *attr, const primitive_attr_t *kq_attr = nullptr,
-        const primitive_attr_t *vs_attr = nullptr) {
+        const primitive_attr_t *vs_attr = nullptr,
+        const memory_desc_t *kv_block_table_md = nullptr,
+        dim_t kv_seq_len = 0) {
     CHECK(sdpa_attr_check(q_md, k_md, v_md, engine, attr, kq_attr, vs_attr));
     CHECK(sdpa_desc_check(q_md, k_md, v_md, dst_md, attn_mask_md, engine, attr,
             kq_attr, vs_attr));
+    CHECK(sdpa_paged_kv_check(q_md, k_md, v_md, kv_block_table_md, kv_seq_len));
 
     auto sdpa_desc = create_sdpa_desc(q_md, k_md, v_md, dst_md, attn_mask_md,
             scale_md, invert_scale, kv_head_number, attn_mask_type, softmax_alg,
-            kq_attr, vs_attr);
+            kq_attr, vs_attr, kv_block_table_md, kv_seq_len);
 
     primitive_attr_t sdpa_attr = attr ? *attr : default_attr();
 
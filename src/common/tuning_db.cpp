@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+
+#include "common/tuning_db.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace tuning_db {
+
+namespace {
+
+std::string db_path() {
+    // The path is case sensitive, so `getenv_string_user` can't be used.
+    const int len = 1024;
+    char value[len];
+    for (const char *name : {"ONEDNN_TUNING_DB", "DNNL_TUNING_DB"}) {
+        if (getenv(name, value, len) > 0) return value;
+    }
+    // No file is written unless requested.
+    return std::string();
+}
+
+db_t &db() {
+    static db_t db(db_path());
+    return db;
+}
+
+} // namespace
+
+db_t::db_t(const std::string &path) : path_(path) {
+    if (path_.empty()) return;
+    FILE *f = fopen(path_.c_str(), "r");
+    if (!f) return;
+    char line[2048];
+    while (fgets(line, sizeof(line), f)) {
+        // An entry is a key and a candidate and nothing else, truncated and
+        // malformed lines are skipped.
+        char key[1024];
+        int candidate = 0;
+        char extra = 0;
+        if (sscanf(line, "%1023s %d %c", key, &candidate, &extra) != 2)
+            continue;
+        entries_[key] = candidate;
+    }
+    fclose(f);
+}
+
+bool db_t::lookup(const std::string &key, int n_candidates, int &candidate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    // An entry written by an implementation with a different set of
+    // candidates is ignored, the search is repeated.
+    if (it->second < -1 || it->second >= n_candidates) return false;
+    candidate = it->second;
+    return true;
+}
+
+void db_t::store(const std::string &key, int candidate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[key] = candidate;
+    if (path_.empty()) return;
+    // A failure to persist the entry is not fatal, the result is still used
+    // by the current process.
+    FILE *f = fopen(path_.c_str(), "a");
+    if (!f) return;
+    fprintf(f, "%s %d\n", key.c_str(), candidate);
+    fclose(f);
+}
+
+bool is_enabled() {
+    static const bool enabled = getenv_int_user("TUNING", 0) != 0;
+    return enabled;
+}
+
+bool lookup(const std::string &key, int n_candidates, int &candidate) {
+    return db().lookup(key, n_candidates, candidate);
+}
+
+void store(const std::string &key, int candidate) {
+    db().store(key, candidate);
+}
+
+} // namespace tuning_db
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,77 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TUNING_DB_HPP
+#define COMMON_TUNING_DB_HPP
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Persistent results of the runtime autotuning.
+//
+// When ONEDNN_TUNING=1, implementations that support autotuning measure a
+// small set of blocking candidates at primitive descriptor creation and pick
+// the fastest one. The index of the winner is stored under a key describing
+// the problem (library version, ISA, implementation name, shapes, data types,
+// number of threads) in the file pointed by ONEDNN_TUNING_DB, so that later
+// runs skip the search. Without ONEDNN_TUNING_DB the results are kept for the
+// lifetime of the process only.
+//
+// The file is a list of `<key> <candidate>` lines. It is loaded once and new
+// entries are appended to it, the last entry for a key wins. Lines which
+// can't be parsed are ignored.
+namespace tuning_db {
+
+// A tuning database backed by the file at `path`, or by memory only if
+// `path` is empty.
+struct DNNL_API db_t {
+    db_t(const std::string &path);
+
+    // Returns true and sets `candidate` if the database has an entry for
+    // `key` that is a valid result for `n_candidates` candidates: a
+    // candidate index or -1 if no candidate applies.
+    bool lookup(const std::string &key, int n_candidates, int &candidate);
+
+    // Records the best candidate for `key`. Entries are persisted
+    // immediately.
+    void store(const std::string &key, int candidate);
+
+private:
+    std::string path_;
+    std::mutex mutex_;
+    std::unordered_map<std::string, int> entries_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(db_t);
+};
+
+// Returns true if the runtime autotuning is requested.
+bool is_enabled();
+
+// Lookup and store in the database of the process, see `db_t`.
+bool lookup(const std::string &key, int n_candidates, int &candidate);
+void store(const std::string &key, int candidate);
+
+} // namespace tuning_db
+} // namespace impl
+} // namespace dnnl
+
+#endif
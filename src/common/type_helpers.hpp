@@ -405,6 +405,8 @@ inline bool sparse_desc_is_equal(
 
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
         ok = ok && lhs.metadata_types[i] == rhs.metadata_types[i];
+    if (lhs.encoding == sparse_encoding::bsr)
+        ok = ok && utils::array_cmp(lhs.block_dims, rhs.block_dims, 2);
 
     return ok;
 }
@@ -825,6 +827,7 @@ inline bool operator==(const matmul_desc_t &lhs, const matmul_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(reduce_desc)
             && COMPARE_DESC_MEMBERS(reduce_kind)
+            && COMPARE_DESC_MEMBERS(group_offsets_desc)
             && COMPARE_DESC_MEMBERS(accum_data_type);
     return ret;
 }
@@ -986,6 +989,8 @@ inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(dst_desc)
             && COMPARE_DESC_MEMBERS(attn_mask_desc)
             && COMPARE_DESC_MEMBERS(scale_desc)
+            && COMPARE_DESC_MEMBERS(kv_block_table_desc)
+            && COMPARE_DESC_MEMBERS(kv_seq_len)
             && COMPARE_DESC_MEMBERS(kq_acc_dt)
             && COMPARE_DESC_MEMBERS(vs_acc_dt)
             && COMPARE_DESC_MEMBERS(invert_scale)
@@ -39,6 +39,7 @@
 
 #include "oneapi/dnnl/dnnl.h"
 
+#include "huge_pages.hpp"
 #include "memory_debug.hpp"
 #include "utils.hpp"
 #include "verbose.hpp"
@@ -190,6 +191,7 @@ void *malloc(size_t size, int alignment) {
     void *ptr;
     if (memory_debug::is_mem_debug())
         return memory_debug::malloc(size, alignment);
+    if (void *huge_ptr = huge_pages::malloc(size, alignment)) return huge_ptr;
 
 #ifdef _WIN32
     ptr = _aligned_malloc(size, alignment);
@@ -204,6 +206,7 @@ void *malloc(size_t size, int alignment) {
 void free(void *p) {
 
     if (memory_debug::is_mem_debug()) return memory_debug::free(p);
+    if (huge_pages::free(p)) return;
 
 #ifdef _WIN32
     _aligned_free(p);
@@ -289,6 +292,46 @@ std::string get_jit_profiling_jitdumpdir() {
     return jitdumpdir;
 }
 
+static setting_t<std::string> jit_cache_dir;
+dnnl_status_t init_jit_cache_dir(const char *dir, bool overwrite) {
+#ifdef __linux__
+    static std::mutex m;
+    std::lock_guard<std::mutex> g(m);
+
+    if (jit_cache_dir.initialized() && !overwrite) return status::success;
+
+    if (!dir) {
+        char buf[PATH_MAX];
+        jit_cache_dir.set(std::string());
+        for (const auto &prefix : {"ONEDNN_", "DNNL_"}) {
+            std::string name = std::string(prefix) + "JIT_CACHE_DIR";
+            if (getenv(name.c_str(), buf, sizeof(buf)) > 0) {
+                jit_cache_dir.set(buf);
+                break;
+            }
+        }
+    } else
+        jit_cache_dir.set(dir);
+
+    return status::success;
+#else
+    UNUSED(jit_cache_dir);
+    return status::unimplemented;
+#endif
+}
+
+std::string get_jit_cache_dir() {
+    std::string dir;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (!jit_cache_dir.initialized()) {
+        auto status = init_jit_cache_dir(nullptr, false);
+        if (status != status::success) return std::string();
+    }
+    dir = jit_cache_dir.get();
+#endif
+    return dir;
+}
+
 bool is_destroying_cache_safe() {
 #if defined(_WIN32) \
         && (defined(DNNL_WITH_SYCL) || DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL)
@@ -377,6 +420,14 @@ dnnl_status_t dnnl_set_jit_profiling_jitdumpdir(const char *dir) {
     return status;
 }
 
+dnnl_status_t dnnl_set_jit_cache_dir(const char *dir) {
+    auto status = dnnl::impl::status::unimplemented;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status = dnnl::impl::init_jit_cache_dir(dir, true);
+#endif
+    return status;
+}
+
 dnnl_status_t dnnl_set_max_cpu_isa(dnnl_cpu_isa_t isa) {
     auto status = dnnl::impl::status::runtime_error;
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
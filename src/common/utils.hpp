@@ -757,6 +757,7 @@ private:
 bool get_jit_dump();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+std::string get_jit_cache_dir();
 // Checks if the filepath is a valid path and not a symlink to ensure
 // the application only processes secure files.
 status_t check_for_symlinks(const char *filename, bool *res);
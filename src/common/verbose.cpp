@@ -43,6 +43,7 @@
 #include "eltwise_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
+#include "huge_pages.hpp"
 #include "inner_product_pd.hpp"
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
@@ -104,6 +105,12 @@ void print_header() noexcept {
                 dnnl_runtime2str(dnnl_version()->cpu_runtime),
                 dnnl_get_max_threads());
         verbose_printf("info,cpu,isa:%s\n", cpu::platform::get_isa_info());
+        huge_pages_policy_t hp_policy = dnnl_huge_pages_none;
+        size_t hp_threshold = 0;
+        huge_pages::get_policy(hp_policy, hp_threshold);
+        if (hp_policy != dnnl_huge_pages_none)
+            verbose_printf("info,cpu,huge_pages:%s,threshold:%zu\n",
+                    huge_pages::policy2str(hp_policy), hp_threshold);
 #endif
         verbose_printf("info,gpu,runtime:%s\n",
                 dnnl_runtime2str(dnnl_version()->gpu_runtime));
@@ -727,6 +734,12 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << field_delim() << "attr-deterministic:" << deterministic;
     }
 
+    const bool weights_replication = attr->weights_replication_;
+    if (weights_replication) {
+        ss << field_delim()
+           << "attr-weights-replication:" << weights_replication;
+    }
+
     // Fast exit if rest attributes were not specified.
     if (attr->has_default_values()) return ss;
 
@@ -746,6 +759,12 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
            << "attr-precomputed-reductions:" << pr.get_verbose();
     }
 
+    const dynamic_quantization_t &dq = attr->dynamic_quantization_;
+    if (!dq.has_default_values()) {
+        ss << field_delim()
+           << "attr-dynamic-quantization:" << dq.get_verbose();
+    }
+
     const post_ops_t &po = attr->post_ops_;
     if (!po.has_default_values()) {
         std::string delim = empty_delim;
@@ -86,6 +86,8 @@
 #define VERBOSE_UNSUPPORTED_ZP_CFG "unsupported zero-point configuration"
 #define VERBOSE_UNSUPPORTED_PR_CFG \
     "unsupported precomputed reductions configuration"
+#define VERBOSE_UNSUPPORTED_DQ_CFG \
+    "unsupported dynamic quantization configuration"
 #define VERBOSE_UNSUPPORTED_BIAS_CFG "unsupported bias configuration"
 #define VERBOSE_UNSUPPORTED_DT_CFG "unsupported datatype combination"
 #define VERBOSE_UNSUPPORTED_SPARSE_CFG "unsupported sparse md configuration"
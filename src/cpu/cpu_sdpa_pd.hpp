@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_SDPA_PD_HPP
+#define CPU_CPU_SDPA_PD_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+#include "cpu/cpu_engine.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_sdpa_pd_t : public sdpa_pd_t {
+    using sdpa_pd_t::sdpa_pd_t;
+
+    // Returns the number of leading keys visible to the query row `m`.
+    dim_t visible_keys(dim_t m) const {
+        const dim_t M = desc()->queries(), N = desc()->keys();
+        dim_t limit = N;
+        if (desc_.mask_type == attn_mask_type::top_left)
+            limit = m + 1;
+        else if (desc_.mask_type == attn_mask_type::bottom_right)
+            limit = m + 1 + N - M;
+        return nstl::max(dim_t(0), nstl::min(N, limit));
+    }
+
+    // Returns the number of query heads sharing a single key/value head.
+    dim_t kv_group_size() const {
+        const dim_t kv_heads = key_md()->dims[1];
+        return kv_heads > 0 ? qry_md()->dims[1] / kv_heads : 1;
+    }
+
+    // Returns the batch index of the K/V tensors holding key `n` of the batch
+    // entry `mb` and updates `n` to the key index within it. For a paged K/V
+    // cache the index is a page of the pool looked up in the block table.
+    dim_t kv_batch_index(const int32_t *block_table, dim_t mb, dim_t &n) const {
+        if (!with_paged_kv()) return mb % key_md()->dims[0];
+        const memory_desc_wrapper bt_d(kv_block_table_md());
+        const dim_t page_size = desc()->kv_page_size();
+        const dim_t page = block_table[bt_d.off(mb, n / page_size)];
+        n %= page_size;
+        return page;
+    }
+
+    // Checks that the pages of the block table holding the keys are in the
+    // K/V pool, since they are used as batch indices of the K/V tensors.
+    status_t check_kv_block_table(const int32_t *block_table) const {
+        if (!with_paged_kv()) return status::success;
+        const memory_desc_wrapper bt_d(kv_block_table_md());
+        const dim_t pool_size
+                = nstl::min(key_md()->dims[0], val_md()->dims[0]);
+        const dim_t nb_pages = nstl::min(bt_d.dims()[1],
+                utils::div_up(desc()->keys(), desc()->kv_page_size()));
+        for_(dim_t mb = 0; mb < bt_d.dims()[0]; mb++)
+        for (dim_t p = 0; p < nb_pages; p++) {
+            const dim_t page = block_table[bt_d.off(mb, p)];
+            if (page < 0 || page >= pool_size) {
+                VERROR(primitive, sdpa,
+                        "block table entry (%lld, %lld) is out of the pool of "
+                        "%lld pages",
+                        (long long)mb, (long long)p, (long long)pool_size);
+                return status::invalid_arguments;
+            }
+        }
+        return status::success;
+    }
+
+    // Checks the common restrictions shared by all CPU implementations: plain
+    // 4D tensors, a single scale value and no K/V quantization.
+    bool cpu_sdpa_args_ok() const {
+        for (auto md : {qry_md(), key_md(), val_md(), dst_md()}) {
+            const memory_desc_wrapper mdw(md);
+            if (mdw.ndims() != 4 || !mdw.is_plain()) return false;
+        }
+        if (with_attn_mask()) {
+            const memory_desc_wrapper mdw(attn_mask_md());
+            if (mdw.ndims() != 4 || !mdw.is_plain()) return false;
+        }
+        if (with_paged_kv()
+                && !memory_desc_wrapper(kv_block_table_md()).is_plain())
+            return false;
+        if (with_attn_scale() && !with_host_scale()
+                && memory_desc_wrapper(scale_md()).nelems() != 1)
+            return false;
+        if (qry_md()->dims[1] % key_md()->dims[1] != 0
+                || key_md()->dims[1] != val_md()->dims[1])
+            return false;
+        return !with_key_scales() && !with_key_zp() && !with_value_scales()
+                && !with_value_zp();
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,162 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_debug.h"
+
+#include "common/dnnl_thread.hpp"
+#include "common/engine.hpp"
+#include "common/memory.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/primitive_exec_types.hpp"
+#include "common/profiler.hpp"
+#include "common/resource.hpp"
+#include "common/stream.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/cpu_tuning.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace tuning {
+
+namespace {
+
+// Number of measured executions, the first run warms up the caches and
+// page-faults the buffers in.
+constexpr int n_warmup_runs = 1;
+constexpr int n_timed_runs = 3;
+
+} // namespace
+
+bool is_supported(const primitive_desc_t *pd) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    // The threadpool is only known at execution time, a measurement at
+    // creation time would be single-threaded.
+    return false;
+#else
+    const auto &attr = *pd->attr();
+    if (!attr.scales_.has_default_values()
+            || !attr.zero_points_.has_default_values()
+            || !attr.precomputed_reductions_.has_default_values()
+            || !attr.dropout_.has_default_values()
+            || !attr.rounding_mode_.has_default_values())
+        return false;
+    const auto &po = attr.post_ops_;
+    for (int idx = 0; idx < po.len(); idx++)
+        if (po.entry_[idx].is_prelu()) return false;
+    return !pd->has_runtime_dims_or_strides();
+#endif
+}
+
+status_t measure_exec_time(
+        const primitive_t &prim, engine_t *engine, double &time_ms) {
+    const primitive_desc_t *pd = prim.pd().get();
+    if (!is_supported(pd)) return status::unimplemented;
+
+    std::vector<int> args = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_BIAS,
+            DNNL_ARG_DST};
+    for (int idx = 0; idx < pd->attr()->post_ops_.len(); idx++) {
+        args.push_back(DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1);
+        args.push_back(DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_2);
+    }
+
+    std::vector<std::unique_ptr<memory_t, memory_deleter_t>> mems;
+    exec_args_t exec_args;
+    for (const int arg : args) {
+        const auto usage = pd->arg_usage(arg);
+        if (usage == primitive_desc_t::arg_usage_t::unused) continue;
+        const memory_desc_t *md = pd->arg_md(arg);
+        if (types::is_zero_md(md)) continue;
+
+        std::unique_ptr<memory_t, memory_deleter_t> mem;
+        CHECK(safe_ptr_assign(mem,
+                new memory_t(engine, md, memory_flags_t::alloc, nullptr)));
+        void *handle = nullptr;
+        CHECK(mem->get_data_handle(&handle));
+        if (!handle) return status::out_of_memory;
+        std::memset(handle, 0, memory_desc_wrapper(md).size());
+
+        exec_args[arg] = {mem.get(),
+                usage == primitive_desc_t::arg_usage_t::input};
+        mems.push_back(std::move(mem));
+    }
+
+    stream_t *stream_ptr = nullptr;
+    CHECK(engine->create_stream(&stream_ptr, stream_flags::in_order));
+    std::unique_ptr<stream_t> stream(stream_ptr);
+
+    std::unique_ptr<memory_storage_t> scratchpad_storage;
+    const size_t scratchpad_size = pd->scratchpad_registry().size();
+    if (scratchpad_size > 0) {
+        memory_storage_t *storage = nullptr;
+        CHECK(engine->create_memory_storage(&storage, scratchpad_size));
+        scratchpad_storage.reset(storage);
+    }
+
+    exec_ctx_t ctx(stream.get(), std::move(exec_args));
+    const auto grantor = pd->scratchpad_registry().grantor(
+            scratchpad_storage.get(), ctx);
+    ctx.set_scratchpad_grantor(&grantor);
+
+    resource_mapper_t mapper;
+    CHECK(prim.create_resource(engine, mapper));
+    ctx.set_resource_mapper(&mapper);
+
+    time_ms = 0;
+    for (int run = 0; run < n_warmup_runs + n_timed_runs; run++) {
+        const double start_ms = get_msec();
+        CHECK(prim.execute(ctx));
+        CHECK(stream->wait());
+        const double run_ms = get_msec() - start_ms;
+        if (run == n_warmup_runs || (run > n_warmup_runs && run_ms < time_ms))
+            time_ms = run_ms;
+    }
+    return status::success;
+}
+
+std::string make_key(const primitive_desc_t *pd, size_t desc_hash) {
+    using namespace primitive_hashing;
+    const auto version = dnnl_version();
+    std::string key = "v" + std::to_string(version->major) + "."
+            + std::to_string(version->minor) + "."
+            + std::to_string(version->patch) + "-" + version->hash;
+    key += ":";
+    key += dnnl_cpu_isa2str(platform::get_effective_cpu_isa());
+    key += ":" + std::string(pd->name());
+    key += ":" + md2dim_str(pd->invariant_src_md());
+    for (const auto *md : {pd->invariant_src_md(), pd->invariant_wei_md(),
+                 pd->invariant_dst_md()}) {
+        key += ":";
+        key += md ? dnnl_dt2str(md->data_type) : "undef";
+    }
+    ostringstream_t ss;
+    ss << std::hex << desc_hash << ":" << get_attr_hash(*pd->attr());
+    key += ":" + ss.str();
+    key += ":nthr" + std::to_string(dnnl_get_max_threads());
+    return key;
+}
+
+} // namespace tuning
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_TUNING_HPP
+#define CPU_CPU_TUNING_HPP
+
+#include <memory>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/primitive_hashing.hpp"
+#include "common/tuning_db.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Runtime autotuning of the blocking of CPU implementations.
+//
+// An implementation exposes `n_candidates` alternative configurations of its
+// blocking heuristic, candidate 0 being the heuristic choice itself. Its
+// primitive descriptor provides `set_tuning_candidate(int)` and initializes
+// with the requested candidate, failing with `unimplemented` if the candidate
+// is not applicable to the problem.
+namespace tuning {
+
+// Returns true if the problem of `pd` can be measured by
+// `measure_exec_time()`: no runtime dimensions and no arguments that can't be
+// allocated generically (e.g. quantization parameters).
+bool is_supported(const primitive_desc_t *pd);
+
+// Returns the execution time in milliseconds of `prim`, the best of a few
+// runs on zero-initialized buffers. Fails with `unimplemented` if the problem
+// is not supported.
+status_t measure_exec_time(
+        const primitive_t &prim, engine_t *engine, double &time_ms);
+
+// Returns the tuning database key for the problem of `pd` before its
+// initialization. The key starts with the library version and the effective
+// ISA, so that entries written by other builds or on other machines are not
+// used.
+std::string make_key(const primitive_desc_t *pd, size_t desc_hash);
+
+// Sets `candidate` to the fastest candidate for the problem of `pd` which is
+// not initialized yet. The result is looked up in the tuning database first.
+// If no candidate can be measured, `candidate` is set to -1.
+template <typename impl_t>
+status_t pick_candidate(const typename impl_t::pd_t *pd, engine_t *engine,
+        int n_candidates, int &candidate) {
+    using pd_t = typename impl_t::pd_t;
+    if (!is_supported(pd)) return status::success;
+
+    const std::string key
+            = make_key(pd, primitive_hashing::get_desc_hash(*pd->desc()));
+    if (tuning_db::lookup(key, n_candidates, candidate))
+        return status::success;
+
+    int best = -1;
+    double best_time_ms = 0;
+    for (int c = 0; c < n_candidates; c++) {
+        // The candidates start from a copy of the descriptor being
+        // initialized, before the blocking is chosen.
+        std::unique_ptr<pd_t> cand_pd(pd->clone());
+        if (!cand_pd) return status::out_of_memory;
+        cand_pd->set_tuning_candidate(c);
+        if (cand_pd->init(engine) != status::success) continue;
+        if (cand_pd->init_scratchpad_md() != status::success) continue;
+
+        // The primitive is created directly: the primitive cache key doesn't
+        // distinguish the candidates.
+        impl_t prim(cand_pd.get());
+        primitive_t &base_prim = prim;
+        if (base_prim.init(engine, /* use_global_scratchpad = */ false,
+                    cache_blob_t())
+                != status::success)
+            continue;
+
+        double time_ms = 0;
+        if (measure_exec_time(prim, engine, time_ms) != status::success)
+            continue;
+        if (best < 0 || time_ms < best_time_ms) {
+            best = c;
+            best_time_ms = time_ms;
+        }
+    }
+    // A problem no candidate applies to is recorded as well, so that the
+    // search is not repeated.
+    tuning_db::store(key, best);
+    candidate = best;
+    return status::success;
+}
+
+} // namespace tuning
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_weights_replicas.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+weights_replicas_t::~weights_replicas_t() {
+    for (char *copy : copies_)
+        impl::free(copy);
+}
+
+status_t weights_replicas_t::create(
+        std::shared_ptr<weights_replicas_t> &replicas, const void *src,
+        size_t size) {
+    replicas.reset();
+    const int nnodes = platform::get_num_numa_nodes();
+    if (nnodes <= 1 || src == nullptr || size == 0)
+        return status::unimplemented;
+
+    std::shared_ptr<weights_replicas_t> r(new weights_replicas_t(src, size));
+    // The copies are bound to their node before they are first touched by
+    // the copy, so that their pages are allocated on the node.
+    const size_t alloc_size = utils::rnd_up(size, PAGE_4K);
+    r->copies_.reserve(nnodes);
+    for (int node = 0; node < nnodes; node++) {
+        char *copy = static_cast<char *>(
+                impl::malloc(alloc_size, PAGE_4K));
+        if (copy == nullptr) return status::out_of_memory;
+        r->copies_.push_back(copy);
+        if (!platform::bind_to_numa_node(copy, alloc_size, node))
+            return status::unimplemented;
+        std::memcpy(copy, src, size);
+    }
+
+    replicas = r;
+    return status::success;
+}
+
+namespace {
+std::mutex &registry_mutex() {
+    static std::mutex m;
+    return m;
+}
+
+std::vector<std::shared_ptr<weights_replicas_t>> &registry() {
+    static std::vector<std::shared_ptr<weights_replicas_t>> r;
+    return r;
+}
+} // namespace
+
+void register_weights_replicas(
+        const std::shared_ptr<weights_replicas_t> &replicas) {
+    if (!replicas) return;
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry().push_back(replicas);
+}
+
+void unregister_weights_replicas(const weights_replicas_t *replicas) {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto &r = registry();
+    r.erase(std::remove_if(r.begin(), r.end(),
+                    [&](const std::shared_ptr<weights_replicas_t> &e) {
+                        return e.get() == replicas;
+                    }),
+            r.end());
+}
+
+std::shared_ptr<weights_replicas_t> find_weights_replicas(
+        const void *ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    for (const auto &e : registry()) {
+        if (e->contains(ptr, size)) return e;
+    }
+    return nullptr;
+}
+
+void get_weights_replicas(const void *ptr, size_t size,
+        std::shared_ptr<const weights_replicas_t> &replicas) {
+    replicas = find_weights_replicas(ptr, size);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
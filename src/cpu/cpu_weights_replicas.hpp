@@ -0,0 +1,93 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_WEIGHTS_REPLICAS_HPP
+#define CPU_CPU_WEIGHTS_REPLICAS_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Copies of a read-only buffer, one per NUMA node, each placed on its node.
+// The weights are read by all the threads of a primitive: with a copy per
+// node, the threads read them from their local memory instead of the memory
+// of the node which touched them first.
+struct DNNL_API weights_replicas_t {
+    ~weights_replicas_t();
+
+    // Creates the copies of [src, src + size). Fails with `unimplemented` if
+    // there is a single NUMA node or the memory can't be bound to the nodes.
+    static status_t create(std::shared_ptr<weights_replicas_t> &replicas,
+            const void *src, size_t size);
+
+    const void *src() const { return src_; }
+    size_t size() const { return size_; }
+    // Returns the memory taken by the copies.
+    size_t footprint() const { return size_ * copies_.size(); }
+
+    bool contains(const void *ptr, size_t size) const {
+        const char *p = static_cast<const char *>(ptr);
+        const char *s = static_cast<const char *>(src_);
+        return s <= p && p + size <= s + size_;
+    }
+
+    // Returns the address in the copy of `node` of `ptr`, which points to the
+    // source buffer.
+    template <typename T>
+    const T *local(const T *ptr, int node) const {
+        const ptrdiff_t off = reinterpret_cast<const char *>(ptr)
+                - static_cast<const char *>(src_);
+        return reinterpret_cast<const T *>(copies_[node] + off);
+    }
+
+private:
+    weights_replicas_t(const void *src, size_t size) : src_(src), size_(size) {}
+
+    const void *src_;
+    size_t size_;
+    std::vector<char *> copies_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(weights_replicas_t);
+};
+
+// Registry of the copies of buffers owned by the library and not modified
+// after the copies are made, e.g. the buffers of the graph constant tensor
+// cache, looked up by the address of the weights. The owner of the buffer
+// unregisters the copies before it modifies or frees the buffer.
+void DNNL_API register_weights_replicas(
+        const std::shared_ptr<weights_replicas_t> &replicas);
+void DNNL_API unregister_weights_replicas(const weights_replicas_t *replicas);
+std::shared_ptr<weights_replicas_t> find_weights_replicas(
+        const void *ptr, size_t size);
+
+// Sets `replicas` to the registered copies of the weights [ptr, ptr + size) of
+// a primitive created with the weights replication attribute, or to nullptr if
+// there are none. Buffers of the user are never replicated: the library can't
+// tell when they are modified in place, so the copies could go stale.
+void DNNL_API get_weights_replicas(const void *ptr, size_t size,
+        std::shared_ptr<const weights_replicas_t> &replicas);
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -21,12 +21,17 @@
 #include "cpu/matmul/gemm_bf16_matmul.hpp"
 #include "cpu/matmul/gemm_f32_matmul.hpp"
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
+#include "cpu/matmul/ref_grouped_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/matmul/ref_matmul_int8.hpp"
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/jit_avx512_core_sparse_wei_matmul.hpp"
+#include "cpu/x64/matmul/jit_uni_gemv_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
@@ -67,6 +72,8 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64(jit_bf16_matmul_t)
         CPU_INSTANCE_AARCH64(brgemm_matmul_t<sve_256>)
         CPU_INSTANCE_AARCH64(jit_int8_matmul_t)
+        CPU_INSTANCE_AVX512(jit_uni_gemv_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(jit_uni_gemv_matmul_t<avx2>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx10_2_512_amx_2>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
@@ -85,16 +92,32 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(gemm_x8s8s32x_matmul_t)
         CPU_INSTANCE(ref_matmul_t)
         CPU_INSTANCE(ref_matmul_int8_t)
+        CPU_INSTANCE_AVX512(brgemm_bsr_matmul_t<avx512_core_bf16>)
+        CPU_INSTANCE_AVX512(brgemm_bsr_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_bsr_matmul_t<avx2>)
+        CPU_INSTANCE_AVX512(jit_avx512_core_sparse_wei_matmul_t)
         CPU_INSTANCE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE(ref_sparse_matmul_t)
         /* eol */
         nullptr,
 });
+
+// Grouped matmul descriptors have weights of a higher rank than the source
+// and are served by dedicated implementations only.
+constexpr impl_list_item_t grouped_impl_list[] = REG_MATMUL_P({
+        CPU_INSTANCE_AVX512(brgemm_grouped_matmul_t<avx512_core_fp16>)
+        CPU_INSTANCE_AVX512(brgemm_grouped_matmul_t<avx512_core_bf16>)
+        CPU_INSTANCE_AVX512(brgemm_grouped_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_grouped_matmul_t<avx2>)
+        CPU_INSTANCE(ref_grouped_matmul_t)
+        /* eol */
+        nullptr,
+});
 // clang-format on
 } // namespace
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
+    if (desc->group_offsets_desc.ndims != 0) return grouped_impl_list;
     return impl_list;
 }
 
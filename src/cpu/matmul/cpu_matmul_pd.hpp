@@ -47,6 +47,28 @@ struct cpu_matmul_pd_t : public matmul_pd_t {
         return ok;
     }
     // NOLINTEND(google-default-arguments)
+
+    // Scales of a grouped matmul: common for the source and the destination,
+    // common, per N or per group and N for the weights.
+    bool grouped_attr_scales_ok() const {
+        const auto &scales = attr()->scales_;
+        if (scales.has_default_values()) return true;
+
+        const int wei_mask_G = 1 << 0;
+        const int wei_mask_N = wei_qmask_N();
+        bool ok = scales.has_default_values(
+                {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST});
+        for (int arg : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
+            if (scales.has_default_values(arg)) continue;
+            const int mask = scales.get_mask(arg);
+            ok = ok && scales.get(arg).has_default_groups()
+                    && IMPLICATION(arg != DNNL_ARG_WEIGHTS, mask == 0)
+                    && IMPLICATION(arg == DNNL_ARG_WEIGHTS,
+                            utils::one_of(mask, 0, wei_mask_N,
+                                    wei_mask_G + wei_mask_N));
+        }
+        return ok;
+    }
 };
 
 } // namespace matmul
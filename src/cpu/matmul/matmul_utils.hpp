@@ -30,6 +30,47 @@ namespace cpu {
 
 namespace matmul {
 
+// Checks that the group offsets of a grouped matmul are non-decreasing and
+// don't exceed the number of rows `M` of the source. On success, `rows` is
+// the number of rows covered by the groups.
+inline status_t check_group_offsets(
+        const int32_t *offsets, dim_t G, dim_t M, dim_t &rows) {
+    dim_t prev = 0;
+    for (dim_t g = 0; g < G; g++) {
+        const dim_t cur = offsets[g];
+        if (cur < prev || cur > M) return status::invalid_arguments;
+        prev = cur;
+    }
+    rows = prev;
+    return status::success;
+}
+
+// Splits the rows of a CSR-encoded matrix between `nthr` threads so that each
+// of them gets about the same number of non-zero elements. `pointers` has
+// `nrows + 1` elements. Each row also counts for one element, as processing
+// an empty row isn't free.
+inline void balance_csr_rows(const int32_t *pointers, dim_t nrows, int nthr,
+        int ithr, dim_t &start, dim_t &end) {
+    const dim_t total = pointers[nrows] - pointers[0] + nrows;
+    // Returns the first row the cumulative cost of which reaches the share
+    // of the threads before `i`.
+    auto split_row = [&](int i) {
+        if (i >= nthr) return nrows;
+        const dim_t target = total * i / nthr;
+        dim_t lo = 0, hi = nrows;
+        while (lo < hi) {
+            const dim_t mid = lo + (hi - lo) / 2;
+            if (pointers[mid] - pointers[0] + mid < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return lo;
+    };
+    start = split_row(ithr);
+    end = split_row(ithr + 1);
+}
+
 struct matmul_helper_t {
     using mdw_t = const memory_desc_wrapper;
 
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/matmul/ref_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+status_t ref_grouped_matmul_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const void *src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const void *wei_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *dst_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+
+    const dim_t G = pd()->n_groups();
+    const dim_t M = src_d.dims()[0];
+    const dim_t K = pd()->K();
+    const dim_t N = pd()->N();
+
+    dim_t rows = 0;
+    CHECK(check_group_offsets(offsets, G, M, rows));
+    if (rows == 0 || N == 0) return status::success;
+
+    const auto &attr_scales = pd()->attr()->scales_;
+    const float src_scale = attr_scales.has_default_values(DNNL_ARG_SRC)
+            ? 1.f
+            : io::load_float_value(
+                    attr_scales.get_data_type(DNNL_ARG_SRC), src_scales, 0);
+    const float dst_scale = attr_scales.has_default_values(DNNL_ARG_DST)
+            ? 1.f
+            : io::load_float_value(
+                    attr_scales.get_data_type(DNNL_ARG_DST), dst_scales, 0);
+    const bool with_wei_scales
+            = !attr_scales.has_default_values(DNNL_ARG_WEIGHTS);
+    const int wei_scale_mask = attr_scales.get_mask(DNNL_ARG_WEIGHTS);
+    const auto wei_scale_dt = attr_scales.get_data_type(DNNL_ARG_WEIGHTS);
+    const bool wei_scale_per_g = wei_scale_mask & 1;
+    const bool wei_scale_per_n = wei_scale_mask & pd()->wei_qmask_N();
+
+    const bool bias_per_g = pd()->with_bias() && bia_d.dims()[0] != 1;
+    const auto sum_dt
+            = pd()->attr()->post_ops_.get_sum_dt(dst_d.data_type());
+    const bool non_default_po = !pd()->attr()->post_ops_.has_default_values();
+    // Integer products are accumulated exactly.
+    const bool is_int8 = types::is_integral_dt(src_d.data_type());
+
+    parallel_nd(rows, N, [&](dim_t m, dim_t n) {
+        // The group of a row is the first one ending past it.
+        const dim_t g = std::upper_bound(offsets, offsets + G, m) - offsets;
+
+        float acc = 0.f;
+        int32_t acc_s32 = 0;
+        for (dim_t k = 0; k < K; k++) {
+            if (is_int8) {
+                const int32_t s = io::load_int_value(
+                        src_d.data_type(), src, src_d.off(m, k));
+                const int32_t w = io::load_int_value(weights_d.data_type(),
+                        weights, weights_d.off(g, k, n));
+                acc_s32 += s * w;
+                continue;
+            }
+            const float s = io::load_float_value(
+                    src_d.data_type(), src, src_d.off(m, k));
+            const float w = io::load_float_value(
+                    weights_d.data_type(), weights, weights_d.off(g, k, n));
+            acc += s * w;
+        }
+        if (is_int8) acc = static_cast<float>(acc_s32);
+
+        float d = acc * src_scale;
+        if (with_wei_scales) {
+            const dim_t sc_off = (wei_scale_per_g ? g : 0)
+                            * (wei_scale_per_n ? N : 1)
+                    + (wei_scale_per_n ? n : 0);
+            d *= io::load_float_value(wei_scale_dt, wei_scales, sc_off);
+        }
+        if (bias)
+            d += io::load_float_value(bia_d.data_type(), bias,
+                    bia_d.off(bias_per_g ? g : 0, n));
+
+        const auto dst_off = dst_d.off(m, n);
+        if (non_default_po) {
+            ref_post_ops_t::args_t args;
+            args.dst_val = io::load_float_value(sum_dt, dst, dst_off);
+            args.ctx = &ctx;
+            args.l_offset = m * N + n;
+            args.dst_md = pd()->dst_md();
+            ref_post_ops_->execute(d, args);
+        }
+        d /= dst_scale;
+        io::store_float_value(dst_d.data_type(), d, dst, dst_off);
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_REF_GROUPED_MATMUL_HPP
+#define CPU_MATMUL_REF_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+struct ref_grouped_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:grouped", ref_grouped_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
+            const auto src_type = src_md(0)->data_type;
+            const auto wei_type = weights_md(0)->data_type;
+            const auto bia_type = weights_md(1)->data_type;
+            const auto dst_type = dst_md(0)->data_type;
+
+            VDISPATCH_MATMUL(is_grouped(), VERBOSE_BAD_PARAM, "group_offsets");
+            VDISPATCH_MATMUL(
+                    is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            const bool is_int8
+                    = utils::one_of(src_type, u8, s8) && wei_type == s8;
+            VDISPATCH_MATMUL(is_int8
+                            || (utils::one_of(src_type, f32, bf16, f16)
+                                    && src_type == wei_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_MATMUL(is_int8
+                            ? utils::one_of(dst_type, f32, bf16, s32, s8, u8)
+                            : utils::one_of(dst_type, f32, src_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_MATMUL(IMPLICATION(with_bias(),
+                                     is_int8 ? utils::one_of(
+                                             bia_type, f32, bf16, s32, s8, u8)
+                                             : utils::one_of(
+                                                     bia_type, f32, src_type)),
+                    VERBOSE_UNSUPPORTED_BIAS_CFG);
+            VDISPATCH_MATMUL(platform::has_data_type_support(src_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_MATMUL(
+                    attr()->has_default_values(smask_t::scales_data_type
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::fpmath_mode,
+                            dst_type),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_MATMUL(
+                    attr_.post_ops_.check_sum_consistency(dst_type, is_int8),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_MATMUL(ref_post_ops_t::post_ops_ok(attr()->post_ops_),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            // Binary and prelu post-ops are defined over the full
+            // destination, its rows must be known at creation.
+            VDISPATCH_MATMUL(
+                    IMPLICATION(has_runtime_dims_or_strides(),
+                            attr()->post_ops_.has_default_values(
+                                    {primitive_kind::eltwise,
+                                            primitive_kind::sum})),
+                    VERBOSE_UNSUPPORTED_POSTOP);
+            VDISPATCH_MATMUL(
+                    grouped_attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+            VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_MATMUL(
+                    attr_.set_default_formats(dst_md(0)) == status::success,
+                    VERBOSE_UNSUPPORTED_POSTOP);
+
+            return status::success;
+        }
+    };
+
+    ref_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override {
+        ref_post_ops_
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops_) return status::out_of_memory;
+        CHECK(ref_post_ops_->init(pd()->dst_md()));
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -19,6 +19,7 @@
 #include <math.h>
 
 #include <algorithm>
+#include <cmath>
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
@@ -26,6 +27,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
 
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
@@ -139,6 +141,10 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto dst_rnd_mode = pd()->attr()->rounding_mode_.get(DNNL_ARG_DST);
 
+    // Source dynamic quantization: every row of the source is quantized to
+    // int8 with a scale computed from its maximum absolute value.
+    const bool with_src_dynamic_quant = pd()->with_src_dynamic_quant();
+
     // mm kernel
     auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
         dims_t src_dims_idx, weights_dims_idx;
@@ -149,6 +155,18 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         weights_dims_idx[ndims - 1] = n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
+        float src_dq_scale = 1.0f, src_dq_inv_scale = 1.0f;
+        if (with_src_dynamic_quant) {
+            float absmax = 0.0f;
+            for (dim_t k = 0; k < K; ++k) {
+                src_k_dim = k;
+                const float s = io::load_float_value(
+                        src_d.data_type(), src, src_d.off_v(src_dims_idx));
+                absmax = nstl::max(absmax, std::fabs(s));
+            }
+            src_dq_scale = absmax / INT8_MAX;
+            src_dq_inv_scale = absmax > 0.0f ? INT8_MAX / absmax : 0.0f;
+        }
         float res = 0.0f;
         for (dim_t i_group = 0; i_group < ngroups_k; i_group++) {
             float acc = 0.0f;
@@ -158,8 +176,9 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
                 const auto src_off = src_d.off_v(src_dims_idx);
                 const auto weights_off = weights_d.off_v(weights_dims_idx);
-                const float s
-                        = io::load_float_value(src_d.data_type(), src, src_off);
+                float s = io::load_float_value(src_d.data_type(), src, src_off);
+                if (with_src_dynamic_quant)
+                    s = q10n::saturate_and_round<int8_t>(s * src_dq_inv_scale);
                 float w = io::load_float_value(
                         weights_d.data_type(), weights, weights_off);
 
@@ -197,6 +216,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                         src_scale_dt, src_scales, src_scale_offset);
                 acc *= src_scale;
             }
+            if (with_src_dynamic_quant) acc *= src_dq_scale;
             if (with_wei_scales && !with_wei_decompression) {
                 const dim_t wei_scale_offset = matmul_helper_t::get_quant_off(
                         weights_dims_idx, ndims, wei_scale_mask,
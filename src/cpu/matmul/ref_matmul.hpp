@@ -66,8 +66,17 @@ struct ref_matmul_t : public primitive_t {
                     VERBOSE_UNSUPPORTED_DT);
             /* int8 weights decompression support */
             VDISPATCH_MATMUL(IMPLICATION(utils::one_of(wei_type, u8, s8),
-                                     attr_.mayiconvert(wei_type, src_type)),
+                                     attr_.mayiconvert(wei_type, src_type)
+                                             || with_src_dynamic_quant()),
                     VERBOSE_UNSUPPORTED_DT);
+            /* source dynamic quantization support */
+            const bool wei_zp_default
+                    = attr_.zero_points_.has_default_values(DNNL_ARG_WEIGHTS);
+            VDISPATCH_MATMUL(IMPLICATION(with_src_dynamic_quant(),
+                                     utils::one_of(wei_type, u8, s8)
+                                             && !attr_.fpmath_.apply_to_int_
+                                             && wei_zp_default),
+                    VERBOSE_UNSUPPORTED_DQ_CFG);
             VDISPATCH_MATMUL(IMPLICATION(src_type == f16,
                                      utils::one_of(dst_type, f32, f16)),
                     VERBOSE_UNSUPPORTED_DT);
@@ -95,7 +104,8 @@ struct ref_matmul_t : public primitive_t {
                                     | smask_t::zero_points_groups
                                     | smask_t::post_ops | smask_t::sum_dt
                                     | smask_t::fpmath_mode | smask_t::dropout
-                                    | smask_t::rounding_mode,
+                                    | smask_t::rounding_mode
+                                    | smask_t::dynamic_quantization,
                             dst_type),
                     VERBOSE_UNSUPPORTED_ATTR);
             VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_type,
@@ -124,6 +134,11 @@ struct ref_matmul_t : public primitive_t {
             return status::success;
         }
 
+        bool with_src_dynamic_quant() const {
+            return !attr()->dynamic_quantization_.has_default_values(
+                    DNNL_ARG_SRC);
+        }
+
     private:
         bool zero_points_ok() const {
             const auto &zp = attr()->zero_points_;
@@ -63,7 +63,15 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         const int32_t *wei_indices = nullptr;
         const int32_t *wei_pointers = nullptr;
 
-        if (weights_d.encoding() == sparse_encoding::csr) {
+        if (weights_d.encoding() == sparse_encoding::bsr) {
+            // BSR encoded data has the same layout as CSR, with blocks in
+            // place of elements, and is handled by a dedicated kernel.
+            const dim_t *block_dims = weights_d.sparse_desc().block_dims;
+            run_bsr_kernel(src, wei_values, wei_buffer_1, wei_buffer_2, dst, M,
+                    N, K, block_dims[0], block_dims[1], mm_dt,
+                    dst_d.data_type());
+            return status::success;
+        } else if (weights_d.encoding() == sparse_encoding::csr) {
             // For CSR encodings, pointer and indices assignment is
             // staightforward as,
             // index 1 - index buffer, index 2 - pointer buffer.
@@ -90,7 +98,7 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         }
 
         run_csr_kernel(src, wei_values, wei_indices, wei_pointers, dst, M, N, K,
-                mm_dt, src_d.is_sparse_desc());
+                mm_dt, dst_d.data_type(), src_d.is_sparse_desc());
 
     } else if (src_d.is_sparse_desc()) {
         const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
@@ -132,7 +140,7 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
         }
 
         run_csr_kernel(weights, src_values, src_indices, src_pointers, dst, M,
-                N, K, mm_dt, src_d.is_sparse_desc());
+                N, K, mm_dt, dst_d.data_type(), src_d.is_sparse_desc());
     }
     return status::success;
 }
@@ -150,7 +158,7 @@ void ref_sparse_matmul_t::cvt_coo_indices_to_csr_pointers(
 void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
         const int32_t *indices, const int32_t *pointers, void *res,
         const dim_t M, const dim_t N, const dim_t K, const data_type_t mm_dt,
-        bool is_src_sparse) const {
+        const data_type_t dst_dt, bool is_src_sparse) const {
 
     if (is_src_sparse) {
         // With a sparse source tensor, the matrix multiplication is carried out
@@ -162,7 +170,7 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
 
             for (dim_t n = 0; n < N; n++) {
                 const dim_t c_idx = m * N + n;
-                float c_val = io::load_float_value(mm_dt, res, c_idx);
+                float c_val = io::load_float_value(dst_dt, res, c_idx);
 
                 for (dim_t k = row_start; k < row_end; k++) {
                     const dim_t b_idx = indices[k] * N + n;
@@ -171,7 +179,7 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
                             = io::load_float_value(mm_dt, dmat, b_idx);
                     c_val += a_val * b_val;
                 }
-                io::store_float_value(mm_dt, c_val, res, c_idx);
+                io::store_float_value(dst_dt, c_val, res, c_idx);
             }
         });
     } else {
@@ -188,15 +196,45 @@ void ref_sparse_matmul_t::run_csr_kernel(const void *dmat, const void *values,
                     const float a_val
                             = io::load_float_value(mm_dt, dmat, a_idx);
                     const float b_val = io::load_float_value(mm_dt, values, n);
-                    float c_val = io::load_float_value(mm_dt, res, c_idx);
+                    float c_val = io::load_float_value(dst_dt, res, c_idx);
                     c_val += a_val * b_val;
-                    io::store_float_value(mm_dt, c_val, res, c_idx);
+                    io::store_float_value(dst_dt, c_val, res, c_idx);
                 }
             }
         });
     }
 }
 
+void ref_sparse_matmul_t::run_bsr_kernel(const void *dmat, const void *values,
+        const int32_t *indices, const int32_t *pointers, void *res,
+        const dim_t M, const dim_t N, const dim_t K, const dim_t br,
+        const dim_t bc, const data_type_t mm_dt,
+        const data_type_t dst_dt) const {
+    const dim_t nbr = utils::div_up(K, br);
+    parallel_nd(M, [&](dim_t m) {
+        for (dim_t kb = 0; kb < nbr; kb++) {
+            for (dim_t blk = pointers[kb]; blk < pointers[kb + 1]; blk++) {
+                const dim_t n_start = indices[blk] * bc;
+                const dim_t k_end = nstl::min(K - kb * br, br);
+                const dim_t n_end = nstl::min(N - n_start, bc);
+                for_(dim_t k = 0; k < k_end; k++)
+                for (dim_t n = 0; n < n_end; n++) {
+                    const dim_t a_idx = m * K + kb * br + k;
+                    const dim_t b_idx = blk * br * bc + k * bc + n;
+                    const dim_t c_idx = m * N + n_start + n;
+                    const float a_val
+                            = io::load_float_value(mm_dt, dmat, a_idx);
+                    const float b_val
+                            = io::load_float_value(mm_dt, values, b_idx);
+                    float c_val = io::load_float_value(dst_dt, res, c_idx);
+                    c_val += a_val * b_val;
+                    io::store_float_value(dst_dt, c_val, res, c_idx);
+                }
+            }
+        }
+    });
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -57,13 +57,16 @@ struct ref_sparse_matmul_t : public primitive_t {
             VDISPATCH_MATMUL(IMPLICATION(wei_d.is_sparse_desc(),
                                      utils::one_of(wei_d.encoding(),
                                              sparse_encoding::csr,
-                                             sparse_encoding::coo)),
+                                             sparse_encoding::coo,
+                                             sparse_encoding::bsr)),
                     VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
             VDISPATCH_MATMUL(
                     utils::everyone_is(f16, src_type, wei_type, dst_type)
                             || utils::everyone_is(
-                                    f32, src_type, wei_type, dst_type),
+                                    f32, src_type, wei_type, dst_type)
+                            || (utils::everyone_is(bf16, src_type, wei_type)
+                                    && utils::one_of(dst_type, f32, bf16)),
                     VERBOSE_UNSUPPORTED_DT_CFG);
 
             if (src_d.is_sparse_desc()) {
@@ -86,7 +89,9 @@ struct ref_sparse_matmul_t : public primitive_t {
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
                 VDISPATCH_MATMUL(
-                        IMPLICATION(sparse_mem_encoding == sparse_encoding::csr,
+                        IMPLICATION(utils::one_of(sparse_mem_encoding,
+                                            sparse_encoding::csr,
+                                            sparse_encoding::bsr),
                                 utils::everyone_is(s32, wei_d.metadata_type(0),
                                         wei_d.metadata_type(1))),
                         VERBOSE_UNSUPPORTED_SPARSE_CFG);
@@ -146,7 +151,17 @@ struct ref_sparse_matmul_t : public primitive_t {
     void run_csr_kernel(const void *dmat, const void *values,
             const int32_t *indices, const int32_t *pointers, void *res,
             const dim_t M, const dim_t N, const dim_t K,
-            const data_type_t mm_dt, bool is_src_sparse) const;
+            const data_type_t mm_dt, const data_type_t dst_dt,
+            bool is_src_sparse) const;
+
+    // Executes the matrix multiplication, C = A x B, for a dense multiplier
+    // and a BSR-encoded multiplicand of `br` x `bc` blocks, with the padded
+    // parts of the edge blocks skipped.
+    void run_bsr_kernel(const void *dmat, const void *values,
+            const int32_t *indices, const int32_t *pointers, void *res,
+            const dim_t M, const dim_t N, const dim_t K, const dim_t br,
+            const dim_t bc, const data_type_t mm_dt,
+            const data_type_t dst_dt) const;
 
     status_t execute(const exec_ctx_t &ctx) const override;
 
@@ -16,10 +16,24 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <thread>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
 
 #include "cpu/platform.hpp"
 
+#if DNNL_X64 && DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP \
+        && defined(__linux__)
+#define DNNL_HYBRID_THREAD_WEIGHTS 1
+#include <sched.h>
+#else
+#define DNNL_HYBRID_THREAD_WEIGHTS 0
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include <algorithm>
 
@@ -30,6 +44,16 @@
 #endif
 #endif
 
+#if defined(__linux__)
+#define DNNL_NUMA_LINUX 1
+#include <fstream>
+#include <string>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define DNNL_NUMA_LINUX 0
+#endif
+
 #if DNNL_X64
 #include "cpu/x64/cpu_isa_traits.hpp"
 #elif DNNL_AARCH64
@@ -333,6 +357,154 @@ int get_vector_register_size() {
     return 0;
 }
 
+#if DNNL_HYBRID_THREAD_WEIGHTS
+namespace {
+bool is_hybrid_cpu() {
+    uint32_t data[4] = {0};
+    Xbyak::util::Cpu::getCpuid(0, data);
+    if (data[0] < 0x1a) return false;
+    // CPUID.07H:EDX[15] is set on CPUs with cores of different types.
+    Xbyak::util::Cpu::getCpuidEx(7, 0, data);
+    return (data[3] >> 15) & 1;
+}
+
+// Returns the weight of the core the calling thread is running on.
+float get_core_weight() {
+    // CPUID.1AH:EAX[31:24] is the type of the core of the calling logical
+    // processor.
+    constexpr uint32_t core_type_atom = 0x20;
+    // Efficiency cores execute 256-bit vector instructions at half of the
+    // rate of performance cores. The lower frequency is balanced by the
+    // performance cores usually running two hyper-threads.
+    constexpr float atom_weight = 0.5f;
+
+    uint32_t data[4] = {0};
+    Xbyak::util::Cpu::getCpuidEx(0x1a, 0, data);
+    return (data[0] >> 24) == core_type_atom ? atom_weight : 1.f;
+}
+
+// A thread may migrate between cores of different types unless it is bound
+// to a single logical processor, e.g. with OMP_PROC_BIND=close.
+bool is_thread_bound() {
+    cpu_set_t cpu_set;
+    return ::sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0
+            && CPU_COUNT(&cpu_set) == 1;
+}
+} // namespace
+#endif
+
+const float *get_thread_weights(int nthr) {
+#if DNNL_HYBRID_THREAD_WEIGHTS
+    static const bool is_hybrid = is_hybrid_cpu();
+    if (!is_hybrid) return nullptr;
+
+    static std::vector<float> weights;
+    static std::atomic<bool> initialized {false};
+    static std::mutex mutex;
+    if (!initialized.load(std::memory_order_acquire)) {
+        // The threads are probed in a parallel region of their own, which
+        // can't be created from within another one.
+        if (dnnl_in_parallel()) return nullptr;
+
+        std::lock_guard<std::mutex> guard(mutex);
+        if (!initialized.load(std::memory_order_relaxed)) {
+            const int max_nthr = dnnl_get_max_threads();
+            std::vector<float> w(max_nthr, 0.f);
+            std::atomic<bool> all_bound {true};
+            parallel(max_nthr, [&](int ithr, int) {
+                if (!is_thread_bound()) all_bound = false;
+                w[ithr] = get_core_weight();
+            });
+            bool has_atom = false, has_core = false;
+            for (float v : w) {
+                has_atom = has_atom || v < 1.f;
+                has_core = has_core || v == 1.f;
+            }
+            // Equal weights are not kept to avoid weighted partitioning
+            // overheads.
+            if (all_bound && has_atom && has_core) weights = std::move(w);
+            initialized.store(true, std::memory_order_release);
+        }
+    }
+    return nthr <= (int)weights.size() ? weights.data() : nullptr;
+#else
+    return nullptr;
+#endif
+}
+
+namespace {
+std::atomic<int> &num_numa_nodes_override() {
+    static std::atomic<int> nnodes {0};
+    return nnodes;
+}
+
+int get_num_system_numa_nodes() {
+#if DNNL_NUMA_LINUX
+    // The online nodes are listed as ranges, e.g. `0-1` or `0,2-3`. Only the
+    // highest node id matters, as the nodes are addressed by their id.
+    static const int num_nodes = []() {
+        std::ifstream f("/sys/devices/system/node/online");
+        std::string list;
+        if (!(f >> list)) return 1;
+        int max_id = 0, id = 0;
+        for (char c : list) {
+            if (c >= '0' && c <= '9') {
+                id = id * 10 + (c - '0');
+            } else {
+                max_id = std::max(max_id, id);
+                id = 0;
+            }
+        }
+        max_id = std::max(max_id, id);
+        return std::min(max_id + 1, max_numa_nodes);
+    }();
+    return num_nodes;
+#else
+    return 1;
+#endif
+}
+} // namespace
+
+int get_num_numa_nodes() {
+    const int nnodes = num_numa_nodes_override().load();
+    return nnodes > 0 ? nnodes : get_num_system_numa_nodes();
+}
+
+void set_num_numa_nodes_override(int nnodes) {
+    num_numa_nodes_override().store(
+            std::min(std::max(nnodes, 0), max_numa_nodes));
+}
+
+int get_numa_node() {
+#if DNNL_NUMA_LINUX && defined(SYS_getcpu)
+    unsigned cpu = 0, node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) return 0;
+    return std::min((int)node, get_num_numa_nodes() - 1);
+#else
+    return 0;
+#endif
+}
+
+bool bind_to_numa_node(void *ptr, size_t size, int node) {
+    if (node < 0 || node >= max_numa_nodes) return false;
+    // The nodes reported because of an override may not exist.
+    if (num_numa_nodes_override().load() > 0) return true;
+#if DNNL_NUMA_LINUX && defined(SYS_mbind)
+    // Values of MPOL_BIND and MPOL_MF_MOVE from <numaif.h>, which comes with
+    // libnuma.
+    constexpr int mpol_bind = 2;
+    constexpr unsigned mpol_mf_move = 1u << 1;
+    const unsigned long mask = 1ul << node;
+    return ::syscall(SYS_mbind, ptr, size, mpol_bind, &mask,
+                   (unsigned long)max_numa_nodes + 1, mpol_mf_move)
+            == 0;
+#else
+    MAYBE_UNUSED(ptr);
+    MAYBE_UNUSED(size);
+    return false;
+#endif
+}
+
 /* The purpose of this function is to provide a very efficient timestamp
  * calculation (used primarily for primitive cache). For DNNL_X64, this can be
  * accomplished using *rdtsc* since it provides a timestamp value that (i) is
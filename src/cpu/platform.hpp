@@ -189,6 +189,27 @@ constexpr int get_cache_line_size() {
 
 int get_vector_register_size();
 
+// Returns the relative throughput of the threads of parallel regions indexed
+// by the thread number, or nullptr if all the threads are considered equally
+// fast. The weights are provided for hybrid CPUs only and are valid for teams
+// of up to `nthr` threads.
+const float *get_thread_weights(int nthr);
+
+// Highest number of NUMA nodes taken into account.
+constexpr int max_numa_nodes = 64;
+// Returns the number of NUMA nodes of the system, 1 if it is unknown.
+int DNNL_API get_num_numa_nodes();
+// Makes get_num_numa_nodes() report `nnodes` nodes, for testing. While the
+// override is set, bind_to_numa_node() leaves the memory where it is. A value
+// of 0 restores the number of nodes of the system.
+void DNNL_API set_num_numa_nodes_override(int nnodes);
+// Returns the NUMA node of the core the calling thread is running on.
+int DNNL_API get_numa_node();
+// Binds the pages of [ptr, ptr + size) to NUMA node `node`, `ptr` being
+// aligned on a page. The pages already touched are moved to the node.
+// Returns false when the memory policy can't be set.
+bool DNNL_API bind_to_numa_node(void *ptr, size_t size, int node);
+
 size_t get_timestamp();
 
 } // namespace platform
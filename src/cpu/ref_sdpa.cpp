@@ -0,0 +1,139 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_t::execute_ref(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto qry = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    const auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    const auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    const auto msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    const auto block_table
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_KV_BLOCK_TABLE);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    CHECK(pd()->check_kv_block_table(block_table));
+
+    const memory_desc_wrapper qry_d(pd()->qry_md());
+    const memory_desc_wrapper key_d(pd()->key_md());
+    const memory_desc_wrapper val_d(pd()->val_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto *d = pd()->desc();
+    const dim_t MB = dst_d.dims()[0], H = dst_d.dims()[1];
+    const dim_t M = d->queries(), N = d->keys(), D = d->head_size(),
+                Dv = d->values();
+    const dim_t kv_group = pd()->kv_group_size();
+    const bool with_mask = pd()->with_attn_mask();
+    const bool inf_as_zero
+            = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(pd()->scale_md()->data_type, scale_ptr, 0);
+        if (d->invert_scale) scale = 1.f / scale;
+    }
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+
+    const auto ker = [&](int ithr, int nthr, dim_t mb, dim_t h, dim_t m) {
+        float *s = scores_base + ithr * N;
+        float *acc = acc_base + ithr * Dv;
+        const dim_t q_mb = mb % qry_d.dims()[0];
+        const dim_t kv_h = h / kv_group;
+        const dim_t n_visible = pd()->visible_keys(m);
+
+        float max_s = -INFINITY;
+        for (dim_t n = 0; n < n_visible; n++) {
+            dim_t kv_n = n;
+            const dim_t kv_mb = pd()->kv_batch_index(block_table, mb, kv_n);
+            float sum = 0.f;
+            for (dim_t k = 0; k < D; k++) {
+                const float q = io::load_float_value(qry_d.data_type(), qry,
+                        qry_d.off(q_mb, h, m, k));
+                const float kv = io::load_float_value(key_d.data_type(), key,
+                        key_d.off(kv_mb, kv_h, k, kv_n));
+                sum += q * kv;
+            }
+            sum *= scale;
+            if (with_mask) {
+                const auto &md = msk_d.dims();
+                sum += io::load_float_value(msk_d.data_type(), msk,
+                        msk_d.off(mb % md[0], h % md[1], m % md[2], n % md[3]));
+            }
+            s[n] = sum;
+            max_s = nstl::max(max_s, sum);
+        }
+
+        float denom = 0.f;
+        for (dim_t n = 0; n < n_visible; n++) {
+            s[n] = max_s == -INFINITY ? 0.f : expf(s[n] - max_s);
+            denom += s[n];
+        }
+        const float inv_denom = (inf_as_zero && denom == 0.f)
+                ? 0.f
+                : 1.f / denom;
+
+        for (dim_t v = 0; v < Dv; v++)
+            acc[v] = 0.f;
+        for (dim_t n = 0; n < n_visible; n++) {
+            dim_t kv_n = n;
+            const dim_t kv_mb = pd()->kv_batch_index(block_table, mb, kv_n);
+            for (dim_t v = 0; v < Dv; v++)
+                acc[v] += s[n]
+                        * io::load_float_value(val_d.data_type(), val,
+                                val_d.off(kv_mb, kv_h, kv_n, v));
+        }
+        for (dim_t v = 0; v < Dv; v++)
+            io::store_float_value(dst_d.data_type(), acc[v] * inv_denom, dst,
+                    dst_d.off(mb, h, m, v));
+    };
+
+    // With a causal mask the cost of a query row grows with its index, the
+    // rows are distributed dynamically to even out the load.
+    const int nthr = pd()->nthr_;
+    if (pd()->with_causal_mask())
+        parallel_nd_dynamic_ext(nthr, MB, H, M, ker);
+    else
+        parallel_nd_ext(nthr, MB, H, M, ker);
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
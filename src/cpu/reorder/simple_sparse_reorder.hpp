@@ -31,6 +31,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
 #include "cpu/simple_q10n.hpp"
 
@@ -260,6 +261,129 @@ private:
     std::shared_ptr<primitive_t> reorder_;
 };
 
+// Dense -> BSR reorder. A block is stored when at least one of its elements
+// is non-zero. The blocks at the right and bottom edges of the tensor are
+// padded with zeroes. The number of the stored blocks must not exceed the
+// `nnz` of the destination memory descriptor.
+struct simple_bsr_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+        DECLARE_COMMON_PD_T("simple:bsr", simple_bsr_reorder_t);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            const memory_desc_wrapper input_d(src_md);
+            const memory_desc_wrapper output_d(dst_md);
+
+            VDISPATCH_REORDER_IC(input_d.is_blocking_desc(),
+                    VERBOSE_UNSUPPORTED_FORMAT_KIND);
+            VDISPATCH_REORDER_IC(output_d.is_sparse_desc(),
+                    VERBOSE_UNSUPPORTED_FORMAT_KIND);
+            VDISPATCH_REORDER_IC(output_d.encoding() == sparse_encoding::bsr,
+                    VERBOSE_UNSUPPORTED_FEATURE,
+                    "only sparse_encoding::bsr is supported for dst");
+            VDISPATCH_REORDER_IC(!input_d.has_runtime_dims_or_strides()
+                            && !output_d.has_runtime_dims_or_strides(),
+                    VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+            VDISPATCH_REORDER_IC(
+                    input_d.data_type() == output_d.data_type(),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_REORDER_IC(
+                    utils::everyone_is(data_type::s32,
+                            output_d.metadata_type(0),
+                            output_d.metadata_type(1)),
+                    VERBOSE_UNSUPPORTED_SPARSE_CFG);
+            VDISPATCH_REORDER_IC(
+                    attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+            auto _pd = make_unique_pd<pd_t>(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return status::out_of_memory;
+            CHECK(_pd->init(engine, src_engine, dst_engine));
+            CHECK(_pd->init_scratchpad_md());
+            return safe_ptr_assign(*reorder_pd, _pd.release());
+        }
+
+        friend dnnl::impl::impl_list_item_t;
+    };
+
+    simple_bsr_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        const auto input = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+        auto values = CTX_OUT_MEM(char *, DNNL_ARG_TO, 0);
+        auto indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 1);
+        auto pointers = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 2);
+
+        const memory_desc_wrapper input_d(pd()->src_md());
+        const memory_desc_wrapper output_d(pd()->dst_md());
+        const auto dt = input_d.data_type();
+        const size_t dt_sz = input_d.data_type_size();
+
+        const dim_t M = input_d.dims()[0];
+        const dim_t N = input_d.dims()[1];
+        const dim_t br = output_d.sparse_desc().block_dims[0];
+        const dim_t bc = output_d.sparse_desc().block_dims[1];
+        const dim_t nbr = utils::div_up(M, br);
+        const dim_t nbc = utils::div_up(N, bc);
+        const dim_t blk_sz = br * bc;
+
+        auto is_zero_block = [&](dim_t ib, dim_t jb) {
+            for_(dim_t i = ib * br; i < nstl::min(M, (ib + 1) * br); i++)
+            for (dim_t j = jb * bc; j < nstl::min(N, (jb + 1) * bc); j++) {
+                const float v = io::load_float_value(
+                        dt, input + input_d.off(i, j) * dt_sz, 0);
+                if (v != 0) return false;
+            }
+            return true;
+        };
+
+        // Count the non-zero blocks of each block row and turn the counts
+        // into the row pointers.
+        pointers[0] = 0;
+        parallel_nd(nbr, [&](dim_t ib) {
+            int32_t cnt = 0;
+            for (dim_t jb = 0; jb < nbc; jb++)
+                cnt += !is_zero_block(ib, jb);
+            pointers[ib + 1] = cnt;
+        });
+        for (dim_t ib = 0; ib < nbr; ib++)
+            pointers[ib + 1] += pointers[ib];
+
+        if (pointers[nbr] > output_d.nnz()) {
+            VERROR(primitive, reorder,
+                    "number of non-zero blocks %d exceeds nnz %lld",
+                    (int)pointers[nbr], (long long)output_d.nnz());
+            return status::invalid_arguments;
+        }
+
+        parallel_nd(nbr, [&](dim_t ib) {
+            dim_t blk = pointers[ib];
+            for (dim_t jb = 0; jb < nbc; jb++) {
+                if (is_zero_block(ib, jb)) continue;
+                indices[blk] = static_cast<int32_t>(jb);
+                char *blk_values = values + blk * blk_sz * dt_sz;
+                std::memset(blk_values, 0, blk_sz * dt_sz);
+                for_(dim_t i = ib * br; i < nstl::min(M, (ib + 1) * br); i++)
+                for (dim_t j = jb * bc; j < nstl::min(N, (jb + 1) * bc); j++) {
+                    const dim_t off = (i - ib * br) * bc + (j - jb * bc);
+                    std::memcpy(blk_values + off * dt_sz,
+                            input + input_d.off(i, j) * dt_sz, dt_sz);
+                }
+                blk++;
+            }
+        });
+
+        return status::success;
+    }
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
 #undef SIMPLE_SPARSE_REORDER_TEMPL_DECL
 #undef SIMPLE_SPARSE_REORDER_TEMPL_CALL
 
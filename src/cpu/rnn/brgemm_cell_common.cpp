@@ -194,7 +194,11 @@ rnn_cell_execution_sig((ref_rnn_fwd_t<src_type, weights_type,
                 cell_position, src_iter_, src_layer_, w_iter_[0], w_layer_[0],
                 scratch_gates_, scratch_cell_, amx_scratchpad,
                 addr_batch_global, fused_postgemm);
-        dst_calc.execute();
+        if (cell_blocks)
+            dst_calc.execute_blocks(
+                    cell_blocks->ithr, cell_blocks->start, cell_blocks->end);
+        else
+            dst_calc.execute();
     }
 
     if (rnn.unfused_post_gemm) {
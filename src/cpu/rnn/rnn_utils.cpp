@@ -14,7 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <initializer_list>
+#include <thread>
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
@@ -159,6 +162,70 @@ void rnn_utils::set_offsets(const rnn_conf_t &rnn, size_t &ws_gates_offset,
 #undef register_space
 }
 
+status_t rnn_utils::wavefront_execute(const rnn_conf_t &rnn,
+        const std::function<status_t(
+                int ithr, int dir, int lay, int iter, int block)> &f) {
+    const int n_mb = static_cast<int>(rnn.M_blocks);
+    const int n_nb = static_cast<int>(rnn.N_blocks);
+    const int n_blocks = n_mb * n_nb;
+    const int n_cells = rnn.n_dir * rnn.n_layer * rnn.n_iter;
+    const int n_items = n_cells * n_blocks;
+
+    // Cells sorted by the wavefront index lay + iter. Since a cell depends
+    // only on cells of the previous wavefront, a block claimed by a thread
+    // never waits for a block that is not claimed yet, which guarantees
+    // progress regardless of how many threads the runtime actually runs.
+    std::vector<int> cells;
+    cells.reserve(n_cells);
+    for (int w = 0; w < rnn.n_layer + rnn.n_iter - 1; w++)
+        for_(int dir = 0; dir < rnn.n_dir; dir++)
+        for (int lay = nstl::max(0, w - rnn.n_iter + 1);
+                lay < nstl::min(rnn.n_layer, w + 1); lay++)
+            cells.push_back((dir * rnn.n_layer + lay) * rnn.n_iter + w - lay);
+
+    // Number of completed blocks in a row block of a cell. Counters are
+    // padded to a cache line as they are polled by the waiting threads.
+    constexpr int pad = 64 / sizeof(std::atomic<int>);
+    std::unique_ptr<std::atomic<int>[]> done(
+            new std::atomic<int>[(size_t)n_cells * n_mb * pad]);
+    for (int i = 0; i < n_cells * n_mb; i++)
+        done[(size_t)i * pad].store(0, std::memory_order_relaxed);
+    const auto counter = [&](int dir, int lay, int iter,
+                                 int mb) -> std::atomic<int> & {
+        const int cell = (dir * rnn.n_layer + lay) * rnn.n_iter + iter;
+        return done[((size_t)cell * n_mb + mb) * pad];
+    };
+    const auto wait_for = [&](const std::atomic<int> &c) {
+        while (c.load(std::memory_order_acquire) < n_nb)
+            std::this_thread::yield();
+    };
+
+    std::atomic<int> next_item(0);
+    std::atomic<int> status(status::success);
+    const int nthr = nstl::min(rnn.nthr, dnnl_get_current_num_threads());
+    parallel(nthr, [&](const int ithr, const int) {
+        for (int item = next_item++; item < n_items; item = next_item++) {
+            const int cell = cells[item / n_blocks];
+            const int block = item % n_blocks;
+            const int mb = block / n_nb;
+            const int iter = cell % rnn.n_iter;
+            const int lay = (cell / rnn.n_iter) % rnn.n_layer;
+            const int dir = cell / (rnn.n_iter * rnn.n_layer);
+
+            if (lay > 0) wait_for(counter(dir, lay - 1, iter, mb));
+            if (iter > 0) wait_for(counter(dir, lay, iter - 1, mb));
+
+            const status_t st = f(ithr, dir, lay, iter, block);
+            if (st != status::success) status.store(st);
+            // The block is marked as done even on failure so that the
+            // threads waiting for it are not blocked forever.
+            counter(dir, lay, iter, mb)
+                    .fetch_add(1, std::memory_order_release);
+        }
+    });
+    return static_cast<status_t>(status.load());
+}
+
 void rnn_utils::get_scratchpad_and_workspace_sizes(const rnn_conf_t &rnn,
         size_t &scratchpad_size, size_t &workspace_size) {
     size_t ws_gates_offset, ws_ht_offset, ws_states_layer_offset,
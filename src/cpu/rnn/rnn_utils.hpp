@@ -17,6 +17,7 @@
 #ifndef CPU_RNN_RNN_UTILS_HPP
 #define CPU_RNN_RNN_UTILS_HPP
 
+#include <functional>
 #include <memory>
 #include <type_traits>
 
@@ -76,7 +77,8 @@
             scratch_t *scratch_cell_, scratch_t *scratch_gates_blocked_, \
             scratch_t *scratch_src_layer_, scratch_t *scratch_src_iter_, \
             dst_iter_t *dst_iter_, gemm_acc_t *amx_scratchpad, \
-            x64::brgemm_batch_element_t *addr_batch_global
+            x64::brgemm_batch_element_t *addr_batch_global, \
+            const rnn_utils::cell_blocks_t *cell_blocks
 
 #define rnn_grid_execution_sig_args \
     const exec_ctx_t &ctx, const rnn_utils::rnn_conf_t &rnn, \
@@ -262,6 +264,13 @@ enum brgemm_rnn_execute_loop_order_t {
     nblk_mblk = 0x2
 };
 
+// Range of the (m, n) blocks of a brgemm cell computed by a single thread in
+// the wavefront execution mode.
+struct cell_blocks_t {
+    int ithr;
+    int start, end;
+};
+
 struct diff_src_brgemm_conf_t {
     dim_t M = 0, N = 0, K = 0;
 
@@ -660,6 +669,10 @@ struct rnn_conf_t {
     bool unfused_post_gemm;
     brgemm_rnn_execute_loop_order_t loop_order
             = brgemm_rnn_execute_loop_order_t::undefined;
+    // Cells are scheduled along the (layer, iteration) wavefront: blocks of
+    // cell(l, t) are computed concurrently with the ones of cell(l + 1, t - 1)
+    // and of the other direction.
+    bool wavefront = false;
 
     // for merged layer computation in brgemm
     dim_t Mlayermerged;
@@ -1166,9 +1179,13 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
-    rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
+    // In the wavefront mode cells of different layers and directions are in
+    // flight at the same time, each of them needs its own scratch gates.
+    const size_t n_scratch_gates = rnn.wavefront
+            ? (size_t)rnn.n_layer * rnn.n_dir
+            : (size_t)rnn.n_iter_scratch_gates;
+    rnn.scratch_gates_size = sizeof(typename T::scratch_t) * n_scratch_gates
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
     rnn.scratch_ht_size
             = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
@@ -1205,6 +1222,14 @@ void set_offsets(const rnn_conf_t &rnn, size_t &ws_gates_offset,
 
 void get_scratchpad_and_workspace_sizes(
         const rnn_conf_t &rnn, size_t &scratchpad_size, size_t &workspace_size);
+// Calls f(ithr, dir, lay, iter, block) for every (m, n) block of every cell of
+// the grid. Blocks are claimed in the wavefront order, a block of cell
+// (dir, lay, iter) starts once the same rows of cells (dir, lay - 1, iter) and
+// (dir, lay, iter - 1) are complete. Blocks are enumerated in the mblk_nblk
+// order.
+status_t wavefront_execute(const rnn_conf_t &rnn,
+        const std::function<status_t(
+                int ithr, int dir, int lay, int iter, int block)> &f);
 status_t set_expected_desc(rnn_conf_t &rnn, memory_desc_t &weights_md,
         weights_type_t weights_type);
 status_t set_good_strides(memory_desc_t &weights_md, format_tag_t tag);
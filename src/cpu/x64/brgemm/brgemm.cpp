@@ -18,7 +18,9 @@
 #include "cpu/x64/brgemm/brgemm_utils.hpp"
 
 #include "common/c_types_map.hpp"
+#include "common/kernel_cache.hpp"
 #include "common/nstl.hpp"
+#include "common/primitive_serialization.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -462,6 +464,8 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     const auto &wei_scales = attr->scales_.get(DNNL_ARG_WEIGHTS);
     brg->with_src_scales
             = !brg->skip_scales && !src_scales.has_default_values();
+    brg->is_src_scale_per_m
+            = brg->with_src_scales && src_scales.get_mask() > 0;
     brg->with_wei_scales
             = !brg->skip_scales && !wei_scales.has_default_values();
     if (brg->with_wei_scales) {
@@ -484,8 +488,12 @@ status_t brgemm_desc_set_postops(brgemm_desc_t *brg,
     brg->with_dst_scales = !dst_scales.has_default_values();
     const bool scales_ok = attr->scales_.has_default_values({DNNL_ARG_SRC,
                                    DNNL_ARG_WEIGHTS, DNNL_ARG_DST})
-            && IMPLICATION(!src_scales.has_default_values(),
-                    src_scales.get_mask() == 0)
+            // Per-row source scales (any non-zero mask is assumed to be
+            // per-row, the driver checks the mask value) are applied by
+            // the non-AMX gemm kernel only.
+            && IMPLICATION(!src_scales.has_default_values()
+                            && src_scales.get_mask() > 0,
+                    !brg->is_tmm && !brg->is_gemv && !brg->is_dgmm)
             && IMPLICATION(!dst_scales.has_default_values(),
                     dst_scales.get_mask() == 0);
     if (!scales_ok) return status::unimplemented;
@@ -668,6 +676,81 @@ status_t brgemm_kernel_destroy(brgemm_kernel_t *brg_kernel) {
     return status::success;
 }
 
+namespace {
+// Key of a BRGEMM kernel in the kernel cache. Unlike brgemm_cmp(), the
+// serialization of the descriptor covers its attributes and destination
+// memory descriptor, so that the keys can be compared across primitives.
+struct brgemm_kernel_key_t : public kernel_cache::key_impl_t {
+    brgemm_kernel_key_t(const brgemm_desc_t &brg) {
+        brg.serialize(sstream_);
+        hash_ = sstream_.get_hash();
+    }
+
+    bool compare(const kernel_cache::key_impl_t *key_impl) const override {
+        const auto *other
+                = dynamic_cast<const brgemm_kernel_key_t *>(key_impl);
+        return other != nullptr && sstream_ == other->sstream_;
+    }
+
+    size_t hash() const override { return hash_; }
+
+private:
+    serialization_stream_t sstream_;
+    size_t hash_ = 0;
+};
+
+// The kernel keeps a copy of the descriptor, which points to the bd_mask and
+// the static offsets of the caller. The value keeps its own copies of them,
+// so that the kernel outlives the primitive which created it.
+struct brgemm_kernel_value_t : public kernel_cache::value_impl_t {
+    std::vector<char> bd_mask;
+    std::vector<brgemm_batch_element_t> static_offsets;
+    std::unique_ptr<brgemm_kernel_t> kernel;
+};
+} // namespace
+
+status_t brgemm_kernel_get_or_create(
+        std::shared_ptr<brgemm_kernel_t> &brg_kernel,
+        const brgemm_desc_t &brg) {
+    brg_kernel.reset();
+
+    kernel_cache::iface_t::create_func_ptr_t create = [](void *context) {
+        const auto &brg = *static_cast<const brgemm_desc_t *>(context);
+        auto value = std::make_shared<brgemm_kernel_value_t>();
+        brgemm_desc_t value_brg(brg);
+        if (brg.brgattr.bd_mask_level > 0) {
+            value->bd_mask.assign(
+                    brg.brgattr.bd_mask, brg.brgattr.bd_mask + brg.bcast_dim);
+            value_brg.brgattr.bd_mask = value->bd_mask.data();
+        }
+        if (brg.type == brgemm_static_offs) {
+            value->static_offsets.assign(brg.brgattr.static_offsets,
+                    brg.brgattr.static_offsets + brg.brgattr.max_bs);
+            value_brg.brgattr.static_offsets = value->static_offsets.data();
+        }
+
+        brgemm_kernel_t *kernel = nullptr;
+        const status_t status = brgemm_kernel_create(&kernel, value_brg);
+        if (status != status::success)
+            return kernel_cache::iface_t::result_t {nullptr, status};
+        value->kernel.reset(kernel);
+        std::shared_ptr<kernel_cache::value_impl_t> value_impl = value;
+        return kernel_cache::iface_t::result_t {value_impl, status};
+    };
+
+    kernel_cache::key_t key {std::make_shared<brgemm_kernel_key_t>(brg)};
+    auto result = kernel_cache::get().get_or_create(
+            key, *create, const_cast<brgemm_desc_t *>(&brg));
+    CHECK(result.status);
+
+    // The kernel shares the ownership of the cached value, so that it stays
+    // valid when the value is evicted from the cache.
+    auto value = std::static_pointer_cast<brgemm_kernel_value_t>(
+            result.value.release());
+    brg_kernel = std::shared_ptr<brgemm_kernel_t>(value, value->kernel.get());
+    return status::success;
+}
+
 status_t brgemm_init_tiles(const brgemm_desc_t &brg, char palette[64]) {
     if (!brg.is_tmm) return status::unimplemented;
 
@@ -743,6 +826,185 @@ status_t brgemm_init_tiles(const brgemm_desc_t &brg, char palette[64]) {
     return status::success;
 }
 
+// Non-pointer parameters of brgemm_desc_t and brgemm_attr_t that define a
+// kernel, derived parameters excluded. Used for both comparison and
+// serialization of descriptors to keep them consistent.
+#define BRGEMM_DESC_FIELDS(F) \
+    F(bcast_dim) \
+    F(load_dim) \
+    F(reduce_dim) \
+    F(LDA) \
+    F(LDB) \
+    F(LDC) \
+    F(LDD) \
+    F(isa_user) \
+    F(isa_impl) \
+    F(alpha) \
+    F(beta) \
+    F(dt_a) \
+    F(dt_b) \
+    F(dt_c) \
+    F(dt_d) \
+    F(dt_bias) \
+    F(stride_a) \
+    F(stride_b) \
+    F(layout) \
+    F(type) \
+    F(is_dgmm) \
+    F(with_sum) \
+    F(req_cal_comp_pads) \
+    F(sum_scale) \
+    F(sum_zp) \
+    F(sum_dt) \
+    F(with_eltwise) \
+    F(with_binary) \
+    F(zp_type_a) \
+    F(zp_type_b) \
+    F(zp_type_c) \
+    F(skip_scales) \
+    F(is_oc_scale) \
+    F(with_src_scales) \
+    F(is_src_scale_per_m) \
+    F(with_wei_scales) \
+    F(with_dst_scales) \
+    F(dt_wei_scales) \
+    F(bs_group) \
+    F(req_s8s8_compensation) \
+    F(skip_zp_b_compensation) \
+    F(with_weights_scale_adjust) \
+    F(brgattr.max_bs) \
+    F(brgattr.max_top_vpad) \
+    F(brgattr.max_bottom_vpad) \
+    F(brgattr.max_top_bpad) \
+    F(brgattr.max_bottom_bpad) \
+    F(brgattr.hint_expected_A_size) \
+    F(brgattr.hint_expected_B_size) \
+    F(brgattr.hint_expected_C_size) \
+    F(brgattr.hint_innermost_loop) \
+    F(brgattr.hint_loop_order) \
+    F(brgattr.hint_prefetching) \
+    F(brgattr.hint_prfA.dist0) \
+    F(brgattr.hint_prfA.dist1) \
+    F(brgattr.hint_prfA.dist2) \
+    F(brgattr.hint_prfA.distNTA) \
+    F(brgattr.hint_prfA.sprinkled) \
+    F(brgattr.hint_prfB.dist0) \
+    F(brgattr.hint_prfB.dist1) \
+    F(brgattr.hint_prfB.dist2) \
+    F(brgattr.hint_prfB.distNTA) \
+    F(brgattr.hint_prfB.sprinkled) \
+    F(brgattr.hint_prfC.dist0) \
+    F(brgattr.hint_prfC.dist1) \
+    F(brgattr.hint_prfC.dist2) \
+    F(brgattr.hint_prfC.distNTA) \
+    F(brgattr.hint_prfC.sprinkled) \
+    F(brgattr.wary_A_k_tail_read) \
+    F(brgattr.extendable_k) \
+    F(brgattr.generate_skip_accumulation) \
+    F(brgattr.bd_mask_level) \
+    F(brgattr.use_uker) \
+    F(brgattr.use_interleave_stores) \
+    F(brgattr.b_is_vnni) \
+    F(brgattr.fpmath_mode) \
+    F(brgattr.LDA2) \
+    F(brgattr.LDB2) \
+    F(brgattr.LDC2_M) \
+    F(brgattr.LDC2_N) \
+    F(brgattr.var_bs) \
+    F(brgattr.postops_only) \
+    F(brgattr.hint_bs_group) \
+    F(brgattr.hint_bd_block) \
+    F(brgattr.hint_ld_block) \
+    F(brgattr.hint_bd_block2) \
+    F(brgattr.hint_ld_block2) \
+    F(brgattr.hint_ununroll_bd_loop) \
+    F(brgattr.hint_load_nt_A) \
+    F(brgattr.hint_load_nt_B) \
+    F(brgattr.hint_fused_copy_a) \
+    F(brgattr.mem_advice) \
+    F(brgattr.K_koef)
+
+// Derived parameters of brgemm_desc_t. Most of them follow from the
+// parameters above, but some are set by the callers after the descriptor is
+// initialized, e.g. `is_gemv` by brgemv_desc_init(), or depend on blocking
+// decisions of a primitive, e.g. `fused_copy_a`. All of them define the
+// generated code, so they are compared and serialized as well, which keeps
+// the kernels shared through the kernel cache correct.
+#define BRGEMM_DESC_DERIVED_FIELDS(F) \
+    F(fused_copy_a) \
+    F(req_comp_pads_with_bcast) \
+    F(n_bcast_1_load) \
+    F(LDA2) \
+    F(LDB2) \
+    F(LDC2_M) \
+    F(LDC2_N) \
+    F(is_blocked) \
+    F(bdb) \
+    F(bd_block) \
+    F(bdb_tail) \
+    F(bdb2) \
+    F(bd_block2) \
+    F(bdb2_tail) \
+    F(ldb) \
+    F(ld_block) \
+    F(ldb_tail) \
+    F(ldb2) \
+    F(ld_block2) \
+    F(ldb2_tail) \
+    F(rdb) \
+    F(rd_block) \
+    F(rdb_tail) \
+    F(rd_step) \
+    F(ld_step) \
+    F(typesize_A) \
+    F(typesize_B) \
+    F(typesize_C) \
+    F(typesize_D) \
+    F(typesize_bias) \
+    F(is_ymm) \
+    F(is_zmm) \
+    F(is_tmm) \
+    F(is_int8) \
+    F(is_int8_tmm) \
+    F(is_bf16) \
+    F(is_bf16_tmm) \
+    F(is_bf16_emu) \
+    F(is_fp8) \
+    F(is_fp8_tmm) \
+    F(is_f16) \
+    F(is_f16_tmm) \
+    F(is_f32) \
+    F(is_bf32) \
+    F(is_tf32) \
+    F(has_int8_vnni) \
+    F(load_nt_A) \
+    F(load_nt_B) \
+    F(embd_bcst) \
+    F(with_bias) \
+    F(innermost_loop) \
+    F(is_M_tail) \
+    F(interleave_tilestores_) \
+    F(prfA.dist0) \
+    F(prfA.dist1) \
+    F(prfA.dist2) \
+    F(prfA.distNTA) \
+    F(prfA.sprinkled) \
+    F(prfB.dist0) \
+    F(prfB.dist1) \
+    F(prfB.dist2) \
+    F(prfB.distNTA) \
+    F(prfB.sprinkled) \
+    F(prfC.dist0) \
+    F(prfC.dist1) \
+    F(prfC.dist2) \
+    F(prfC.distNTA) \
+    F(prfC.sprinkled) \
+    F(is_runtime_lda) \
+    F(is_runtime_ldb) \
+    F(is_runtime_ldc) \
+    F(is_runtime_ldd) \
+    F(is_gemv)
+
 namespace {
 template <typename T>
 inline int sign(T v) {
@@ -753,110 +1015,25 @@ int brgemm_cmp(const brgemm_desc_t &lhs, const brgemm_desc_t &rhs) {
     // The macro CMP_BRGEMM_FIELD is designed to compare numerical parameters.
     // Float parameters must not be NaN
 #define CMP_BRGEMM_FIELD(x) \
-    if ((lhs.x) != (rhs.x)) return sign((lhs.x) - (rhs.x))
+    if ((lhs.x) != (rhs.x)) return sign((lhs.x) - (rhs.x));
 
     // This function compares brgemm_desc_t objects within a single brgemm primitive.
     // Comparison of objects from different primitives is not guaranteed due to
     // dependencies of brgemm descriptor on a primitive attributes.
 
-    // Compare all non-pointer parameters of brgemm_desc_t except derived
-    CMP_BRGEMM_FIELD(bcast_dim);
-    CMP_BRGEMM_FIELD(load_dim);
-    CMP_BRGEMM_FIELD(reduce_dim);
-    CMP_BRGEMM_FIELD(LDA);
-    CMP_BRGEMM_FIELD(LDB);
-    CMP_BRGEMM_FIELD(LDC);
-    CMP_BRGEMM_FIELD(LDD);
-    CMP_BRGEMM_FIELD(isa_user);
-    CMP_BRGEMM_FIELD(isa_impl);
-    CMP_BRGEMM_FIELD(alpha);
-    CMP_BRGEMM_FIELD(beta);
-    CMP_BRGEMM_FIELD(dt_a);
-    CMP_BRGEMM_FIELD(dt_b);
-    CMP_BRGEMM_FIELD(dt_c);
-    CMP_BRGEMM_FIELD(dt_d);
-    CMP_BRGEMM_FIELD(dt_bias);
-    CMP_BRGEMM_FIELD(stride_a);
-    CMP_BRGEMM_FIELD(stride_b);
-    CMP_BRGEMM_FIELD(layout);
-    CMP_BRGEMM_FIELD(type);
-    CMP_BRGEMM_FIELD(is_dgmm);
-    CMP_BRGEMM_FIELD(with_sum);
-    CMP_BRGEMM_FIELD(req_cal_comp_pads);
-
-    CMP_BRGEMM_FIELD(sum_scale);
-    CMP_BRGEMM_FIELD(sum_zp);
-    CMP_BRGEMM_FIELD(sum_dt);
-    CMP_BRGEMM_FIELD(with_eltwise);
-    CMP_BRGEMM_FIELD(with_binary);
-
-    CMP_BRGEMM_FIELD(zp_type_a);
-    CMP_BRGEMM_FIELD(zp_type_b);
-    CMP_BRGEMM_FIELD(zp_type_c);
-
-    CMP_BRGEMM_FIELD(skip_scales);
-    CMP_BRGEMM_FIELD(is_oc_scale);
-    CMP_BRGEMM_FIELD(with_src_scales);
-    CMP_BRGEMM_FIELD(with_wei_scales);
-    CMP_BRGEMM_FIELD(with_dst_scales);
-    CMP_BRGEMM_FIELD(dt_wei_scales);
-    CMP_BRGEMM_FIELD(bs_group);
-
-    // Compare all non-pointer parameters of brgemm_attr_t except derived
-    CMP_BRGEMM_FIELD(brgattr.max_bs);
-    CMP_BRGEMM_FIELD(brgattr.max_top_vpad);
-    CMP_BRGEMM_FIELD(brgattr.max_bottom_vpad);
-    CMP_BRGEMM_FIELD(brgattr.max_top_bpad);
-    CMP_BRGEMM_FIELD(brgattr.max_bottom_bpad);
-    CMP_BRGEMM_FIELD(brgattr.hint_expected_A_size);
-    CMP_BRGEMM_FIELD(brgattr.hint_expected_B_size);
-    CMP_BRGEMM_FIELD(brgattr.hint_expected_C_size);
-    CMP_BRGEMM_FIELD(brgattr.hint_innermost_loop);
-    CMP_BRGEMM_FIELD(brgattr.hint_loop_order);
-    CMP_BRGEMM_FIELD(brgattr.hint_prefetching);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfA.dist1);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfA.dist2);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfA.sprinkled);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfB.dist1);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfB.dist2);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfB.sprinkled);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfC.dist1);
-    CMP_BRGEMM_FIELD(brgattr.hint_prfC.dist2);
-    CMP_BRGEMM_FIELD(brgattr.wary_A_k_tail_read);
-    CMP_BRGEMM_FIELD(brgattr.extendable_k);
-    CMP_BRGEMM_FIELD(brgattr.generate_skip_accumulation);
-    CMP_BRGEMM_FIELD(brgattr.bd_mask_level);
-    CMP_BRGEMM_FIELD(brgattr.use_uker);
-    CMP_BRGEMM_FIELD(brgattr.use_interleave_stores);
-    CMP_BRGEMM_FIELD(brgattr.b_is_vnni);
-    CMP_BRGEMM_FIELD(brgattr.fpmath_mode);
-    CMP_BRGEMM_FIELD(brgattr.LDA2);
-    CMP_BRGEMM_FIELD(brgattr.LDB2);
-    CMP_BRGEMM_FIELD(brgattr.LDC2_M);
-    CMP_BRGEMM_FIELD(brgattr.LDC2_N);
-    CMP_BRGEMM_FIELD(brgattr.var_bs);
-    CMP_BRGEMM_FIELD(brgattr.postops_only);
-    CMP_BRGEMM_FIELD(brgattr.hint_bs_group);
-
-    CMP_BRGEMM_FIELD(brgattr.hint_bd_block);
-    CMP_BRGEMM_FIELD(brgattr.hint_ld_block);
-    CMP_BRGEMM_FIELD(brgattr.hint_bd_block2);
-    CMP_BRGEMM_FIELD(brgattr.hint_ld_block2);
-    CMP_BRGEMM_FIELD(brgattr.hint_ununroll_bd_loop);
-
-    CMP_BRGEMM_FIELD(brgattr.hint_load_nt_A);
-    CMP_BRGEMM_FIELD(brgattr.hint_load_nt_B);
-    CMP_BRGEMM_FIELD(brgattr.K_koef);
+    // Compare all non-pointer parameters
+    BRGEMM_DESC_FIELDS(CMP_BRGEMM_FIELD)
+    BRGEMM_DESC_DERIVED_FIELDS(CMP_BRGEMM_FIELD)
 
     if (lhs.brgattr.bd_mask_level > 0)
         for (int i = 0; i < lhs.bcast_dim; i++) {
-            CMP_BRGEMM_FIELD(brgattr.bd_mask[i]);
+            CMP_BRGEMM_FIELD(brgattr.bd_mask[i])
         }
 
     if (lhs.type == brgemm_static_offs)
         for (int i = 0; i < lhs.brgattr.max_bs; i++) {
-            CMP_BRGEMM_FIELD(brgattr.static_offsets[i].offset.A);
-            CMP_BRGEMM_FIELD(brgattr.static_offsets[i].offset.B);
+            CMP_BRGEMM_FIELD(brgattr.static_offsets[i].offset.A)
+            CMP_BRGEMM_FIELD(brgattr.static_offsets[i].offset.B)
         }
 
 #undef CMP_BRGEMM_FIELD
@@ -872,6 +1049,29 @@ bool brgemm_desc_t::operator<(const brgemm_desc_t &rhs) const {
     return (brgemm_cmp(*this, rhs) < 0);
 }
 
+void brgemm_desc_t::serialize(serialization_stream_t &sstream) const {
+#define APPEND_BRGEMM_FIELD(x) sstream.append(x);
+    BRGEMM_DESC_FIELDS(APPEND_BRGEMM_FIELD)
+    BRGEMM_DESC_DERIVED_FIELDS(APPEND_BRGEMM_FIELD)
+#undef APPEND_BRGEMM_FIELD
+
+    if (brgattr.bd_mask_level > 0)
+        sstream.append_array(bcast_dim, brgattr.bd_mask);
+
+    if (type == brgemm_static_offs)
+        for (int i = 0; i < brgattr.max_bs; i++) {
+            sstream.append(brgattr.static_offsets[i].offset.A);
+            sstream.append(brgattr.static_offsets[i].offset.B);
+        }
+
+    // Post-ops and the destination descriptor are a part of the primitive
+    // a kernel belongs to but may be adjusted per kernel.
+    sstream.append(attr_ != nullptr);
+    if (attr_) dnnl::impl::serialize(sstream, *attr_);
+    sstream.append(dst_md_ != nullptr);
+    if (dst_md_) dnnl::impl::serialize(sstream, *dst_md_);
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
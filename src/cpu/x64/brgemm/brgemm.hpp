@@ -17,6 +17,8 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_HPP
 #define CPU_X64_BRGEMM_BRGEMM_HPP
 
+#include <memory>
+
 #include "cpu/x64/brgemm/brgemm_types.hpp"
 
 namespace dnnl {
@@ -178,6 +180,20 @@ status_t DNNL_API brgemm_desc_finalize(brgemm_desc_t *brg);
 status_t DNNL_API brgemm_kernel_create(
         brgemm_kernel_t **brg_kernel, const brgemm_desc_t &brg);
 
+/// Returns a BRGEMM kernel for a descriptor from the global kernel cache
+///
+/// @note
+///     The kernel is generated on a cache miss only, and it is shared by all
+///     the callers with equal descriptors, e.g. by different primitives.
+///     The descriptors are compared including their attributes and
+///     destination memory descriptor.
+///
+/// @param brg_kernel Output BRGEMM kernel
+/// @param brg BRGEMM descriptor
+///
+status_t DNNL_API brgemm_kernel_get_or_create(
+        std::shared_ptr<brgemm_kernel_t> &brg_kernel, const brgemm_desc_t &brg);
+
 /// Destroys a BRGEMM kernel
 ///
 /// @param brg_kernel BRGEMM kernel
@@ -26,19 +26,6 @@ using namespace dnnl::impl::utils;
 
 namespace brgemm_containers {
 
-std::set<std::shared_ptr<brgemm_kernel_t>,
-        decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-brgemm_kernel_container_t::get_set() {
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
-            set_ = std::set<std::shared_ptr<brgemm_kernel_t>,
-                    decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
-                    brgemm_kernel_container_t::brgemm_kernel_cmp);
-#endif
-    return set_;
-}
-
 bool brgemm_desc_container_t::insert(int idx, brgemm_desc_t &brg,
         const std::vector<char> &bd_mask,
         const std::vector<brgemm_batch_element_t> &static_offsets) {
@@ -104,17 +91,15 @@ status_t brgemm_kernel_container_t::insert(int idx, const brgemm_desc_t *brg) {
     // Use two level hashing of brgemm kernels:
     // 1. Try to find entry in local brgemm_map_ using brgemm descriptor as a
     // key (we can check if brgemm descriptor is unique inside brgemm primitive)
-    // 2. Only if we do not find entry in local brgemm_map_  then try to find
-    // entry in kernel storage using kernel code as key
+    // 2. Only if we do not find entry in local brgemm_map_  then get the
+    // kernel from the global kernel cache and find entry in kernel storage
+    // using kernel code as key
     const auto brgemm_it = brgemm_map_.find(brg);
     if (brgemm_it == brgemm_map_.end()) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
-        std::shared_ptr<brgemm_kernel_t> sptr(brg_kernel);
-        lock_write();
-        const auto kernel_ret = get_set().insert(sptr);
+        std::shared_ptr<brgemm_kernel_t> sptr;
+        CHECK(brgemm_kernel_get_or_create(sptr, *brg));
+        const auto kernel_ret = set_.insert(sptr);
         refs_[idx] = kernel_ret.first->get();
-        unlock_write();
         const auto brgemm_ret = brgemm_map_.insert({brg, refs_[idx]});
         if (!brgemm_ret.second) return status::runtime_error;
     } else {
@@ -18,7 +18,6 @@
 #define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
 
 #include <set>
-#include "common/rw_mutex.hpp"
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
 
@@ -67,9 +66,8 @@ private:
     std::vector<std::vector<brgemm_batch_element_t>> static_offsets_list_;
 };
 
-// global storage disabled for now
-// #define BRGEMM_KERNEL_GLOBAL_STORAGE
-
+// The kernels are taken from the global kernel cache, which shares them with
+// other primitives, see brgemm_kernel_get_or_create().
 struct brgemm_kernel_container_t {
     brgemm_kernel_container_t() = default;
     brgemm_kernel_container_t(size_t ns) { resize(ns); }
@@ -84,29 +82,12 @@ struct brgemm_kernel_container_t {
 
 private:
     std::vector<const brgemm_kernel_t *> refs_;
-#ifdef BRGEMM_KERNEL_GLOBAL_STORAGE
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
-
-#else
     std::set<std::shared_ptr<brgemm_kernel_t>,
             decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>
             set_ {std::set<std::shared_ptr<brgemm_kernel_t>,
                     decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *>(
                     brgemm_kernel_container_t::brgemm_kernel_cmp)};
 
-    void lock_write() {}
-    void unlock_write() {}
-#endif
-    std::set<std::shared_ptr<brgemm_kernel_t>,
-            decltype(brgemm_kernel_container_t::brgemm_kernel_cmp) *> &
-    get_set();
-
     std::map<const brgemm_desc_t *, const brgemm_kernel_t *> brgemm_map_;
 };
 
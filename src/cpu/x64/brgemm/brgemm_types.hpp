@@ -18,6 +18,7 @@
 #define CPU_X64_BRGEMM_BRGEMM_TYPES_HPP
 
 #include "common/primitive_attr.hpp"
+#include "common/serialization.hpp"
 #include "cpu/platform.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/jit_generator.hpp"
@@ -299,6 +300,9 @@ struct brgemm_desc_t {
     bool skip_scales = false;
     int is_oc_scale = 0;
     bool with_src_scales = false;
+    // Source scales are provided per row of matrix A (M dimension) rather
+    // than as a single common value. Supported by non-AMX gemm kernels only.
+    bool is_src_scale_per_m = false;
     bool with_wei_scales = false;
     // `dst_scales` passed as a bare pointer making kernel change multiplication
     // to division was proved to be significantly slower, both for pure divps
@@ -564,6 +568,10 @@ struct brgemm_desc_t {
     bool operator==(const brgemm_desc_t &rhs) const;
     bool operator<(const brgemm_desc_t &rhs) const;
 
+    // Serializes the parameters defining the kernel generated for the
+    // descriptor.
+    void serialize(serialization_stream_t &sstream) const;
+
 private:
     primitive_attr_t *attr_ {nullptr};
     memory_desc_t *dst_md_ {nullptr};
@@ -732,6 +740,9 @@ private:
 ///     A zero point only and skip the rest post-ops.
 /// @param zp_a_val - zero point value for A, required to adjust compensation
 ///     values if do_only_zp_a_val = true.
+/// @param src_scales - Vector of scale factor values for matrix A. If
+///     brgemm_desc_t::is_src_scale_per_m = true vector length is M, otherwise
+///     a single common value is used.
 /// @param dst_scales - Vector of inverted scale factor values for matix C,
 ///     common scale vector type only is supported, it must be broadcasted to
 ///     vector of simd width length.
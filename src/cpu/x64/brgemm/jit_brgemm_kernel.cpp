@@ -144,6 +144,26 @@ struct jit_brgemm_kernel_t : public jit_base_brgemm_kernel_t {
 
     const brgemm_desc_t &get_brg() const override { return brg; }
 
+protected:
+    bool serialize_jit_cache_id(
+            serialization_stream_t &sstream) const override {
+        // The sum post-op, the `pow` eltwise post-op and the saturation with
+        // vpermb embed addresses of data and functions into the code.
+        if (brg.with_sum) return false;
+        if (brg.with_eltwise)
+            for (const auto &e : brg.attr()->post_ops_.entry_)
+                if (e.is_eltwise() && e.eltwise.alg == alg_kind::eltwise_pow)
+                    return false;
+        if (one_of(brg.dt_d, data_type::u8, data_type::s8, data_type::s32)
+                && isa_has_sat_cvt(brg.isa_impl, brg.dt_d))
+            return false;
+
+        sstream.append(brg);
+        sstream.append(vreg_traits_t<Vmm>::vlen);
+        sstream.append(std::is_same<Wmm, Xbyak::Tmm>::value);
+        return true;
+    }
+
 private:
     brgemm_desc_t brg;
 
@@ -859,6 +879,12 @@ void jit_brgemm_kernel_t<Wmm>::advance_bd_block2_post_op_regs(dim_t bd_block2) {
         add(reg_zp_comp_b, bdb_zp_comp_b_offset(bd_block2));
         reg_zp_comp_b.save();
     }
+
+    if (brg.is_src_scale_per_m) {
+        reg_src_scales.restore();
+        add(reg_src_scales, bd_block2 * brg.bd_block * sizeof(float));
+        reg_src_scales.save();
+    }
 }
 
 template <typename Wmm>
@@ -1311,7 +1337,7 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
     if (brg.with_src_scales) {
         reg_src_scales.restoreTo(reg_aux_src_scales);
         auto vmm_src_scales = vmm_tmp(0);
-        if (!has_ptr_b_support)
+        if (!has_ptr_b_support && !brg.is_src_scale_per_m)
             vbroadcastss(vmm_src_scales, ptr[reg_aux_src_scales]);
 
         for_(dim_t ld = 0; ld < ld_block2; ld++)
@@ -1319,8 +1345,16 @@ void jit_brgemm_kernel_t<Wmm>::store_accumulators_apply_post_ops(dim_t bd_block,
             auto vmm = accm(ld_block2, bd, ld);
             if (dq2ps_required && !dq2ps_cvt_done) uni_vcvtdq2ps(vmm, vmm);
 
+            // Per-row scales: every row of the block has its own value.
+            const dim_t src_scales_offset
+                    = brg.is_src_scale_per_m ? bd * sizeof(float) : 0;
             if (has_ptr_b_support) {
-                vmulps(vmm, vmm, ptr_b[reg_aux_src_scales]);
+                vmulps(vmm, vmm,
+                        ptr_b[reg_aux_src_scales + src_scales_offset]);
+            } else if (brg.is_src_scale_per_m) {
+                vbroadcastss(vmm_src_scales,
+                        ptr[reg_aux_src_scales + src_scales_offset]);
+                vmulps(vmm, vmm, vmm_src_scales);
             } else {
                 vmulps(vmm, vmm, vmm_src_scales);
             }
@@ -21,6 +21,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/cpu_tuning.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
@@ -83,8 +84,14 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(attr_scales_ok());
     CHECK(attr_zero_points_ok());
 
+    if (tuning_candidate_ < 0 && tuning_db::is_enabled())
+        CHECK(tuning::pick_candidate<brgemm_1x1_convolution_fwd_t>(this, engine,
+                brgemm_convolution_utils::brgemm_conv_n_tuning_candidates,
+                tuning_candidate_));
+
     CHECK(brgemm_convolution_utils::init_1x1_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads(),
+            tuning_candidate_));
 
     brgs_ = std::make_shared<brgemm_containers::brgemm_desc_container_t>(32);
 
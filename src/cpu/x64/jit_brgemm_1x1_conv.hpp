@@ -51,6 +51,9 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
                 brgemm_1x1_convolution_fwd_t);
 
         status_t init(engine_t *engine);
+        void set_tuning_candidate(int candidate) {
+            tuning_candidate_ = candidate;
+        }
 
         struct brgemm_init_params_t {
             brgemm_init_params_t(int k_accum_idx, int m, int n, int k,
@@ -76,6 +79,9 @@ struct brgemm_1x1_convolution_fwd_t : public primitive_t {
         jit_brgemm_conv_conf_t jcp_ = utils::zero<decltype(jcp_)>();
 
     private:
+        // Blocking candidate of the runtime autotuning, -1 for the heuristic.
+        int tuning_candidate_ = -1;
+
         status_t init_brgemm_desc();
     };
 
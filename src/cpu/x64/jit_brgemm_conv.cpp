@@ -19,6 +19,7 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/cpu_tuning.hpp"
 
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/jit_brgemm_conv.hpp"
@@ -387,8 +388,14 @@ status_t brgemm_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
             impl::is_dense_format_kind({src_md(0), weights_md(0), dst_md(0)}),
             VERBOSE_UNSUPPORTED_SPARSE_CFG);
 
+    if (tuning_candidate_ < 0 && tuning_db::is_enabled())
+        CHECK(tuning::pick_candidate<brgemm_convolution_fwd_t>(this, engine,
+                brgemm_convolution_utils::brgemm_conv_n_tuning_candidates,
+                tuning_candidate_));
+
     CHECK(brgemm_convolution_utils::init_conf(jcp_, isa, *desc(), src_md_,
-            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads()));
+            weights_md_, dst_md_, bias_md_, attr_, dnnl_get_max_threads(),
+            tuning_candidate_));
 
     // 1. The unrolled kernel can be used for exec_trans and exec_base and for
     // amx only. For exec_base it makes sense to use unrolled kernel only if
@@ -1382,6 +1389,13 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     maybe_conv_weights(ctx, wei, wei);
 
+    // The relocated weights are in the scratchpad and change with each
+    // execution, so that they are not replicated.
+    std::shared_ptr<const weights_replicas_t> wei_replicas;
+    if (_pd->attr()->weights_replication_ && !is_relo_with_relo_weights
+            && platform::get_num_numa_nodes() > 1)
+        get_weights_replicas(wei, weights_d.size(), wei_replicas);
+
     // --------------- Parallel section ------------------------------
     const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
             * jcp.nb_oc * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
@@ -1390,6 +1404,13 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
     // or made ic_chunks = 1 if use_buffer
     // or (looks more general) increase buffer size to store several rows
 
+    // On hybrid CPUs the work is distributed according to the throughput of
+    // the threads. Weights are not used when some threads have no work, as
+    // such threads leave the parallel section right away.
+    const float *thread_weights = work_amount >= jcp.nthr
+            ? platform::get_thread_weights(jcp.nthr)
+            : nullptr;
+
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         if (ithr >= work_amount) return;
 
@@ -1402,8 +1423,11 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                 ? wsp_tile_global + ithr * jcp.amx_buf_size_per_thread
                 : nullptr;
 
+        const char *thr_wei = wei_replicas
+                ? wei_replicas->local(wei, platform::get_numa_node())
+                : wei;
         brgemm_thread_ctx_t btc(
-                brgemm_ctx, ithr, brg_batch, c_buffer, wsp_tile, wei);
+                brgemm_ctx, ithr, brg_batch, c_buffer, wsp_tile, thr_wei);
         brgemm_thread_ctx_t last_btc = btc;
 
         float *dst_scales_inv_ptr = nullptr;
@@ -1435,7 +1459,7 @@ status_t brgemm_convolution_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
         btc.input = jcp.copy_input ? btc.inp_buffer : src;
 
         dim_t start {0}, end {0};
-        balance211(work_amount, nthr, ithr, start, end);
+        balance211(work_amount, nthr, ithr, thread_weights, start, end);
 
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
         BRGEMM_CONV_ITERATOR_INIT;
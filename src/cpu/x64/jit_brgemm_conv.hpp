@@ -27,6 +27,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/cpu_weights_replicas.hpp"
 #include "cpu/platform.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -58,6 +59,9 @@ struct brgemm_convolution_fwd_t : public primitive_t {
                 brgemm_convolution_fwd_t);
 
         status_t init(engine_t *engine);
+        void set_tuning_candidate(int candidate) {
+            tuning_candidate_ = candidate;
+        }
 
         int brgs_sz_;
         std::shared_ptr<brgemm_containers::brgemm_desc_container_t>
@@ -128,6 +132,8 @@ struct brgemm_convolution_fwd_t : public primitive_t {
                 bool do_init, int kd_b, int kd_e, int kh_b, int kh_e);
 
     protected:
+        // Blocking candidate of the runtime autotuning, -1 for the heuristic.
+        int tuning_candidate_ = -1;
         int KD, KH, KW, EXT_KD, EXT_KH, EXT_KW, KS, KD_BLOCK, KH_BLOCK,
                 KW_BLOCK, KD_BLOCK_PAD, KH_BLOCK_PAD, ID, IH, IW, IDP, IHP, IWP,
                 OD, OH, OW, SD, SH, SW, FP, TP, LP, DD, DH, DW;
@@ -1996,7 +1996,8 @@ void adjust_nthr(jit_brgemm_conv_conf_t &jcp, const memory_desc_wrapper &src_d,
 status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads) {
+        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads,
+        int tuning_candidate) {
 
     using namespace prop_kind;
     // disabling verbose dispatch messages for unsupported isa for better readability
@@ -2077,6 +2078,12 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         start_ocb = nstl::min(div_up(jcp.oc, jcp.acc_simd_w), start_ocb);
 
         auto finish_ocb = 1;
+        if (tuning_candidate > 0) {
+            if (tuning_candidate >= brgemm_conv_n_tuning_candidates
+                    || tuning_candidate > div_up(jcp.oc, jcp.acc_simd_w))
+                return false;
+            start_ocb = finish_ocb = tuning_candidate;
+        }
         for (auto ocb = start_ocb; ocb >= finish_ocb; ocb--) {
             brg_blocking_t cur_brgb = zero<decltype(best_brgb)>();
             cur_brgb.get_from_jcp(jcp);
@@ -2476,7 +2483,8 @@ status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
 status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads) {
+        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads,
+        int tuning_candidate) {
 
     using namespace prop_kind;
     // disabling verbose dispatch messages for unsupported isa for better readability
@@ -2549,6 +2557,12 @@ status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     if (jcp.wei_plain && is_os_blocking_ok) {
         start_ocb = div_up(jcp.oc, jcp.acc_simd_w);
     }
+    if (tuning_candidate > 0) {
+        VDISPATCH_CONV_IC(tuning_candidate < brgemm_conv_n_tuning_candidates
+                        && tuning_candidate <= div_up(jcp.oc, jcp.acc_simd_w),
+                VERBOSE_BLOCKING_FAIL, "tuning candidate is not applicable");
+        start_ocb = finish_ocb = tuning_candidate;
+    }
 
     for (auto ocb = start_ocb; ocb >= finish_ocb; ocb--) {
         brg_blocking_t cur_brgb = zero<decltype(cur_brgb)>();
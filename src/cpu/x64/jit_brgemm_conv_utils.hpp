@@ -41,15 +41,22 @@ bool is_amx(cpu_isa_t isa);
 bool uses_batch_elements(
         brgemm_batch_kind_t brg_type, conv_brgemm_exec_type_t exec_type);
 
+// Number of blocking candidates explored by the runtime autotuning. Candidate
+// 0 is the blocking chosen by the heuristic, candidate `c > 0` forces the
+// output channels block to `c` SIMD widths.
+constexpr int brgemm_conv_n_tuning_candidates = 5;
+
 status_t init_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads);
+        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads,
+        int tuning_candidate = -1);
 
 status_t init_1x1_conf(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
         const convolution_desc_t &cd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads);
+        memory_desc_t &bias_md, primitive_attr_t &attr, int nthreads,
+        int tuning_candidate = -1);
 
 void set_amx_wsp_per_thread(jit_brgemm_conv_conf_t &jcp);
 
@@ -0,0 +1,643 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+namespace {
+
+// Copies an `D x n_cur` block of keys into a `[D / g][N_blk][g]` buffer
+// expected by the brgemm kernel.
+template <typename T>
+void copy_k_block(T *buf, const T *k, dim_t D, dim_t n_cur, dim_t N_blk,
+        dim_t ld_d, dim_t ld_n, int g) {
+    for (dim_t d = 0; d < D; d++) {
+        T *buf_d = buf + (d / g) * N_blk * g + d % g;
+        const T *k_d = k + d * ld_d;
+        for (dim_t n = 0; n < n_cur; n++)
+            buf_d[n * g] = k_d[n * ld_n];
+    }
+}
+
+// Copies an `n_cur x Dv` block of values into a `[LDP / g][Dv][g]` buffer
+// expected by the brgemm kernel. Rows past `n_cur` are zero-padded up to the
+// VNNI granularity.
+template <typename T>
+void copy_v_block(T *buf, const T *v, dim_t n_cur, dim_t Dv, dim_t ld_n,
+        dim_t ld_v, int g) {
+    const dim_t n_padded = rnd_up(n_cur, g);
+    for (dim_t n = 0; n < n_padded; n++) {
+        T *buf_n = buf + (n / g) * Dv * g + n % g;
+        const T *v_n = v + n * ld_n;
+        for (dim_t j = 0; j < Dv; j++)
+            buf_n[j * g] = n < n_cur ? v_n[j * ld_v] : T(0);
+    }
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+jit_brgemm_sdpa_softmax_t<isa>::jit_brgemm_sdpa_softmax_t(
+        const brgemm_sdpa_conf_t &conf, dim_t n_cur)
+    : jit_generator_t(jit_name()), conf_(conf), n_cur_(n_cur) {
+    exp_injector_ = utils::make_unique<jit_uni_eltwise_injector_t<isa>>(this,
+            alg_kind::eltwise_exp, 0.f, 0.f, 1.f, data_type::f32,
+            /* save_state = */ false, reg_table, Opmask(1));
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_t<isa>::load_mask(
+        const Vmm &vmm, int i, int tail) {
+    const int sz = static_cast<int>(types::data_type_size(conf_.mask_dt));
+    // The elements of a tail are copied to the stack not to read past the
+    // row, the rest of the vector is ignored.
+    for (int k = 0; k < tail; k++) {
+        const int off = (i * simd_w_ + k) * sz;
+        if (sz == 2) {
+            mov(reg_tmp.cvt16(), word[reg_mask + off]);
+            mov(word[rsp + k * sz], reg_tmp.cvt16());
+        } else {
+            mov(reg_tmp.cvt32(), dword[reg_mask + off]);
+            mov(dword[rsp + k * sz], reg_tmp.cvt32());
+        }
+    }
+    const Address addr
+            = tail > 0 ? ptr[rsp] : ptr[reg_mask + i * simd_w_ * sz];
+    switch (conf_.mask_dt) {
+        case data_type::f32: uni_vmovups(vmm, addr); break;
+        case data_type::bf16:
+            vpmovzxwd(vmm, addr);
+            vpslld(vmm, vmm, 16);
+            break;
+        case data_type::f16: vcvtph2ps(vmm, addr); break;
+        default: assert(!"unsupported mask data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_t<isa>::store_probs(const Vmm &vmm, int i) {
+    const int sz = static_cast<int>(types::data_type_size(conf_.dt));
+    switch (conf_.dt) {
+        case data_type::f32:
+            uni_vmovups(ptr[reg_scores + i * simd_w_ * sz], vmm);
+            break;
+        case data_type::bf16: {
+            const Ymm ymm = Ymm(vmm.getIdx());
+            vcvtneps2bf16(ymm, vmm);
+            vmovdqu16(ptr[reg_probs + i * simd_w_ * sz], ymm);
+            break;
+        }
+        case data_type::f16:
+            vcvtps2ph(ptr[reg_probs + i * simd_w_ * sz], vmm, _op_mxcsr);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_t<isa>::reduce(const Vmm &vmm, bool is_max) {
+    const auto op = [&]() {
+        if (is_max)
+            uni_vmaxps(vmm, vmm, vmm_tmp);
+        else
+            uni_vaddps(vmm, vmm, vmm_tmp);
+    };
+    if (is_superset(isa, avx512_core)) {
+        const Zmm zmm = Zmm(vmm.getIdx());
+        const Zmm zmm_tmp = Zmm(vmm_tmp.getIdx());
+        vshuff32x4(zmm_tmp, zmm, zmm, 0x4E);
+        op();
+        vshuff32x4(zmm_tmp, zmm, zmm, 0xB1);
+        op();
+    } else {
+        vperm2f128(Ymm(vmm_tmp.getIdx()), Ymm(vmm.getIdx()),
+                Ymm(vmm.getIdx()), 0x1);
+        op();
+    }
+    uni_vshufps(vmm_tmp, vmm, vmm, 0x4E);
+    op();
+    uni_vshufps(vmm_tmp, vmm, vmm, 0xB1);
+    op();
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_softmax_t<isa>::generate() {
+    const int n_vecs = static_cast<int>(div_up(n_cur_, simd_w_));
+    const int mask_tail = static_cast<int>(n_cur_ % simd_w_);
+    const Xmm xmm_data = Xmm(vmm_data.getIdx());
+    const Xmm xmm_tmp = Xmm(vmm_tmp.getIdx());
+    const Xmm xmm_red = Xmm(vmm_red.getIdx());
+    const Xmm xmm_neg_inf = Xmm(vmm_neg_inf.getIdx());
+    const Xmm xmm_limit = Xmm(vmm_limit.getIdx());
+    const Xmm xmm_shift = Xmm(vmm_shift.getIdx());
+    const Xmm xmm_corr = Xmm(vmm_corr.getIdx());
+    const auto scores_ptr = [&](int i) {
+        return ptr[reg_scores + i * simd_w_ * sizeof(float)];
+    };
+
+    preamble();
+    sub(rsp, simd_w_ * sizeof(float));
+
+#define GET_OFF(field) offsetof(call_params_t, field)
+    mov(reg_scores, ptr[reg_param + GET_OFF(scores)]);
+    mov(reg_probs, ptr[reg_param + GET_OFF(probs)]);
+    mov(reg_mask, ptr[reg_param + GET_OFF(mask)]);
+    mov(reg_acc, ptr[reg_param + GET_OFF(acc)]);
+    mov(reg_max, ptr[reg_param + GET_OFF(max)]);
+    mov(reg_sum, ptr[reg_param + GET_OFF(sum)]);
+    uni_vbroadcastss(vmm_scale, ptr[reg_param + GET_OFF(scale)]);
+    mov(reg_tmp, ptr[reg_param + GET_OFF(n_vis)]);
+#undef GET_OFF
+    uni_vxorps(xmm_limit, xmm_limit, xmm_limit);
+    vcvtsi2ss(xmm_limit, xmm_limit, reg_tmp);
+    uni_vbroadcastss(vmm_limit, xmm_limit);
+
+    exp_injector_->load_table_addr();
+    mov(reg_tmp, float2int(-INFINITY));
+    uni_vmovq(xmm_neg_inf, reg_tmp);
+    uni_vbroadcastss(vmm_neg_inf, xmm_neg_inf);
+    mov(reg_tmp, float2int(static_cast<float>(simd_w_)));
+    uni_vmovq(xmm_tmp, reg_tmp);
+    uni_vbroadcastss(vmm_step, xmm_tmp);
+    uni_vmovups(vmm_lane, ptr[rip + l_lane_idx_]);
+
+    // Scaled and masked scores and their maximum. Keys past the visible ones
+    // are set to -inf to get a zero probability.
+    uni_vmovups(vmm_red, vmm_neg_inf);
+    for (int i = 0; i < n_vecs; i++) {
+        uni_vmovups(vmm_data, scores_ptr(i));
+        uni_vmulps(vmm_data, vmm_data, vmm_scale);
+        if (conf_.with_mask) {
+            load_mask(vmm_tmp, i, i == n_vecs - 1 ? mask_tail : 0);
+            uni_vaddps(vmm_data, vmm_data, vmm_tmp);
+        }
+        if (is_superset(isa, avx512_core)) {
+            vcmpps(k_vis, vmm_lane, vmm_limit, _cmp_lt_os);
+            vblendmps(vmm_data | k_vis, vmm_neg_inf, vmm_data);
+        } else {
+            uni_vcmpps(vmm_tmp, vmm_lane, vmm_limit, _cmp_lt_os);
+            uni_vblendvps(vmm_data, vmm_neg_inf, vmm_data, vmm_tmp);
+        }
+        uni_vaddps(vmm_lane, vmm_lane, vmm_step);
+        uni_vmovups(scores_ptr(i), vmm_data);
+        uni_vmaxps(vmm_red, vmm_red, vmm_data);
+    }
+    reduce(vmm_red, true);
+
+    // The probabilities are computed relative to the updated maximum, or to 0
+    // if all the keys seen so far are masked out. The accumulated values are
+    // corrected by exp(old_max - new_max).
+    vmovss(xmm_data, ptr[reg_max]);
+    vmaxss(xmm_red, xmm_red, xmm_data);
+    vmovss(ptr[reg_max], xmm_red);
+    vcmpss(xmm_tmp, xmm_red, xmm_neg_inf, _cmp_neq_uq);
+    vandps(xmm_shift, xmm_red, xmm_tmp);
+    vsubss(xmm_corr, xmm_data, xmm_shift);
+    uni_vbroadcastss(vmm_shift, xmm_shift);
+    uni_vbroadcastss(vmm_corr, xmm_corr);
+    exp_injector_->compute_vector(vmm_corr.getIdx());
+
+    uni_vxorps(vmm_red, vmm_red, vmm_red);
+    for (int i = 0; i < n_vecs; i++) {
+        uni_vmovups(vmm_data, scores_ptr(i));
+        uni_vsubps(vmm_data, vmm_data, vmm_shift);
+        exp_injector_->compute_vector(vmm_data.getIdx());
+        uni_vaddps(vmm_red, vmm_red, vmm_data);
+        store_probs(vmm_data, i);
+    }
+    reduce(vmm_red, false);
+
+    vmovss(xmm_tmp, ptr[reg_sum]);
+    vmulss(xmm_tmp, xmm_tmp, xmm_corr);
+    vaddss(xmm_tmp, xmm_tmp, xmm_red);
+    vmovss(ptr[reg_sum], xmm_tmp);
+
+    const dim_t Dv = conf_.Dv;
+    for (dim_t j = 0; j < Dv / simd_w_; j++) {
+        const auto acc_addr = ptr[reg_acc + j * simd_w_ * sizeof(float)];
+        uni_vmulps(vmm_data, vmm_corr, acc_addr);
+        uni_vmovups(acc_addr, vmm_data);
+    }
+    for (dim_t j = rnd_dn(Dv, simd_w_); j < Dv; j++) {
+        vmulss(xmm_data, xmm_corr, ptr[reg_acc + j * sizeof(float)]);
+        vmovss(ptr[reg_acc + j * sizeof(float)], xmm_data);
+    }
+
+    add(rsp, simd_w_ * sizeof(float));
+    postamble();
+
+    exp_injector_->prepare_table();
+    align(64);
+    L(l_lane_idx_);
+    for (int i = 0; i < simd_w_; i++)
+        dd(float2int(static_cast<float>(i)));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    const data_type_t isa_dt = isa == avx512_core_fp16 ? f16
+            : isa == avx512_core_bf16                  ? bf16
+                                                       : f32;
+
+    VDISPATCH_SDPA(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    for (auto md : {qry_md(), key_md(), val_md(), dst_md()}) {
+        VDISPATCH_SDPA(md->data_type == isa_dt, VERBOSE_UNSUPPORTED_DT);
+    }
+    if (with_attn_mask()) {
+        VDISPATCH_SDPA(one_of(attn_mask_md()->data_type, f32, bf16, f16),
+                VERBOSE_UNSUPPORTED_DT);
+        // f16 conversions of the softmax kernel need avx512.
+        VDISPATCH_SDPA(IMPLICATION(attn_mask_md()->data_type == f16,
+                               is_superset(isa, avx512_core)),
+                VERBOSE_UNSUPPORTED_DT);
+    }
+    VDISPATCH_SDPA(!memory_desc_wrapper(dst_md()).has_zero_dim(),
+            VERBOSE_EMPTY_TENSOR, "dst");
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(cpu_sdpa_args_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+    const memory_desc_wrapper q_d(qry_md());
+    const memory_desc_wrapper k_d(key_md());
+    const memory_desc_wrapper v_d(val_md());
+    const auto *d = desc();
+
+    c.isa = isa;
+    c.dt = q_d.data_type();
+    c.mask_dt = with_attn_mask() ? attn_mask_md()->data_type : data_type::f32;
+    c.MB = dst_md()->dims[0];
+    c.H = dst_md()->dims[1];
+    c.M = d->queries();
+    c.N = d->keys();
+    c.D = d->head_size();
+    c.Dv = d->values();
+    c.kv_group = kv_group_size();
+
+    // The brgemm kernel reads rows of Q as they are, hence the head
+    // dimension must be dense.
+    VDISPATCH_SDPA(q_d.blocking_desc().strides[3] == 1,
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    c.LDA_q = q_d.blocking_desc().strides[2];
+
+    c.vnni_granularity
+            = brgemm_desc_t::is_b_data_layout_vnni(c.dt, c.dt, false, isa)
+            ? static_cast<int>(data_type_vnni_granularity(c.dt))
+            : 1;
+    VDISPATCH_SDPA(c.D % c.vnni_granularity == 0, VERBOSE_BAD_DIM, "D", 3);
+
+    c.paged_kv = with_paged_kv();
+    c.M_blk = nstl::min(c.M, dim_t(32));
+    c.N_blk = nstl::min(c.N, dim_t(64));
+    if (c.paged_kv) {
+        c.N_blk = d->kv_page_size();
+        while (c.N_blk > 64 && c.N_blk % 2 == 0)
+            c.N_blk /= 2;
+        c.N_blk = nstl::min(c.N, c.N_blk);
+    }
+    c.nb_M = div_up(c.M, c.M_blk);
+    c.nb_N = div_up(c.N, c.N_blk);
+    c.M_tail = c.M % c.M_blk;
+    c.N_tail = c.N % c.N_blk;
+    const dim_t simd_w = cpu_isa_traits_t<isa>::vlen / sizeof(float);
+    c.LDP = rnd_up(c.N_blk, nstl::max(simd_w, dim_t(c.vnni_granularity)));
+
+    const auto &k_strides = k_d.blocking_desc().strides;
+    const auto &v_strides = v_d.blocking_desc().strides;
+    c.copy_k = c.vnni_granularity > 1 || k_strides[3] != 1;
+    c.LDB_k = c.copy_k ? c.N_blk : k_strides[2];
+    c.copy_v = c.vnni_granularity > 1 || v_strides[3] != 1;
+    c.LDB_v = c.copy_v ? c.Dv : v_strides[2];
+
+    c.with_mask = with_attn_mask();
+    if (c.with_mask) {
+        // The softmax kernel reads the mask rows as vectors.
+        const memory_desc_wrapper msk_d(attn_mask_md());
+        VDISPATCH_SDPA(msk_d.dims()[3] == c.N
+                        && msk_d.blocking_desc().strides[3] == 1,
+                VERBOSE_UNSUPPORTED_MEM_STRIDE);
+    }
+    c.inf_as_zero = d->softmax_alg == alg_kind::softmax_accurate_inf_as_zero;
+    c.nthr = dnnl_get_max_threads();
+    // Query tiles below the diagonal of a causal mask visit more key blocks,
+    // such tiles are distributed dynamically.
+    c.dynamic_sched = with_causal_mask();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for_(int is_vs = 0; is_vs < 2; is_vs++)
+    for_(int m_tail = 0; m_tail < 2; m_tail++)
+    for (int n_tail = 0; n_tail < 2; n_tail++) {
+        const dim_t M = m_tail ? c.M_tail : c.M_blk;
+        const dim_t n = n_tail ? c.N_tail : c.N_blk;
+        if (M == 0 || n == 0) continue;
+
+        const dim_t N = is_vs ? c.Dv : n;
+        const dim_t K = is_vs ? rnd_up(n, c.vnni_granularity) : c.D;
+        const dim_t LDA = is_vs ? c.LDP : c.LDA_q;
+        const dim_t LDB = is_vs ? c.LDB_v : c.LDB_k;
+        const dim_t LDC = is_vs ? c.Dv : c.LDP;
+        const float beta = is_vs ? 1.f : 0.f;
+
+        auto &brg = brg_descs_[get_brg_idx(is_vs, m_tail, n_tail)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.dt, c.dt, false,
+                false, brgemm_row_major, 1.f, beta, LDA, LDB, LDC, M, N, K));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.hint_expected_A_size = M * K;
+        brgattr.hint_expected_B_size = N * K;
+        brgattr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_sdpa_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    const auto &c = conf_;
+    const size_t dt_sz = types::data_type_size(c.dt);
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.template book<float>(key_sdpa_scores, c.nthr * c.M_blk * c.LDP);
+    scratchpad.template book<float>(key_sdpa_acc, c.nthr * c.M_blk * c.Dv);
+    scratchpad.template book<float>(key_sdpa_stats, c.nthr * 2 * c.M_blk);
+    if (c.dt != data_type::f32)
+        scratchpad.book(key_sdpa_probs, c.nthr * c.M_blk * c.LDP, dt_sz);
+    if (c.copy_k)
+        scratchpad.book(key_sdpa_k_buffer, c.nthr * c.D * c.N_blk, dt_sz);
+    if (c.copy_v)
+        scratchpad.book(key_sdpa_v_buffer, c.nthr * c.LDP * c.Dv, dt_sz);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::init(engine_t *engine) {
+    for (int i = 0; i < pd_t::brg_num; i++) {
+        const auto &brg = pd()->brg_descs_[i];
+        if (brg.bcast_dim == 0 || brg.load_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+    const auto &c = pd()->conf_;
+    for (int n_tail = 0; n_tail < 2; n_tail++) {
+        const dim_t n_cur = n_tail ? c.N_tail : c.N_blk;
+        if (n_cur == 0) continue;
+        CHECK(safe_ptr_assign(softmax_kernels_[n_tail],
+                new jit_brgemm_sdpa_softmax_t<isa>(c, n_cur)));
+        CHECK(softmax_kernels_[n_tail]->create_kernel());
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_sdpa_t<isa>::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto &c = pd()->conf_;
+
+    const auto qry = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    const auto key = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    const auto val = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    const auto msk = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    const auto scale_ptr = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    const auto block_table
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_KV_BLOCK_TABLE);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    CHECK(pd()->check_kv_block_table(block_table));
+
+    const memory_desc_wrapper q_d(pd()->qry_md());
+    const memory_desc_wrapper k_d(pd()->key_md());
+    const memory_desc_wrapper v_d(pd()->val_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const size_t dt_sz = types::data_type_size(c.dt);
+    const size_t msk_dt_sz = types::data_type_size(c.mask_dt);
+    const auto &k_strides = k_d.blocking_desc().strides;
+    const auto &v_strides = v_d.blocking_desc().strides;
+    const dim_t dst_ld = dst_d.blocking_desc().strides[3];
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(pd()->scale_md()->data_type, scale_ptr, 0);
+        if (pd()->desc()->invert_scale) scale = 1.f / scale;
+    }
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_stats);
+    char *probs_base = scratchpad.template get<char>(key_sdpa_probs);
+    char *k_buf_base = scratchpad.template get<char>(key_sdpa_k_buffer);
+    char *v_buf_base = scratchpad.template get<char>(key_sdpa_v_buffer);
+
+    const dim_t work_amount = c.MB * c.H * c.nb_M;
+    const auto ker = [&](int ithr, int nthr, dim_t start, dim_t end) {
+        if (start >= end) return;
+
+        float *scores = scores_base + ithr * c.M_blk * c.LDP;
+        float *acc = acc_base + ithr * c.M_blk * c.Dv;
+        float *row_max = stats_base + ithr * 2 * c.M_blk;
+        float *row_sum = row_max + c.M_blk;
+        char *probs = c.dt == data_type::f32
+                ? reinterpret_cast<char *>(scores)
+                : probs_base + ithr * c.M_blk * c.LDP * dt_sz;
+        char *k_buf = c.copy_k ? k_buf_base + ithr * c.D * c.N_blk * dt_sz
+                               : nullptr;
+        char *v_buf
+                = c.copy_v ? v_buf_base + ithr * c.LDP * c.Dv * dt_sz : nullptr;
+
+        brgemm_batch_element_t batch;
+
+        dim_t mb {0}, h {0}, mbi {0};
+        nd_iterator_init(start, mb, c.MB, h, c.H, mbi, c.nb_M);
+        for (dim_t iwork = start; iwork < end; ++iwork) {
+            const dim_t m_start = mbi * c.M_blk;
+            const dim_t m_cur = nstl::min(c.M_blk, c.M - m_start);
+            const bool m_tail = m_cur < c.M_blk;
+            const dim_t kv_h = h / c.kv_group;
+
+            const char *q_ptr
+                    = qry + q_d.off(mb % q_d.dims()[0], h, m_start, 0) * dt_sz;
+            // Keys past the causal boundary of the last row in the tile are
+            // masked out for every row, the corresponding blocks are skipped.
+            const dim_t n_end = pd()->visible_keys(m_start + m_cur - 1);
+
+            for (dim_t i = 0; i < m_cur; i++) {
+                row_max[i] = -INFINITY;
+                row_sum[i] = 0.f;
+            }
+            for (dim_t i = 0; i < m_cur * c.Dv; i++)
+                acc[i] = 0.f;
+
+            for (dim_t n_start = 0; n_start < n_end; n_start += c.N_blk) {
+                const dim_t n_cur = nstl::min(c.N_blk, c.N - n_start);
+                const bool n_tail = n_cur < c.N_blk;
+
+                dim_t kv_n = n_start;
+                const dim_t k_mb = pd()->kv_batch_index(block_table, mb, kv_n);
+                const dim_t v_mb = c.paged_kv ? k_mb : mb % v_d.dims()[0];
+
+                // S = Q x K
+                const char *k_ptr
+                        = key + k_d.off(k_mb, kv_h, 0, kv_n) * dt_sz;
+                if (c.copy_k) {
+                    if (dt_sz == 2)
+                        copy_k_block(reinterpret_cast<uint16_t *>(k_buf),
+                                reinterpret_cast<const uint16_t *>(k_ptr), c.D,
+                                n_cur, c.N_blk, k_strides[2], k_strides[3],
+                                c.vnni_granularity);
+                    else
+                        copy_k_block(reinterpret_cast<float *>(k_buf),
+                                reinterpret_cast<const float *>(k_ptr), c.D,
+                                n_cur, c.N_blk, k_strides[2], k_strides[3],
+                                c.vnni_granularity);
+                    k_ptr = k_buf;
+                }
+                batch.ptr.A = q_ptr;
+                batch.ptr.B = k_ptr;
+                brgemm_kernel_execute(
+                        brg_kernels_[pd_t::get_brg_idx(false, m_tail, n_tail)]
+                                .get(),
+                        1, &batch, scores);
+
+                // Online softmax: rescale the accumulated rows to the updated
+                // running maximum and compute unnormalized probabilities.
+                const auto *softmax_ker = softmax_kernels_[n_tail].get();
+                for (dim_t i = 0; i < m_cur; i++) {
+                    const dim_t m = m_start + i;
+                    typename jit_brgemm_sdpa_softmax_t<isa>::call_params_t p;
+                    p.scores = scores + i * c.LDP;
+                    p.probs = probs + i * c.LDP * dt_sz;
+                    p.mask = nullptr;
+                    if (c.with_mask) {
+                        const auto &md = msk_d.dims();
+                        p.mask = msk
+                                + msk_d.off(mb % md[0], h % md[1], m % md[2],
+                                          n_start)
+                                        * msk_dt_sz;
+                    }
+                    p.acc = acc + i * c.Dv;
+                    p.max = row_max + i;
+                    p.sum = row_sum + i;
+                    p.n_vis = nstl::min(n_cur, pd()->visible_keys(m) - n_start);
+                    p.scale = scale;
+                    (*softmax_ker)(&p);
+                }
+
+                // O += P x V
+                const char *v_ptr
+                        = val + v_d.off(v_mb, kv_h, kv_n, 0) * dt_sz;
+                if (c.copy_v) {
+                    if (dt_sz == 2)
+                        copy_v_block(reinterpret_cast<uint16_t *>(v_buf),
+                                reinterpret_cast<const uint16_t *>(v_ptr),
+                                n_cur, c.Dv, v_strides[2], v_strides[3],
+                                c.vnni_granularity);
+                    else
+                        copy_v_block(reinterpret_cast<float *>(v_buf),
+                                reinterpret_cast<const float *>(v_ptr), n_cur,
+                                c.Dv, v_strides[2], v_strides[3],
+                                c.vnni_granularity);
+                    v_ptr = v_buf;
+                }
+                batch.ptr.A = probs;
+                batch.ptr.B = v_ptr;
+                brgemm_kernel_execute(
+                        brg_kernels_[pd_t::get_brg_idx(true, m_tail, n_tail)]
+                                .get(),
+                        1, &batch, acc);
+            }
+
+            for (dim_t i = 0; i < m_cur; i++) {
+                const float inv_sum = (c.inf_as_zero && row_sum[i] == 0.f)
+                        ? 0.f
+                        : 1.f / row_sum[i];
+                const float *acc_row = acc + i * c.Dv;
+                char *dst_row = dst + dst_d.off(mb, h, m_start + i, 0) * dt_sz;
+                for (dim_t j = 0; j < c.Dv; j++)
+                    io::store_float_value(
+                            c.dt, acc_row[j] * inv_sum, dst_row, j * dst_ld);
+            }
+
+            nd_iterator_step(mb, c.MB, h, c.H, mbi, c.nb_M);
+        }
+    };
+
+    if (c.dynamic_sched)
+        parallel_dynamic(c.nthr, work_amount, ker);
+    else
+        parallel(c.nthr, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(work_amount, nthr, ithr, start, end);
+            ker(ithr, nthr, start, end);
+        });
+
+    return status::success;
+}
+
+template struct jit_brgemm_sdpa_softmax_t<avx512_core_fp16>;
+template struct jit_brgemm_sdpa_softmax_t<avx512_core_bf16>;
+template struct jit_brgemm_sdpa_softmax_t<avx512_core>;
+template struct jit_brgemm_sdpa_softmax_t<avx2>;
+template struct brgemm_sdpa_t<avx512_core_fp16>;
+template struct brgemm_sdpa_t<avx512_core_bf16>;
+template struct brgemm_sdpa_t<avx512_core>;
+template struct brgemm_sdpa_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
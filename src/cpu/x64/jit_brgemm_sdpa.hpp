@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct brgemm_sdpa_conf_t {
+    cpu_isa_t isa;
+    data_type_t dt; // Q, K, V and dst data type
+    data_type_t mask_dt;
+
+    dim_t MB, H, M, N, D, Dv;
+    dim_t kv_group;
+
+    // Queries are processed in M_blk rows, keys and values in N_blk columns.
+    dim_t M_blk, N_blk, nb_M, nb_N, M_tail, N_tail;
+    // Row stride of the scores and probabilities tiles, padded to the vector
+    // length so that the softmax kernel reads and writes whole vectors.
+    dim_t LDP;
+    int vnni_granularity;
+
+    // K and V blocks are copied into a per-thread buffer when the user
+    // layout can't be consumed by the brgemm kernel directly.
+    bool copy_k, copy_v;
+    dim_t LDA_q, LDB_k, LDB_v;
+
+    bool with_mask;
+    bool inf_as_zero;
+    // K and V are read from the pages of a paged cache, N_blk divides the page
+    // size so that a block of keys never crosses a page boundary.
+    bool paged_kv;
+    // Work items are scheduled with work stealing rather than split evenly.
+    bool dynamic_sched;
+    int nthr;
+};
+
+// Online softmax of a row of the scores tile: scales and masks the scores,
+// updates the running maximum and sum of the row, rescales the accumulated
+// output row and writes the unnormalized probabilities. Keys past `n_vis` get
+// a zero probability.
+template <cpu_isa_t isa>
+struct jit_brgemm_sdpa_softmax_t : public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_sdpa_softmax_t)
+
+    struct call_params_t {
+        float *scores; // f32 probabilities are written in place
+        void *probs;
+        const void *mask;
+        float *acc;
+        float *max;
+        float *sum;
+        dim_t n_vis;
+        float scale;
+    };
+
+    jit_brgemm_sdpa_softmax_t(const brgemm_sdpa_conf_t &conf, dim_t n_cur);
+
+private:
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+    using reg64_t = const Xbyak::Reg64;
+    static constexpr int simd_w_ = cpu_isa_traits_t<isa>::vlen / sizeof(float);
+
+    const brgemm_sdpa_conf_t conf_;
+    const dim_t n_cur_;
+    std::unique_ptr<jit_uni_eltwise_injector_t<isa>> exp_injector_;
+    Xbyak::Label l_lane_idx_;
+
+    reg64_t reg_param = abi_param1;
+    reg64_t reg_table = rax;
+    reg64_t reg_scores = r8;
+    reg64_t reg_probs = r9;
+    reg64_t reg_mask = r10;
+    reg64_t reg_acc = r11;
+    reg64_t reg_max = r12;
+    reg64_t reg_sum = r13;
+    reg64_t reg_tmp = r14;
+
+    // Vmm(0) - Vmm(3) are left to the exp injector.
+    const Vmm vmm_data = Vmm(4);
+    const Vmm vmm_tmp = Vmm(5);
+    const Vmm vmm_red = Vmm(6);
+    const Vmm vmm_scale = Vmm(7);
+    const Vmm vmm_neg_inf = Vmm(8);
+    const Vmm vmm_limit = Vmm(9);
+    const Vmm vmm_lane = Vmm(10);
+    const Vmm vmm_step = Vmm(11);
+    const Vmm vmm_shift = Vmm(12);
+    const Vmm vmm_corr = Vmm(13);
+    const Xbyak::Opmask k_vis = Xbyak::Opmask(2);
+
+    void load_mask(const Vmm &vmm, int i, int tail);
+    void store_probs(const Vmm &vmm, int i);
+    void reduce(const Vmm &vmm, bool is_max);
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brgemm:", isa, ""), brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernel index for `S = Q x K` (is_vs == false) and `O += P x V`
+        // (is_vs == true) products with optional M and N (K for VS) tails.
+        static int get_brg_idx(bool is_vs, bool m_tail, bool n_tail) {
+            return (is_vs * 2 + m_tail) * 2 + n_tail;
+        }
+        static constexpr int brg_num = 8;
+
+        brgemm_sdpa_conf_t conf_ = utils::zero<decltype(conf_)>();
+        brgemm_desc_t brg_descs_[brg_num];
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::brg_num];
+    // Indexed by the N tail.
+    std::unique_ptr<jit_brgemm_sdpa_softmax_t<isa>> softmax_kernels_[2];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
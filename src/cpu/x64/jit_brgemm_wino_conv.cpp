@@ -0,0 +1,632 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/broadcast_strategy.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_q10n.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace {
+constexpr int alpha = 6;
+constexpr int tile_size = 4;
+constexpr int alpha2 = alpha * alpha;
+// Number of channels transformed at once.
+constexpr int simd_w = 16;
+
+// t = B^T d for 6 vectors of `simd_w` values `stride` apart.
+inline void src_transform_1d(const float *d, float *t, dim_t stride) {
+    PRAGMA_OMP_SIMD()
+    for (int k = 0; k < simd_w; k++) {
+        const float d0 = d[k], d1 = d[stride + k], d2 = d[2 * stride + k];
+        const float d3 = d[3 * stride + k], d4 = d[4 * stride + k];
+        const float d5 = d[5 * stride + k];
+        t[k] = 4.f * d0 - 5.f * d2 + d4;
+        t[stride + k] = -4.f * (d1 + d2) + d3 + d4;
+        t[2 * stride + k] = 4.f * (d1 - d2) - d3 + d4;
+        t[3 * stride + k] = 2.f * (d3 - d1) - d2 + d4;
+        t[4 * stride + k] = 2.f * (d1 - d3) - d2 + d4;
+        t[5 * stride + k] = 4.f * d1 - 5.f * d3 + d5;
+    }
+}
+
+// s = A^T m for 6 vectors of `simd_w` values `stride` apart.
+inline void dst_transform_1d(const float *m, float *s, dim_t stride) {
+    PRAGMA_OMP_SIMD()
+    for (int k = 0; k < simd_w; k++) {
+        const float m0 = m[k], m1 = m[stride + k], m2 = m[2 * stride + k];
+        const float m3 = m[3 * stride + k], m4 = m[4 * stride + k];
+        const float m5 = m[5 * stride + k];
+        const float a12 = m1 + m2, s12 = m1 - m2;
+        const float a34 = m3 + m4, s34 = m3 - m4;
+        s[k] = m0 + a12 + a34;
+        s[stride + k] = s12 + 2.f * s34;
+        s[2 * stride + k] = a12 + 4.f * a34;
+        s[3 * stride + k] = s12 + 8.f * s34 + m5;
+    }
+}
+
+// Transforms the source tiles [tile_start, tile_start + ntiles) of image `n`
+// into the 36 matrices of `V`, one per point of the 6x6 tile. The out of
+// bounds source and the padded input channels are zero.
+template <typename src_data_t>
+void transform_src(const brgemm_wino_conf_t &c, const src_data_t *src,
+        src_data_t *V, dim_t n, dim_t tile_start, dim_t ntiles) {
+    const dim_t V_ld = c.tile_blk * c.ic_pad;
+
+    for (dim_t t = 0; t < ntiles; t++) {
+        const dim_t tile = tile_start + t;
+        const dim_t ih0 = (tile / c.tiles_w) * tile_size - c.t_pad;
+        const dim_t iw0 = (tile % c.tiles_w) * tile_size - c.l_pad;
+
+        for (dim_t ic0 = 0; ic0 < c.ic_pad; ic0 += simd_w) {
+            const dim_t len = nstl::min<dim_t>(simd_w, c.ic_pad - ic0);
+            const dim_t valid
+                    = nstl::max<dim_t>(0, nstl::min<dim_t>(len, c.IC - ic0));
+
+            float d[alpha][alpha][simd_w];
+            for_(int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                const dim_t ih = ih0 + i, iw = iw0 + j;
+                const bool is_inside = ih >= 0 && ih < c.IH && iw >= 0
+                        && iw < c.IW;
+                const dim_t n_valid = is_inside ? valid : 0;
+                const src_data_t *s
+                        = src + ((n * c.IH + ih) * c.IW + iw) * c.IC + ic0;
+                for (dim_t k = 0; k < n_valid; k++)
+                    d[i][j][k] = static_cast<float>(s[k]);
+                for (dim_t k = n_valid; k < simd_w; k++)
+                    d[i][j][k] = 0.f;
+            }
+
+            float tmp[alpha][alpha][simd_w];
+            for (int j = 0; j < alpha; j++)
+                src_transform_1d(&d[0][j][0], &tmp[0][j][0], alpha * simd_w);
+            for (int i = 0; i < alpha; i++)
+                src_transform_1d(&tmp[i][0][0], &d[i][0][0], simd_w);
+
+            for_(int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                src_data_t *v
+                        = V + (i * alpha + j) * V_ld + t * c.ic_pad + ic0;
+                PRAGMA_OMP_SIMD()
+                for (dim_t k = 0; k < len; k++)
+                    v[k] = static_cast<src_data_t>(d[i][j][k]);
+            }
+        }
+    }
+}
+
+// Applies the post-ops to the values `r` of `simd_w` consecutive output
+// channels. `rhs[idx]` holds the values of the binary post-op `idx` for these
+// channels. The common algorithms are computed with vector loops, the others
+// with the reference scalar functions.
+void apply_post_ops(
+        const post_ops_t &po, const float (*rhs)[simd_w], float *r) {
+    using namespace alg_kind;
+
+    for (int idx = 0; idx < po.len(); idx++) {
+        const auto &e = po.entry_[idx];
+        if (e.is_eltwise()) {
+            const float alpha = e.eltwise.alpha, beta = e.eltwise.beta;
+            const float scale = e.eltwise.scale;
+            switch (e.eltwise.alg) {
+                case eltwise_relu:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = (r[k] > 0.f ? r[k] : alpha * r[k]) * scale;
+                    break;
+                case eltwise_linear:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = (alpha * r[k] + beta) * scale;
+                    break;
+                case eltwise_clip:
+                case eltwise_clip_v2:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = nstl::min(beta, nstl::max(alpha, r[k]))
+                                * scale;
+                    break;
+                default: {
+                    const ref_eltwise_scalar_fwd_t ref(e.eltwise);
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = ref.compute_scalar(r[k]);
+                }
+            }
+        } else {
+            const float *v = rhs[idx];
+            switch (e.binary.alg) {
+                case binary_add:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] += v[k];
+                    break;
+                case binary_sub:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] -= v[k];
+                    break;
+                case binary_mul:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] *= v[k];
+                    break;
+                case binary_max:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = nstl::max(r[k], v[k]);
+                    break;
+                case binary_min:
+                    PRAGMA_OMP_SIMD()
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = nstl::min(r[k], v[k]);
+                    break;
+                default: {
+                    const ref_binary_scalar_t ref(e.binary);
+                    for (int k = 0; k < simd_w; k++)
+                        r[k] = ref.compute_scalar(r[k], v[k], false);
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace alg_kind;
+    using namespace format_tag;
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_dt = invariant_src_md()->data_type;
+    const auto wei_dt = invariant_wei_md()->data_type;
+    const auto dst_dt = invariant_dst_md()->data_type;
+
+    VDISPATCH_CONV(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(utils::one_of(desc()->alg_kind, convolution_auto,
+                           convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(one_of(src_dt, f32, bf16) && wei_dt == src_dt
+                    && one_of(dst_dt, f32, src_dt),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(IMPLICATION(src_dt == bf16,
+                           is_superset(isa, avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    // f32 is computed by the avx512_core instance.
+    VDISPATCH_CONV(IMPLICATION(src_dt == f32,
+                           !is_superset(isa, avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_CONV(IMPLICATION(with_bias(),
+                           one_of(invariant_bia_md()->data_type, f32, bf16)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_UNSUPPORTED_FEATURE, "groups");
+    VDISPATCH_CONV(KH() == 3 && KW() == 3, VERBOSE_UNSUPPORTED_FEATURE,
+            "only 3x3 kernels are supported");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "only unit strides are supported");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_UNSUPPORTED_FEATURE,
+            "dilations are not supported");
+    VDISPATCH_CONV(attr()->has_default_values(skip_mask_t::post_ops, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(set_default_formats_common(nhwc, any, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_wrapper(src_md()).matches_tag(nhwc)
+                    && memory_desc_wrapper(dst_md()).matches_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_CONV(post_ops_ok(), VERBOSE_UNSUPPORTED_POSTOP);
+
+    // The transformed bf16 source and weights are rounded, which makes the
+    // result less accurate than the one of a direct convolution.
+    VDISPATCH_CONV(IMPLICATION(desc()->alg_kind == convolution_auto,
+                           src_dt == f32),
+            VERBOSE_IMPL_HEURISTIC_FAIL,
+            "bf16 winograd is only used when requested");
+
+    CHECK(init_conf());
+    VDISPATCH_CONV(IMPLICATION(desc()->alg_kind == convolution_auto,
+                           is_wino_profitable()),
+            VERBOSE_IMPL_HEURISTIC_FAIL,
+            "transforms cost more than the direct convolution");
+    VDISPATCH_CONV(set_default_alg_kind(convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(set_wino_weights_md(), VERBOSE_UNSUPPORTED_TAG);
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::post_ops_ok() const {
+    const auto &po = attr()->post_ops_;
+    const memory_desc_wrapper dst_d(dst_md());
+    for (int idx = 0; idx < po.len(); idx++) {
+        const auto &e = po.entry_[idx];
+        if (e.is_eltwise()) continue;
+        if (!e.is_binary() || e.is_binary_with_ternary_op()) return false;
+        if (!ref_binary_scalar_t::data_type_ok(e)) return false;
+        const auto bcast = get_rhs_arg_broadcasting_strategy(
+                e.binary.src1_desc, dst_d,
+                {broadcasting_strategy_t::scalar,
+                        broadcasting_strategy_t::per_oc});
+        if (bcast == broadcasting_strategy_t::unsupported) return false;
+    }
+    return true;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_conf() {
+    auto &c = conf_;
+
+    c.isa = isa;
+    c.src_dt = src_md()->data_type;
+    c.wei_dt = weights_md()->data_type;
+    c.dst_dt = dst_md()->data_type;
+    c.with_bias = with_bias();
+    c.bia_dt = c.with_bias ? weights_md(1)->data_type : data_type::undef;
+    c.MB = MB();
+    c.IC = IC();
+    c.OC = OC();
+    c.IH = IH();
+    c.IW = IW();
+    c.OH = OH();
+    c.OW = OW();
+    c.t_pad = padT();
+    c.l_pad = padL();
+
+    const auto &po = attr()->post_ops_;
+    const memory_desc_wrapper dst_d(dst_md());
+    c.with_post_ops = po.len() > 0;
+    c.po_per_oc_mask = 0;
+    for (int idx = 0; idx < po.len(); idx++) {
+        if (po.entry_[idx].is_binary()
+                && get_rhs_arg_broadcasting_strategy(
+                           po.entry_[idx].binary.src1_desc, dst_d)
+                        == broadcasting_strategy_t::per_oc)
+            c.po_per_oc_mask |= 1u << idx;
+    }
+
+    const bool is_vnni = brgemm_desc_t::is_b_data_layout_vnni(
+            c.src_dt, c.wei_dt, false, isa);
+    c.vnni_granularity = is_vnni
+            ? static_cast<int>(data_type_vnni_granularity(c.wei_dt))
+            : 1;
+    c.ic_pad = rnd_up(c.IC, c.vnni_granularity);
+
+    // Four vector registers of output channels, or less for small problems.
+    const dim_t oc_simd = isa_max_vlen(isa) / sizeof(float);
+    c.oc_block = nstl::min<dim_t>(4 * oc_simd, rnd_up(c.OC, oc_simd));
+    c.nb_oc = div_up(c.OC, c.oc_block);
+
+    c.tiles_h = div_up(c.OH, tile_size);
+    c.tiles_w = div_up(c.OW, tile_size);
+    c.tiles_per_img = c.tiles_h * c.tiles_w;
+
+    // The transformed source and the brgemm results of a block of tiles are
+    // to fit in half of the L2 cache, the other half being left to the
+    // weights.
+    const size_t wei_dt_sz = types::data_type_size(c.wei_dt);
+    const size_t tile_bytes
+            = alpha2 * (c.ic_pad * wei_dt_sz + c.oc_block * sizeof(float));
+    const size_t l2_size = platform::get_per_core_cache_size(2);
+    c.tile_blk = static_cast<dim_t>(l2_size / 2 / tile_bytes);
+    c.tile_blk = saturate<dim_t>(4, 32, c.tile_blk);
+    c.tile_blk = nstl::min(c.tile_blk, c.tiles_per_img);
+    c.nb_tile_blk = div_up(c.tiles_per_img, c.tile_blk);
+    c.tile_tail = c.tiles_per_img % c.tile_blk;
+
+    c.nthr = dnnl_get_max_threads();
+    const dim_t tile_work = c.MB * c.nb_tile_blk;
+    c.oc_chunks = tile_work >= c.nthr
+            ? 1
+            : nstl::min(c.nb_oc, div_up<dim_t>(c.nthr, tile_work));
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::is_wino_profitable() const {
+    const auto &c = conf_;
+    // Approximate number of operations of the 1D transforms of a tile per
+    // channel: 12 and 10 vectors of 6 values, and the slowdown of the
+    // transforms with respect to the brgemm kernels.
+    const double src_tr_ops = 12 * 28;
+    const double dst_tr_ops = 10 * 21;
+    const double tr_slowdown = 2.;
+    const double required_gain = 0.75;
+
+    const double ntiles = static_cast<double>(c.MB * c.tiles_per_img);
+    const double oc_pad = static_cast<double>(c.nb_oc * c.oc_block);
+    const double direct_ops
+            = 2. * 9 * c.IC * c.OC * static_cast<double>(c.MB * c.OH * c.OW);
+    const double wino_ops = ntiles
+            * (2. * alpha2 * c.ic_pad * oc_pad
+                    + tr_slowdown
+                            * (src_tr_ops * c.ic_pad * c.oc_chunks
+                                    + dst_tr_ops * oc_pad));
+    return wino_ops < required_gain * direct_ops;
+}
+
+template <cpu_isa_t isa>
+bool brgemm_wino_convolution_fwd_t<isa>::pd_t::set_wino_weights_md() {
+    const auto &c = conf_;
+
+    memory_desc_t expected_wei_md = *invariant_wei_md();
+    expected_wei_md.format_kind = format_kind::wino;
+    auto &wd = expected_wei_md.format_desc.wino_desc;
+    wd.wino_format = wino_memory_format_t::wino_wei_OBaaIoi;
+    wd.r = 3;
+    wd.alpha = alpha;
+    wd.ic = static_cast<int>(c.IC);
+    wd.oc = static_cast<int>(c.OC);
+    wd.ic_block = c.vnni_granularity;
+    wd.oc_block = static_cast<int>(c.oc_block);
+    wd.ic2_block = 1;
+    wd.oc2_block = 1;
+    wd.adj_scale = 1.f;
+    wd.size = c.nb_oc * alpha2 * c.ic_pad * c.oc_block
+            * types::data_type_size(c.wei_dt);
+
+    if (weights_md_.format_kind == format_kind::any)
+        weights_md_ = expected_wei_md;
+    return weights_md_ == expected_wei_md;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for (int idx = 0; idx < brg_num; idx++) {
+        const dim_t M = idx == 0 ? c.tile_blk : c.tile_tail;
+        if (M == 0) continue;
+        auto &brg = brg_descs_[idx];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.src_dt, c.wei_dt,
+                false, false, brgemm_row_major, 1.f, 0.f, c.ic_pad,
+                c.oc_block, c.oc_block, M, c.oc_block, c.ic_pad));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.hint_expected_A_size = M * c.ic_pad;
+        brgattr.hint_expected_B_size = c.oc_block * c.ic_pad;
+        brgattr.hint_expected_C_size = M * c.oc_block;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_wino_convolution_fwd_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.book(key_wino_V,
+            c.nthr * alpha2 * c.tile_blk * c.ic_pad
+                    * types::data_type_size(c.wei_dt),
+            1, PAGE_4K);
+    scratchpad.template book<float>(
+            key_wino_M, c.nthr * alpha2 * c.tile_blk * c.oc_block);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::init(engine_t *engine) {
+    for (int i = 0; i < pd_t::brg_num; i++) {
+        if (i > 0 && pd()->conf().tile_tail == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(i)));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+template <typename dst_data_t>
+void brgemm_wino_convolution_fwd_t<isa>::transform_dst(const float *M,
+        const char *bias, const void *const *po_rhs, dst_data_t *dst, dim_t n,
+        dim_t tile_start, dim_t ntiles, dim_t ob) const {
+    const auto &c = pd()->conf();
+    const auto &po = pd()->attr()->post_ops_;
+    const dim_t M_ld = c.tile_blk * c.oc_block;
+
+    for (dim_t o0 = 0; o0 < c.oc_block; o0 += simd_w) {
+        const dim_t oc0 = ob * c.oc_block + o0;
+        if (oc0 >= c.OC) break;
+        const dim_t len = nstl::min<dim_t>(simd_w, c.oc_block - o0);
+        const dim_t valid = nstl::min<dim_t>(len, c.OC - oc0);
+
+        // The bias and the values of the binary post-ops are shared by all
+        // the tiles. A dense per channel tensor has its value of channel `oc`
+        // at offset `oc`.
+        float b[simd_w] = {0};
+        if (c.with_bias)
+            for (dim_t k = 0; k < valid; k++)
+                b[k] = io::load_float_value(c.bia_dt, bias, oc0 + k);
+        float rhs[post_ops_t::post_ops_limit][simd_w];
+        for (int idx = 0; idx < po.len(); idx++) {
+            if (!po.entry_[idx].is_binary()) continue;
+            const auto rhs_dt = po.entry_[idx].binary.src1_desc.data_type;
+            const bool per_oc = c.po_per_oc_mask & (1u << idx);
+            for (dim_t k = 0; k < simd_w; k++)
+                rhs[idx][k] = 0.f;
+            for (dim_t k = 0; k < valid; k++)
+                rhs[idx][k] = io::load_float_value(
+                        rhs_dt, po_rhs[idx], per_oc ? oc0 + k : 0);
+        }
+
+        for (dim_t t = 0; t < ntiles; t++) {
+            const dim_t tile = tile_start + t;
+            const dim_t oh0 = (tile / c.tiles_w) * tile_size;
+            const dim_t ow0 = (tile % c.tiles_w) * tile_size;
+
+            float m[alpha][alpha][simd_w];
+            for_(int i = 0; i < alpha; i++)
+            for (int j = 0; j < alpha; j++) {
+                const float *p = M + (i * alpha + j) * M_ld + t * c.oc_block
+                        + o0;
+                for (dim_t k = 0; k < len; k++)
+                    m[i][j][k] = p[k];
+                for (dim_t k = len; k < simd_w; k++)
+                    m[i][j][k] = 0.f;
+            }
+
+            float tmp[tile_size][alpha][simd_w];
+            float y[tile_size][tile_size][simd_w];
+            for (int j = 0; j < alpha; j++)
+                dst_transform_1d(&m[0][j][0], &tmp[0][j][0], alpha * simd_w);
+            for (int i = 0; i < tile_size; i++)
+                dst_transform_1d(&tmp[i][0][0], &y[i][0][0], simd_w);
+
+            for_(int i = 0; i < tile_size; i++)
+            for (int j = 0; j < tile_size; j++) {
+                const dim_t oh = oh0 + i, ow = ow0 + j;
+                if (oh >= c.OH || ow >= c.OW) continue;
+                float *r = y[i][j];
+                PRAGMA_OMP_SIMD()
+                for (int k = 0; k < simd_w; k++)
+                    r[k] += b[k];
+                if (c.with_post_ops) apply_post_ops(po, rhs, r);
+
+                dst_data_t *d
+                        = dst + ((n * c.OH + oh) * c.OW + ow) * c.OC + oc0;
+                PRAGMA_OMP_SIMD()
+                for (dim_t k = 0; k < valid; k++)
+                    d[k] = q10n::saturate_and_round<dst_data_t>(r[k]);
+            }
+        }
+    }
+}
+
+template <cpu_isa_t isa>
+template <typename src_data_t, typename dst_data_t>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute_forward(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf();
+
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const src_data_t *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const src_data_t *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_CLEAN_MEM(dst_data_t *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    // Arguments of the binary post-ops, by post-op index.
+    const auto &po = pd()->attr()->post_ops_;
+    const void *po_rhs[post_ops_t::post_ops_limit] = {nullptr};
+    for (int idx = 0; idx < po.len(); idx++) {
+        if (po.entry_[idx].is_binary())
+            po_rhs[idx] = CTX_IN_MEM(const void *,
+                    DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1);
+    }
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    src_data_t *V_base = scratchpad.template get<src_data_t>(key_wino_V);
+    float *M_base = scratchpad.template get<float>(key_wino_M);
+    const dim_t V_sz = alpha2 * c.tile_blk * c.ic_pad;
+    const dim_t M_sz = alpha2 * c.tile_blk * c.oc_block;
+    const dim_t wei_ob_sz = alpha2 * c.ic_pad * c.oc_block;
+
+    const dim_t work_amount = c.MB * c.nb_tile_blk * c.oc_chunks;
+
+    parallel(c.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        src_data_t *V = V_base + ithr * V_sz;
+        float *M = M_base + ithr * M_sz;
+        brgemm_batch_element_t batch;
+
+        dim_t n {0}, tb {0}, occ {0};
+        nd_iterator_init(
+                start, n, c.MB, tb, c.nb_tile_blk, occ, c.oc_chunks);
+        // The chunks of output channels of a block of tiles share its
+        // transformed source.
+        dim_t last_n = -1, last_tb = -1;
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t tile_start = tb * c.tile_blk;
+            const dim_t ntiles
+                    = nstl::min(c.tile_blk, c.tiles_per_img - tile_start);
+            const auto *ker = brg_kernels_[ntiles == c.tile_blk ? 0 : 1].get();
+
+            if (n != last_n || tb != last_tb) {
+                transform_src(c, src, V, n, tile_start, ntiles);
+                last_n = n;
+                last_tb = tb;
+            }
+
+            dim_t ob_start {0}, ob_end {0};
+            balance211(c.nb_oc, c.oc_chunks, occ, ob_start, ob_end);
+            for (dim_t ob = ob_start; ob < ob_end; ob++) {
+                for (int a = 0; a < alpha2; a++) {
+                    batch.ptr.A = V + a * c.tile_blk * c.ic_pad;
+                    batch.ptr.B
+                            = wei + ob * wei_ob_sz + a * c.ic_pad * c.oc_block;
+                    brgemm_kernel_execute(
+                            ker, 1, &batch, M + a * c.tile_blk * c.oc_block);
+                }
+                transform_dst(M, bias, po_rhs, dst, n, tile_start, ntiles, ob);
+            }
+
+            nd_iterator_step(n, c.MB, tb, c.nb_tile_blk, occ, c.oc_chunks);
+        }
+    });
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_wino_convolution_fwd_t<isa>::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf();
+    if (c.src_dt == f32) return execute_forward<float, float>(ctx);
+    if (c.dst_dt == f32) return execute_forward<bfloat16_t, float>(ctx);
+    return execute_forward<bfloat16_t, bfloat16_t>(ctx);
+}
+
+template struct brgemm_wino_convolution_fwd_t<avx512_core_bf16>;
+template struct brgemm_wino_convolution_fwd_t<avx512_core>;
+template struct brgemm_wino_convolution_fwd_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// F(4x4, 3x3) Winograd convolution: each 4x4 tile of the destination is
+// computed from a 6x6 tile of the source as `A^T [(G g G^T) . (B^T d B)] A`.
+// The weights are transformed once by the reorder to `wino_wei_OBaaIoi`. For
+// a block of `tile_blk` tiles, the source tiles are transformed into 36
+// matrices of `tile_blk` x `ic_pad`, one per point of the 6x6 tile, which are
+// multiplied by the weights of the same point with one brgemm call each. The
+// 36 results are then transformed back into the destination tiles while they
+// are still in the cache.
+struct brgemm_wino_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, wei_dt, bia_dt, dst_dt;
+
+    dim_t MB, IC, OC, IH, IW, OH, OW;
+    dim_t t_pad, l_pad;
+
+    // Input channels padded to the VNNI granularity of the weights and output
+    // channels padded to the block.
+    dim_t ic_pad, oc_block, nb_oc;
+    int vnni_granularity;
+
+    // Tiles of an image, and blocks of tiles multiplied at once.
+    dim_t tiles_h, tiles_w, tiles_per_img;
+    dim_t tile_blk, nb_tile_blk, tile_tail;
+    // The output channel blocks are split between several threads when there
+    // are not enough blocks of tiles.
+    dim_t oc_chunks;
+
+    bool with_bias, with_post_ops;
+    // Bit `i` is set if the binary post-op `i` is broadcast per output
+    // channel, the other binary post-ops take a single value.
+    uint32_t po_per_oc_mask;
+    int nthr;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brgemm_wino:", isa, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels for `tile_blk` tiles and for the tail of the tiles of an
+        // image.
+        static constexpr int brg_num = 2;
+
+        const brgemm_wino_conf_t &conf() const { return conf_; }
+        const brgemm_desc_t &brg_desc(int idx) const { return brg_descs_[idx]; }
+
+    private:
+        status_t init_conf();
+        // Sets the weights of format kind `any` to the transformed ones and
+        // checks the given ones otherwise.
+        bool set_wino_weights_md();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        // The post-ops are applied by the output transform: eltwise and
+        // binary post-ops with a single value or a value per output channel.
+        bool post_ops_ok() const;
+        // Returns true when the transforms cost less than the multiplications
+        // saved with respect to a direct convolution.
+        bool is_wino_profitable() const;
+
+        brgemm_wino_conf_t conf_ = utils::zero<decltype(conf_)>();
+        brgemm_desc_t brg_descs_[brg_num];
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    template <typename src_data_t, typename dst_data_t>
+    status_t execute_forward(const exec_ctx_t &ctx) const;
+    template <typename dst_data_t>
+    void transform_dst(const float *M, const char *bias,
+            const void *const *po_rhs, dst_data_t *dst, dim_t n,
+            dim_t tile_start, dim_t ntiles, dim_t ob) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::brg_num];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
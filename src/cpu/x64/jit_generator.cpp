@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "jit_generator.hpp"
 
 namespace dnnl {
@@ -21,6 +23,68 @@ namespace impl {
 namespace cpu {
 namespace x64 {
 
+const jit_cache::scope_t *jit_generator_t::get_jit_cache_scope(
+        serialization_stream_t &id) const {
+    const auto *scope = jit_cache::scope_t::current();
+    if (!scope || !serialize_jit_cache_id(id)) return nullptr;
+    id.append_array(std::strlen(name()), name());
+    id.append(max_cpu_isa_);
+    return scope;
+}
+
+bool jit_generator_t::load_from_jit_cache(
+        const jit_cache::scope_t &scope, const serialization_stream_t &id) {
+    jit_cache::entry_t entry;
+    if (!jit_cache::load(scope, id, entry)) return false;
+
+    db(entry.code, entry.code_size);
+    // Slots of absolute label addresses hold offsets of the labels and are
+    // rebased on the code address by Xbyak when the code gets ready.
+    for (size_t i = 0; i < entry.n_relocs; i++) {
+        uint64_t offset;
+        std::memcpy(&offset, entry.code + entry.relocs[i], sizeof(offset));
+        save(entry.relocs[i], offset, sizeof(offset), Xbyak::inner::LaddTop);
+    }
+    return true;
+}
+
+void jit_generator_t::store_to_jit_cache(const jit_cache::scope_t &scope,
+        const serialization_stream_t &id,
+        std::vector<Xbyak::uint8> &unresolved_code) const {
+    // In AutoGrow mode Xbyak puts zeros into slots of absolute label addresses
+    // and writes `code address + label offset` there when the code gets
+    // ready. Such slots are located by comparing the code before and after
+    // resolving labels, and are stored as label offsets.
+    const Xbyak::uint8 *code = jit_ker_;
+    const size_t size = unresolved_code.size();
+    const uint64_t top = reinterpret_cast<uint64_t>(code);
+    std::vector<uint64_t> relocs;
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i++) {
+        uint64_t before, after;
+        std::memcpy(&before, unresolved_code.data() + i, sizeof(before));
+        std::memcpy(&after, code + i, sizeof(after));
+        if (before != 0 || after < top || after - top > size) continue;
+        relocs.push_back(i);
+        i += sizeof(uint64_t) - 1;
+    }
+
+    auto &resolved_code = unresolved_code;
+    std::memcpy(resolved_code.data(), code, size);
+    for (const auto r : relocs) {
+        uint64_t addr;
+        std::memcpy(&addr, code + r, sizeof(addr));
+        addr -= top;
+        std::memcpy(resolved_code.data() + r, &addr, sizeof(addr));
+    }
+
+    jit_cache::entry_t entry;
+    entry.code = resolved_code.data();
+    entry.code_size = size;
+    entry.relocs = relocs.data();
+    entry.n_relocs = relocs.size();
+    jit_cache::store(scope, id, entry);
+}
+
 void jit_generator_t::transpose(const Xbyak::Reg64 &reg_src,
         const Xbyak::Reg64 &reg_dst, dim_t src_stride, dim_t dst_stride,
         int nrows, int ncolumns, data_type_t dt, Xbyak::Ymm &ymm_tmp,
@@ -22,6 +22,8 @@
 
 #include "common/bit_cast.hpp"
 #include "common/compiler_workarounds.hpp"
+#include "common/jit_cache.hpp"
+#include "common/serialization.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -2766,8 +2768,20 @@ public:
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
-        generate();
+        // A kernel found in the persistent JIT cache is copied from there
+        // instead of being generated.
+        serialization_stream_t cache_id;
+        const auto *cache_scope = get_jit_cache_scope(cache_id);
+        std::vector<Xbyak::uint8> unresolved_code;
+        if (!cache_scope || !load_from_jit_cache(*cache_scope, cache_id)) {
+            generate();
+            if (cache_scope)
+                unresolved_code.assign(Xbyak::CodeArray::getCode(),
+                        Xbyak::CodeArray::getCode() + getSize());
+        }
         jit_ker_ = getCode();
+        if (jit_ker_ && !unresolved_code.empty())
+            store_to_jit_cache(*cache_scope, cache_id, unresolved_code);
         return (jit_ker_) ? status::success : status::runtime_error;
     }
 
@@ -2793,8 +2807,24 @@ private:
 
     static constexpr unsigned max_code_size = 256 * 1024;
 
+    const jit_cache::scope_t *get_jit_cache_scope(
+            serialization_stream_t &id) const;
+    bool load_from_jit_cache(
+            const jit_cache::scope_t &scope, const serialization_stream_t &id);
+    void store_to_jit_cache(const jit_cache::scope_t &scope,
+            const serialization_stream_t &id,
+            std::vector<Xbyak::uint8> &unresolved_code) const;
+
 protected:
     virtual void generate() = 0;
+
+    // Serializes the parameters that fully define the generated code, which
+    // enables the persistent JIT cache for the kernel. Kernels embedding
+    // process-specific addresses into the code, e.g. of data or functions,
+    // must return false.
+    virtual bool serialize_jit_cache_id(serialization_stream_t &sstream) const {
+        return false;
+    }
     const Xbyak::uint8 *jit_ker_ = nullptr;
 };
 
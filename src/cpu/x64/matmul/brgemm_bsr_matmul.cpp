@@ -0,0 +1,352 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc() && !src_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::bsr,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(everyone_is(s32, wei_d.metadata_type(0),
+                             wei_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(one_of(src_dt, f32, bf16) && src_dt == wei_dt
+                    && one_of(dst_dt, f32, src_dt),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(IMPLICATION(src_dt == bf16,
+                             is_superset(isa, avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(src_d.matches_one_of_tag(format_tag::ab)
+                    && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                            format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    CHECK(init_conf(engine));
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::pd_t::init_conf(engine_t *engine) {
+    auto &c = conf_;
+    const memory_desc_wrapper wei_d(weights_md());
+
+    c.isa = isa;
+    c.src_dt = src_md()->data_type;
+    c.wei_dt = weights_md()->data_type;
+    c.dst_dt = dst_md()->data_type;
+    c.M = M();
+    c.N = N();
+    c.K = K();
+    c.bk = wei_d.sparse_desc().block_dims[0];
+    c.bn = wei_d.sparse_desc().block_dims[1];
+    c.nnz = wei_d.nnz();
+
+    // The padded parts of the edge blocks would be read past the end of the
+    // source rows and written past the end of the destination rows.
+    VDISPATCH_MATMUL(c.K % c.bk == 0, VERBOSE_BAD_DIM, "weights", 0);
+    VDISPATCH_MATMUL(c.N % c.bn == 0, VERBOSE_BAD_DIM, "weights", 1);
+    c.nb_K = c.K / c.bk;
+    c.nb_N = c.N / c.bn;
+
+    const bool is_vnni = brgemm_desc_t::is_b_data_layout_vnni(
+            c.src_dt, c.wei_dt, false, isa);
+    c.vnni_granularity = is_vnni
+            ? static_cast<int>(data_type_vnni_granularity(c.wei_dt))
+            : 1;
+    VDISPATCH_MATMUL(c.bk % c.vnni_granularity == 0, VERBOSE_BAD_DIM,
+            "weights", 0);
+
+    c.M_blk = 1 << (pd_t::brg_num - 1);
+    // A chunk shares the list of the blocks of a column between several row
+    // blocks.
+    c.M_chunk = 4 * c.M_blk;
+    c.dst_is_acc = c.dst_dt == f32;
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for (int m_idx = 0; m_idx < brg_num; m_idx++) {
+        const dim_t M = c.M_blk >> m_idx;
+        const dim_t LDC = c.dst_is_acc ? c.N : c.bn;
+        auto &brg = brg_descs_[m_idx];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.src_dt, c.wei_dt,
+                false, false, brgemm_row_major, 1.f, 0.f, c.K, c.bn, LDC, M,
+                c.bn, c.bk));
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = static_cast<int>(c.nb_K);
+        brgattr.hint_expected_A_size = M * c.K;
+        brgattr.hint_expected_B_size = c.bn * c.K;
+        brgattr.hint_expected_C_size = M * c.bn;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_bsr_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    // Blocks of the weights by block column: pointers to the first block of
+    // each column, and the block rows and the indices of the blocks.
+    scratchpad.template book<int32_t>(key_matmul_sparse_tmp_ptr, c.nb_N + 1);
+    scratchpad.template book<int32_t>(
+            key_matmul_sparse_wei_blocks, 2 * c.nnz);
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, c.nthr * c.nb_K);
+    if (c.vnni_granularity > 1)
+        scratchpad.book(key_matmul_sparse_wei_vnni,
+                c.nnz * c.bk * c.bn * types::data_type_size(c.wei_dt), 1,
+                PAGE_4K);
+    if (!c.dst_is_acc)
+        scratchpad.template book<float>(
+                key_matmul_dst_in_acc_dt, c.nthr * c.M_blk * c.bn);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::init(engine_t *engine) {
+    for (int i = 0; i < pd_t::brg_num; i++) {
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(i)));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::prepare_wei(const exec_ctx_t &ctx,
+        const char *values, const int32_t *indices, const int32_t *pointers,
+        const char *&wei) const {
+    const auto &c = pd()->conf();
+    const size_t wei_dt_sz = types::data_type_size(c.wei_dt);
+    const dim_t blk_sz = c.bk * c.bn;
+
+    // The blocks are read from the buffers of `nnz` blocks of the weights
+    // memory.
+    for (dim_t kb = 0; kb < c.nb_K; kb++) {
+        if (pointers[kb] >= 0 && pointers[kb] <= pointers[kb + 1]) continue;
+        VERROR(primitive, matmul, "invalid bsr pointer %d of block row %lld",
+                (int)pointers[kb], (long long)kb);
+        return status::invalid_arguments;
+    }
+    if (pointers[c.nb_K] > c.nnz) {
+        VERROR(primitive, matmul,
+                "number of non-zero blocks %d exceeds nnz %lld",
+                (int)pointers[c.nb_K], (long long)c.nnz);
+        return status::invalid_arguments;
+    }
+    const dim_t nnz = pointers[c.nb_K] - pointers[0];
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    int32_t *col_ptr
+            = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr);
+    int32_t *col_blocks
+            = scratchpad.template get<int32_t>(key_matmul_sparse_wei_blocks);
+
+    // Gather the blocks of each block column, in the order of the block
+    // rows, as (block row, block index) pairs.
+    std::memset(col_ptr, 0, (c.nb_N + 1) * sizeof(int32_t));
+    for (dim_t blk = pointers[0]; blk < pointers[c.nb_K]; blk++) {
+        if (indices[blk] < 0 || indices[blk] >= c.nb_N) {
+            VERROR(primitive, matmul,
+                    "bsr block column %d of block %lld is out of %lld",
+                    (int)indices[blk], (long long)blk, (long long)c.nb_N);
+            return status::invalid_arguments;
+        }
+        col_ptr[indices[blk] + 1]++;
+    }
+    for (dim_t nb = 0; nb < c.nb_N; nb++)
+        col_ptr[nb + 1] += col_ptr[nb];
+    for (dim_t kb = 0; kb < c.nb_K; kb++) {
+        for (dim_t blk = pointers[kb]; blk < pointers[kb + 1]; blk++) {
+            const dim_t pos = col_ptr[indices[blk]]++;
+            col_blocks[2 * pos] = static_cast<int32_t>(kb);
+            col_blocks[2 * pos + 1] = static_cast<int32_t>(blk);
+        }
+    }
+    // Filling the lists moved each pointer to the start of the next column.
+    for (dim_t nb = c.nb_N; nb > 0; nb--)
+        col_ptr[nb] = col_ptr[nb - 1];
+    col_ptr[0] = 0;
+
+    wei = values;
+    if (c.vnni_granularity == 1) return status::success;
+
+    // The values of the blocks are converted to the VNNI layout expected by
+    // the kernel: pairs of consecutive rows are interleaved.
+    char *wei_vnni = scratchpad.template get<char>(key_matmul_sparse_wei_vnni);
+    const char *blk_values = values + pointers[0] * blk_sz * wei_dt_sz;
+    const dim_t vnni = c.vnni_granularity;
+    parallel_nd(nnz, c.bk, [&](dim_t blk, dim_t k) {
+        const char *blk_src = blk_values + blk * blk_sz * wei_dt_sz;
+        char *blk_dst = wei_vnni + blk * blk_sz * wei_dt_sz;
+        const dim_t row_off = (k / vnni) * c.bn * vnni + k % vnni;
+        for (dim_t n = 0; n < c.bn; n++) {
+            const dim_t off = row_off + n * vnni;
+            std::memcpy(blk_dst + off * wei_dt_sz,
+                    blk_src + (k * c.bn + n) * wei_dt_sz, wei_dt_sz);
+        }
+    });
+    wei = wei_vnni - pointers[0] * blk_sz * wei_dt_sz;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf();
+
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto values = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS, 0);
+    const auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const size_t src_dt_sz = types::data_type_size(c.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(c.wei_dt);
+    const size_t dst_dt_sz = types::data_type_size(c.dst_dt);
+    const dim_t blk_sz = c.bk * c.bn;
+
+    // The weights are prepared at each execution since their buffers may be
+    // updated in place between executions.
+    const char *wei = nullptr;
+    CHECK(prepare_wei(ctx, values, indices, pointers, wei));
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const int32_t *col_ptr
+            = scratchpad.template get<int32_t>(key_matmul_sparse_tmp_ptr);
+    const int32_t *col_blocks
+            = scratchpad.template get<int32_t>(key_matmul_sparse_wei_blocks);
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+    float *acc_base = scratchpad.template get<float>(key_matmul_dst_in_acc_dt);
+
+    const dim_t nb_M_chunks = div_up(c.M, c.M_chunk);
+    const dim_t work_amount = nb_M_chunks * c.nb_N;
+
+    const auto ker = [&](int ithr, int nthr, dim_t start, dim_t end) {
+        brgemm_batch_element_t *batch = batch_base + ithr * c.nb_K;
+        float *acc = c.dst_is_acc ? nullptr : acc_base + ithr * c.M_blk * c.bn;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t nb = iwork % c.nb_N;
+            const dim_t m_chunk = iwork / c.nb_N;
+            const dim_t m_beg = m_chunk * c.M_chunk;
+            const dim_t m_end = nstl::min(m_beg + c.M_chunk, c.M);
+            const dim_t n_start = nb * c.bn;
+            const int bs = col_ptr[nb + 1] - col_ptr[nb];
+            const int32_t *blocks = col_blocks + 2 * col_ptr[nb];
+
+            if (bs == 0) {
+                for (dim_t m = m_beg; m < m_end; m++)
+                    std::memset(dst + (m * c.N + n_start) * dst_dt_sz, 0,
+                            c.bn * dst_dt_sz);
+                continue;
+            }
+
+            for (int i = 0; i < bs; i++)
+                batch[i].ptr.B = wei + blocks[2 * i + 1] * blk_sz * wei_dt_sz;
+
+            for (dim_t m = m_beg; m < m_end;) {
+                // Largest row block which fits into the remaining rows.
+                int m_idx = 0;
+                while ((c.M_blk >> m_idx) > m_end - m)
+                    m_idx++;
+                const dim_t m_cur = c.M_blk >> m_idx;
+
+                for (int i = 0; i < bs; i++)
+                    batch[i].ptr.A = src
+                            + (m * c.K + blocks[2 * i] * c.bk) * src_dt_sz;
+                char *ptr_C = c.dst_is_acc
+                        ? dst + (m * c.N + n_start) * dst_dt_sz
+                        : reinterpret_cast<char *>(acc);
+                brgemm_kernel_execute(
+                        brg_kernels_[m_idx].get(), bs, batch, ptr_C);
+                if (!c.dst_is_acc) {
+                    for_(dim_t i = 0; i < m_cur; i++)
+                    for (dim_t j = 0; j < c.bn; j++)
+                        io::store_float_value(c.dst_dt, acc[i * c.bn + j],
+                                dst, (m + i) * c.N + n_start + j);
+                }
+                m += m_cur;
+            }
+        }
+    };
+
+    parallel_dynamic(c.nthr, work_amount, ker);
+
+    return status::success;
+}
+
+template struct brgemm_bsr_matmul_t<avx512_core_bf16>;
+template struct brgemm_bsr_matmul_t<avx512_core>;
+template struct brgemm_bsr_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,111 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Dense source times BSR-encoded weights of `bk` x `bn` blocks. A block of
+// the destination columns depends on the weights blocks of the same block
+// column only, which are gathered into a list sorted by the block row. The
+// destination block is then computed by a single batch-reduce brgemm call
+// over the stored blocks, the source rows of the batch element being those of
+// the block row. Block columns without stored blocks are zero.
+struct brgemm_bsr_matmul_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, wei_dt, dst_dt;
+
+    dim_t M, N, K;
+    // Block shape of the weights.
+    dim_t bk, bn;
+    dim_t nb_K, nb_N, nnz;
+    dim_t M_blk, M_chunk;
+    int vnni_granularity;
+
+    // The accumulator is the destination itself.
+    bool dst_is_acc;
+    int nthr;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_bsr_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_bsr:", isa, ""),
+                brgemm_bsr_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels for `M_blk >> m_idx` rows.
+        static constexpr int brg_num = 6;
+
+        const brgemm_bsr_matmul_conf_t &conf() const { return conf_; }
+        const brgemm_desc_t &brg_desc(int idx) const { return brg_descs_[idx]; }
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_bsr_matmul_conf_t conf_ = utils::zero<decltype(conf_)>();
+        brgemm_desc_t brg_descs_[brg_num];
+    };
+
+    brgemm_bsr_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Gathers the blocks of the weights by block column and converts their
+    // values to the VNNI layout when the kernel needs it, into the
+    // scratchpad. Sets `wei` to the values read by the kernel, addressed by
+    // the block index. Fails if the pointers or the indices are out of range.
+    status_t prepare_wei(const exec_ctx_t &ctx, const char *values,
+            const int32_t *indices, const int32_t *pointers,
+            const char *&wei) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::brg_num];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,381 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    const auto src_dt = src_md(0)->data_type;
+    const auto wei_dt = weights_md(0)->data_type;
+    const auto bia_dt = weights_md(1)->data_type;
+    const auto dst_dt = dst_md(0)->data_type;
+
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(is_grouped(), VERBOSE_BAD_PARAM, "group_offsets");
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    // Signed int8 sources require compensation, only u8 is supported.
+    const bool is_int8 = src_dt == u8 && wei_dt == s8;
+    VDISPATCH_MATMUL(
+            (one_of(src_dt, f32, bf16, f16) && src_dt == wei_dt)
+                    || (is_int8 && is_superset(isa, avx512_core)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(src_dt == bf16,
+                             is_superset(isa, avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(src_dt == f16,
+                             is_superset(isa, avx512_core_fp16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(is_int8 ? one_of(dst_dt, f32, s32, s8, u8)
+                             : one_of(dst_dt, f32, src_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(),
+                             is_int8 ? one_of(bia_dt, f32, s32)
+                                     : one_of(bia_dt, f32, src_dt)),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(
+            attr()->has_default_values(smask_t::scales_data_type
+                            | smask_t::post_ops | smask_t::sum_dt,
+                    dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(attr_.post_ops_.check_sum_consistency(dst_dt, is_int8),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(IMPLICATION(has_runtime_dims_or_strides(),
+                             attr()->post_ops_.has_default_values(
+                                     {primitive_kind::eltwise,
+                                             primitive_kind::sum})),
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(grouped_attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    CHECK(init_conf(engine));
+    VDISPATCH_MATMUL(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_conf(engine_t *engine) {
+    using namespace format_tag;
+    auto &c = conf_;
+
+    c.isa = isa;
+    c.src_dt = src_md(0)->data_type;
+    c.wei_dt = weights_md(0)->data_type;
+    c.dst_dt = dst_md(0)->data_type;
+    c.bia_dt = with_bias() ? weights_md(1)->data_type : data_type::undef;
+    c.acc_dt = c.src_dt == u8 ? s32 : f32;
+    c.G = n_groups();
+    c.K = K();
+    c.N = N();
+
+    c.vnni_granularity
+            = brgemm_desc_t::is_b_data_layout_vnni(c.src_dt, c.wei_dt, false, isa)
+            ? static_cast<int>(data_type_vnni_granularity(c.wei_dt))
+            : 1;
+    VDISPATCH_MATMUL(c.K % c.vnni_granularity == 0, VERBOSE_BAD_DIM, "src", 1);
+
+    // The weights of each group are expected packed in panels of N_blk
+    // columns consumed by the kernel as they are. Plain f32 weights are
+    // consumed directly as well.
+    c.N_blk = 64;
+    const format_tag_t wei_packed_tag = c.vnni_granularity == 4
+            ? aCB16b64c4b
+            : c.vnni_granularity == 2 ? aCB16b64c2b : aCB16b64c;
+    if (weights_md_.format_kind == format_kind::any)
+        VDISPATCH_MATMUL_SC(memory_desc_init_by_tag(weights_md_, wei_packed_tag),
+                VERBOSE_UNSUPPORTED_TAG);
+    const memory_desc_wrapper wei_d(weights_md_);
+    const bool wei_packed = wei_d.matches_tag(wei_packed_tag);
+    const bool wei_plain = c.vnni_granularity == 1 && wei_d.matches_tag(abc)
+            && !wei_d.has_runtime_strides();
+    VDISPATCH_MATMUL(wei_packed || wei_plain, VERBOSE_UNSUPPORTED_TAG);
+    c.LDB = wei_packed ? c.N_blk : wei_d.blocking_desc().strides[1];
+
+    // The number of rows may be defined at execution time, the row strides
+    // of the source and the destination may not.
+    for (auto md : {&src_md_, &dst_md_, &bias_md_}) {
+        if (md->ndims == 0 || md->format_kind != format_kind::any) continue;
+        VDISPATCH_MATMUL_SC(
+                memory_desc_init_by_tag(*md, ab), VERBOSE_UNSUPPORTED_TAG);
+    }
+    const memory_desc_wrapper src_d(src_md_), dst_d(dst_md_);
+    for (const auto *d : {&src_d, &dst_d}) {
+        VDISPATCH_MATMUL(d->is_blocking_desc()
+                        && d->blocking_desc().inner_nblks == 0
+                        && d->blocking_desc().strides[1] == 1
+                        && d->blocking_desc().strides[0] != DNNL_RUNTIME_DIM_VAL,
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+    c.LDA = src_d.blocking_desc().strides[0];
+    c.LDD = dst_d.blocking_desc().strides[0];
+
+    c.N_tail = c.N % c.N_blk;
+    c.nb_N = div_up(c.N, c.N_blk);
+    c.M_blk = 1 << (pd_t::max_m_kernels - 1);
+    // A chunk shares the weights panel between several row blocks.
+    c.M_chunk = 4 * c.M_blk;
+
+    c.with_bias = with_bias();
+    c.bias_per_group = c.with_bias && weights_md(1)->dims[0] != 1;
+
+    const auto &scales = attr()->scales_;
+    c.with_wei_scales = !scales.has_default_values(DNNL_ARG_WEIGHTS);
+    const int wei_scale_mask = scales.get_mask(DNNL_ARG_WEIGHTS);
+    c.wei_scales_per_group = c.with_wei_scales && (wei_scale_mask & 1);
+    c.wei_scales_per_n
+            = c.with_wei_scales && (wei_scale_mask & wei_qmask_N());
+
+    c.dst_is_acc = c.dst_dt == c.acc_dt && !c.with_bias
+            && attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::none, c.dst_dt);
+    c.nthr = dnnl_get_max_threads();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &c = conf_;
+
+    for_(int m_idx = 0; m_idx < max_m_kernels; m_idx++)
+    for (int n_tail = 0; n_tail < 2; n_tail++) {
+        const dim_t M = c.M_blk >> m_idx;
+        const dim_t N = n_tail ? c.N_tail : nstl::min(c.N, c.N_blk);
+        if (N == 0 || (n_tail && c.N < c.N_blk)) continue;
+
+        const dim_t LDC = c.dst_is_acc ? c.LDD : c.N_blk;
+        auto &brg = brg_descs_[get_brg_idx(m_idx, n_tail)];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, c.src_dt, c.wei_dt,
+                false, false, brgemm_row_major, 1.f, 0.f, c.LDA, c.LDB, LDC,
+                M, N, c.K));
+        // Scales, bias and post-ops are applied by the kernel while the
+        // accumulator is stored to the destination.
+        VDISPATCH_MATMUL_SC(brgemm_desc_set_postops(&brg, attr(), &dst_md_,
+                                    c.LDD, c.bia_dt),
+                VERBOSE_UNSUPPORTED_POSTOP);
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+        brgattr.hint_expected_A_size = M * c.K;
+        brgattr.hint_expected_B_size = N * c.K;
+        brgattr.hint_expected_C_size = M * N;
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        CHECK(brgemm_desc_finalize(&brg));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    scratchpad.template book<dim_t>(key_matmul_group_work, c.G + 1);
+    if (!c.dst_is_acc)
+        scratchpad.book(key_matmul_group_acc,
+                c.nthr * c.M_blk * c.N_blk, types::data_type_size(c.acc_dt));
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::init(engine_t *engine) {
+    for (int i = 0; i < pd_t::brg_num; i++) {
+        const auto &brg = pd()->brg_desc(i);
+        if (brg.bcast_dim == 0 || brg.load_dim == 0) continue;
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[i], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf();
+
+    status_t status = status::success;
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    const auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_GROUP_OFFSETS);
+    auto dst = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const void *src_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
+    const void *wei_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *dst_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
+
+    const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
+    const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+
+    dim_t rows = 0;
+    CHECK(cpu::matmul::check_group_offsets(
+            offsets, c.G, src_d.dims()[0], rows));
+    if (rows == 0 || c.N == 0) return status::success;
+
+    const auto &attr_scales = pd()->attr()->scales_;
+    const float src_scale = attr_scales.has_default_values(DNNL_ARG_SRC)
+            ? 1.f
+            : io::load_float_value(
+                    attr_scales.get_data_type(DNNL_ARG_SRC), src_scales, 0);
+    // The kernel multiplies the result by the inverted destination scale.
+    const float dst_scale_inv = attr_scales.has_default_values(DNNL_ARG_DST)
+            ? 1.f
+            : 1.f
+                    / io::load_float_value(attr_scales.get_data_type(
+                                                   DNNL_ARG_DST),
+                            dst_scales, 0);
+    const size_t wei_scale_dt_sz = c.with_wei_scales
+            ? types::data_type_size(
+                    attr_scales.get_data_type(DNNL_ARG_WEIGHTS))
+            : 0;
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const size_t src_dt_sz = types::data_type_size(c.src_dt);
+    const size_t wei_dt_sz = types::data_type_size(c.wei_dt);
+    const size_t dst_dt_sz = types::data_type_size(c.dst_dt);
+    const size_t bia_dt_sz
+            = c.with_bias ? types::data_type_size(c.bia_dt) : 0;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *acc_base = scratchpad.template get<char>(key_matmul_group_acc);
+    const size_t acc_dt_sz = types::data_type_size(c.acc_dt);
+
+    // Work items of the group `g` are [work_start[g], work_start[g + 1]),
+    // each one is a chunk of rows times a block of columns.
+    dim_t *work_start = scratchpad.template get<dim_t>(key_matmul_group_work);
+    work_start[0] = 0;
+    for (dim_t g = 0; g < c.G; g++) {
+        const dim_t g_rows = offsets[g] - (g > 0 ? offsets[g - 1] : 0);
+        work_start[g + 1]
+                = work_start[g] + div_up(g_rows, c.M_chunk) * c.nb_N;
+    }
+    const dim_t work_amount = work_start[c.G];
+
+    const auto ker = [&](int ithr, int nthr, dim_t start, dim_t end) {
+        char *acc = c.dst_is_acc
+                ? nullptr
+                : acc_base + ithr * c.M_blk * c.N_blk * acc_dt_sz;
+        brgemm_batch_element_t batch;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            // Empty groups share their start with the next group, the last
+            // group starting at or before `iwork` owns it.
+            const dim_t g = std::upper_bound(
+                                    work_start, work_start + c.G + 1, iwork)
+                    - work_start - 1;
+            const dim_t g_work = iwork - work_start[g];
+            const dim_t n_blk = g_work % c.nb_N;
+            const dim_t m_chunk = g_work / c.nb_N;
+
+            const dim_t g_end = offsets[g];
+            const dim_t m_beg
+                    = (g > 0 ? offsets[g - 1] : 0) + m_chunk * c.M_chunk;
+            const dim_t m_end = nstl::min(m_beg + c.M_chunk, g_end);
+            const dim_t n_start = n_blk * c.N_blk;
+            const dim_t n_cur = nstl::min(c.N_blk, c.N - n_start);
+            const bool n_tail = n_cur < c.N_blk && c.N > c.N_blk;
+
+            batch.ptr.B = wei + wei_d.off(g, 0, n_start) * wei_dt_sz;
+            const char *ptr_bias = c.with_bias
+                    ? static_cast<const char *>(bias)
+                            + bia_d.off(c.bias_per_group ? g : 0, n_start)
+                                    * bia_dt_sz
+                    : nullptr;
+            const char *ptr_wei_scales = c.with_wei_scales
+                    ? static_cast<const char *>(wei_scales)
+                            + ((c.wei_scales_per_group ? g * c.N : 0)
+                                      + (c.wei_scales_per_n ? n_start : 0))
+                                    * wei_scale_dt_sz
+                    : nullptr;
+            for (dim_t m = m_beg; m < m_end;) {
+                // Largest row block which fits into the remaining rows.
+                int m_idx = 0;
+                while ((c.M_blk >> m_idx) > m_end - m)
+                    m_idx++;
+                const dim_t m_cur = c.M_blk >> m_idx;
+
+                batch.ptr.A = src + src_d.off(m, 0) * src_dt_sz;
+                char *ptr_D = dst + dst_d.off(m, n_start) * dst_dt_sz;
+                const auto brg_kernel
+                        = brg_kernels_[pd_t::get_brg_idx(m_idx, n_tail)].get();
+                if (c.dst_is_acc) {
+                    brgemm_kernel_execute(brg_kernel, 1, &batch, ptr_D);
+                } else {
+                    const brgemm_post_ops_data_t post_ops_data {ptr_bias,
+                            post_ops_binary_rhs_arg_vec.data(),
+                            static_cast<size_t>(n_start),
+                            static_cast<size_t>(m), dst,
+                            static_cast<size_t>(dst_d.off(m, n_start)), nullptr,
+                            nullptr, nullptr, false, 1, false, false,
+                            &src_scale, ptr_wei_scales, &dst_scale_inv};
+                    brgemm_kernel_execute_postops(brg_kernel, 1, &batch, acc,
+                            ptr_D, post_ops_data, nullptr);
+                }
+                m += m_cur;
+            }
+        }
+    };
+
+    parallel_dynamic(c.nthr, work_amount, ker);
+
+    return status::success;
+}
+
+template struct brgemm_grouped_matmul_t<avx512_core_fp16>;
+template struct brgemm_grouped_matmul_t<avx512_core_bf16>;
+template struct brgemm_grouped_matmul_t<avx512_core>;
+template struct brgemm_grouped_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Grouped (ragged) matmul: the rows of the source are split into consecutive
+// groups of sizes known at execution time only, and the rows of group `g` are
+// multiplied by the `g`-th weights matrix. Every group is cut into chunks of
+// `M_chunk` rows times blocks of `N_blk` columns, and the chunks of all the
+// groups are scheduled in a single parallel region. As the number of rows of
+// the last block of a group is arbitrary, it is processed by the kernels for
+// `M_blk / 2`, `M_blk / 4`, ..., 1 rows.
+struct brgemm_grouped_matmul_conf_t {
+    cpu_isa_t isa;
+    data_type_t src_dt, wei_dt, dst_dt, bia_dt, acc_dt;
+
+    dim_t G, K, N;
+    dim_t M_blk, M_chunk, N_blk, nb_N, N_tail;
+    // Row strides of the source, the destination and the weights panels.
+    dim_t LDA, LDB, LDD;
+    int vnni_granularity;
+
+    bool with_bias, bias_per_group;
+    bool with_wei_scales, wei_scales_per_group, wei_scales_per_n;
+    // The accumulator is written to the destination by the kernel itself,
+    // no post-processing is required.
+    bool dst_is_acc;
+    int nthr;
+};
+
+template <cpu_isa_t isa>
+struct brgemm_grouped_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_grouped:", isa, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels for `M_blk >> m_idx` rows, with an optional N tail.
+        static constexpr int max_m_kernels = 6;
+        static constexpr int brg_num = 2 * max_m_kernels;
+        static int get_brg_idx(int m_idx, bool n_tail) {
+            return 2 * m_idx + n_tail;
+        }
+
+        const brgemm_grouped_matmul_conf_t &conf() const { return conf_; }
+        const brgemm_desc_t &brg_desc(int idx) const { return brg_descs_[idx]; }
+
+    private:
+        status_t init_conf(engine_t *engine);
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_grouped_matmul_conf_t conf_ = utils::zero<decltype(conf_)>();
+        brgemm_desc_t brg_descs_[brg_num];
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[pd_t::brg_num];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
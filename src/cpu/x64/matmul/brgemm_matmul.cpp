@@ -22,7 +22,9 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/cpu_tuning.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/platform.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -108,9 +110,15 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto wei_dt = weights_md_.data_type;
     const auto dst_dt = dst_md_.data_type;
 
+    // With source dynamic quantization an f32 or bf16 source is quantized to
+    // s8 while copied, so the problem is computed as an int8 one.
+    const bool with_src_dynamic_quant
+            = !attr()->dynamic_quantization_.has_default_values(DNNL_ARG_SRC);
     const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
-    const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8
-            && one_of(dst_dt, u8, s8, s32, f32, f16, bf16);
+    const bool is_int8 = (one_of(src_dt, u8, s8)
+                                 || (with_src_dynamic_quant
+                                         && one_of(src_dt, f32, bf16)))
+            && wei_dt == s8 && one_of(dst_dt, u8, s8, s32, f32, f16, bf16);
     const bool is_f8 = one_of(src_dt, f8_e5m2, f8_e4m3)
             && one_of(wei_dt, f8_e5m2, f8_e4m3)
             && one_of(dst_dt, f32, f16, bf16, f8_e5m2, f8_e4m3);
@@ -240,7 +248,9 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                                     zero_points_data_type
                             | primitive_attr_t::skip_mask_t::post_ops
                             | primitive_attr_t::skip_mask_t::sum_dt
-                            | primitive_attr_t::skip_mask_t::fpmath_mode,
+                            | primitive_attr_t::skip_mask_t::fpmath_mode
+                            | primitive_attr_t::skip_mask_t::
+                                    dynamic_quantization,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
     const auto &po = attr()->post_ops_;
@@ -259,8 +269,12 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_reduce(), VERBOSE_UNSUPPORTED_FEATURE,
             "reduce is not supported");
 
+    if (tuning_candidate_ < 0 && tuning_db::is_enabled())
+        CHECK(tuning::pick_candidate<brgemm_matmul_t>(this, engine,
+                brgemm_matmul_n_tuning_candidates, tuning_candidate_));
+
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
-            dst_md_, bias_md_, attr_));
+            dst_md_, bias_md_, attr_, tuning_candidate_));
 
     // f32:f16 configuration on AVX2 doesn't support tails with proper
     // instruction sequence in copy routines. Anchor: F32_F16_AVX2_NO_TAIL.
@@ -295,6 +309,11 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const int i_init_start = bgmmc_.K_blk != bgmmc_.K ? 0 : 1;
     const int i_K_end = bgmmc_.K_tail ? 2 : 1;
 
+    // Dynamically computed source scales are passed to the kernels per row.
+    primitive_attr_t brg_attr(*attr());
+    if (bgmmc_.with_src_dynamic_quant)
+        CHECK(brg_attr.scales_.set(DNNL_ARG_SRC, src_qmask_M()));
+
     for_(int i_bs = 0; i_bs < i_bs_end; i_bs++)
     for_(int i_init = i_init_start; i_init < 2; i_init++)
     for_(int i_M = 0; i_M < max_m_ker_idx; i_M++)
@@ -335,7 +354,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             brg.skip_zp_b_compensation = true;
         if (bgmmc_.apply_scales_in_buffer_b) brg.skip_scales = true;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+                &brg, &brg_attr, &dst_md_, LDD, bgmmc_.bia_dt));
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -410,9 +429,8 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
                 i_bs, i_init, i_M, i_N, i_K, prefetching);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        CHECK(brgemm_kernel_get_or_create(
+                brg_kernels_[idx], pd()->get_brg_desc(idx)));
         if (is_superset(pd()->get_brg_desc(idx).isa_impl, avx512_core_amx))
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
 
@@ -510,13 +528,20 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     const int N_chunks = brgmm_ctx.get_N_chunks();
     const int N_chunk_tail = brgmm_ctx.get_N_chunk_tail();
+
+    std::shared_ptr<const weights_replicas_t> wei_replicas;
+    if (bgmmc.replicate_weights)
+        get_weights_replicas(CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS),
+                weights_d.size(), wei_replicas);
+
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn_gemm(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
         if (ithr_bmn < 0 || ithr_k < 0) return;
         int start {0}, end {0};
         balance211(brgmm_ctx.get_parallel_work_amount_gemm(),
-                brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn, start, end);
+                brgmm_ctx.get_num_threads_for_bmn(), ithr_bmn,
+                brgmm_ctx.get_bmn_thread_weights(), start, end);
         int kc_start {0}, kc_end {bgmmc.K_chunks};
         if (brgmm_ctx.parallel_reduction_is_used())
             balance211((int)bgmmc.K_chunks, brgmm_ctx.get_num_threads_for_k(),
@@ -571,6 +596,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
         int b_prev = -1;
         const char *a_batch_ptr = nullptr;
         const char *b_batch_ptr = nullptr;
+        const int numa_node = wei_replicas ? platform::get_numa_node() : 0;
 
         while (start < end) {
             if (mc >= M_chunks || nc >= N_chunks || b >= bgmmc.batch) {
@@ -589,6 +615,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             if (b != b_prev) {
                 a_batch_ptr = brgmm_ctx.get_data_A_batch_ptr(b);
                 b_batch_ptr = brgmm_ctx.get_data_B_batch_ptr(b);
+                if (wei_replicas)
+                    b_batch_ptr = wei_replicas->local(b_batch_ptr, numa_node);
             }
             for_(int kc = kc_start; kc < kc_end; kc++)
             {
@@ -736,7 +764,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_src_scales_ptr(),
+                    false, brgmm_ctx.get_src_scales_ptr(ithr, m_blk_idx),
                     brgmm_ctx.get_wei_scales_ptr(n),
                     brgmm_ctx.get_dst_scales_inv_ptr(ithr)};
             brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
@@ -792,7 +820,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_src_scales_ptr(),
+                    false, brgmm_ctx.get_src_scales_ptr(ithr, m_blk_idx),
                     brgmm_ctx.get_wei_scales_ptr(n),
                     brgmm_ctx.get_dst_scales_inv_ptr(ithr)};
 
@@ -1143,6 +1171,7 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     ctx.zp_b_neg_value_ptr = (void *)brgmm_ctx.get_zp_b_neg_val_ptr();
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
     ctx.dynamic_src_ld = brgmm_ctx.get_src_stride();
+    ctx.src_scales_ptr = brgmm_ctx.get_src_dq_scales_ptr(ithr, m_blk_idx);
 
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
@@ -1415,6 +1444,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 ? scratchpad.template get<int32_t>(
                         key_brgemm_primitive_zp_comp_b)
                 : nullptr;
+        src_dq_scales_ptr_ = bgmmc.with_src_dynamic_quant
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_src_dq_scales)
+                : nullptr;
 
         zero_point_mixed_ab_compensation_component_
                 = bgmmc.K * zero_point_a_negative_val_;
@@ -1634,6 +1667,15 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         num_threads_used_ = nthr_k_ * nthr_bmn_;
 
+        // On hybrid CPUs the bmn work is distributed according to the
+        // throughput of the threads. The weight of a bmn thread index is the
+        // total weight of the threads sharing it for the K reduction.
+        if (const float *w = platform::get_thread_weights(num_threads_used_)) {
+            bmn_weights_.assign(nthr_bmn_, 0.f);
+            for (int ithr = 0; ithr < num_threads_used_; ithr++)
+                bmn_weights_[ithr % nthr_bmn_] += w[ithr];
+        }
+
         const bool need_to_calculate_compensation_for_a
                 = bgmmc.has_zero_point_b && !bgmmc.with_wei_decompression;
         const bool need_to_calculate_compensation_for_b = !IMPLICATION(
@@ -1999,6 +2041,25 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
     const void *get_src_scales_ptr() const { return src_scales_; }
 
+    // Returns the source scales to apply to the block @p m_blk_idx: per-row
+    // scales computed by the copy routine with dynamic quantization, the user
+    // scales otherwise.
+    const void *get_src_scales_ptr(int ithr, int m_blk_idx) const {
+        if (bgmmc_.with_src_dynamic_quant)
+            return get_src_dq_scales_ptr(ithr, m_blk_idx);
+        return src_scales_;
+    }
+
+    // The scales of the rows of the block are followed by their inverted
+    // values used for quantization.
+    float *get_src_dq_scales_ptr(int ithr, int m_blk_idx) const {
+        if (!bgmmc_.with_src_dynamic_quant) return nullptr;
+
+        const int m_blk_local = m_blk_idx % get_M_chunk_size();
+        return src_dq_scales_ptr_ + ithr * bgmmc_.src_dq_scales_elems_per_thr
+                + m_blk_local * 2 * bgmmc_.M_blk;
+    }
+
     // Returns a pointer to the weights scales for the correspondent block based
     // on @p n and @p k.
     //
@@ -2219,6 +2280,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return nthr_k_ > 1 && bgmmc_.K_chunks > 1;
     }
     int get_num_threads_for_bmn() const { return nthr_bmn_; }
+    // Returns nullptr if the bmn work is split evenly.
+    const float *get_bmn_thread_weights() const {
+        return bmn_weights_.empty() ? nullptr : bmn_weights_.data();
+    }
     // ithr = ithr_k * nthr_bmn + ithr_bmn
     int get_thread_idx_for_k(int ithr) const {
         if (ithr >= num_threads_used_) return -1;
@@ -2481,6 +2546,7 @@ private:
     int32_t *zero_point_a_compensations_ptr_;
     int32_t *zero_point_b_compensations_ptr_;
     int32_t *reorder_zp_a_comp_ptr_;
+    float *src_dq_scales_ptr_;
 
     int32_t zero_point_a_negative_val_;
     int32_t zero_point_b_val_;
@@ -2496,6 +2562,7 @@ private:
     int parallel_work_amount_;
     int parallel_work_amount_gemm_;
     int nthr_, nthr_k_, nthr_bmn_, num_threads_used_;
+    std::vector<float> bmn_weights_;
     // Horizontal order means first process N (load) dim then M (bcast) dim.
     bool is_thread_chunks_exec_order_horizontal_;
     int last_brgemm_batch_size_;
@@ -21,6 +21,7 @@
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_weights_replicas.hpp"
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
 #include "cpu/x64/brgemm/brgemm.hpp"
@@ -67,10 +68,15 @@ struct brgemm_matmul_t : public primitive_t {
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
         }
+        void set_tuning_candidate(int candidate) {
+            tuning_candidate_ = candidate;
+        }
 
     private:
         brgemm_desc_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
+        // Blocking candidate of the runtime autotuning, -1 for the heuristic.
+        int tuning_candidate_ = -1;
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -112,7 +118,7 @@ private:
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
+    std::shared_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
     brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {
             max_num_brg_kernels_matmul};
 
@@ -526,6 +526,278 @@ void jit_brgemm_matmul_copy_a_impl_t<Vmm>::generate() {
 template struct jit_brgemm_matmul_copy_a_impl_t<Zmm>;
 template struct jit_brgemm_matmul_copy_a_impl_t<Ymm>;
 
+// Copies the f32 or bf16 source to the A buffer quantizing it to s8 with a
+// scale per row (dynamic quantization):
+//     scale = max(|src|) / 127, s8 = round(src * (127 / max(|src|))),
+// where the maximum is taken over the whole row. The scales and their inverted
+// values are computed when the first K block is copied and reused for the
+// next ones. The vectors of the first K block read by the maximum stay in
+// registers and are quantized from there.
+struct jit_brgemm_matmul_quantize_a_impl_t : public jit_brgemm_matmul_copy_a_t,
+                                             public jit_generator_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_quantize_a_impl_t)
+
+    jit_brgemm_matmul_quantize_a_impl_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator_t(jit_name())
+        , typesize_(conf_->a_dt_sz)
+        , src_stride_(conf_->copy_A_src_stride)
+        , tr_src_stride_(conf_->LDA * conf_->tr_a_dt_sz)
+        , inv_scales_offset_(conf_->M_blk * sizeof(float))
+        , is_bf16_(conf_->orig_src_dt == data_type::bf16) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator_t::operator()(ctx); }
+    status_t create_kernel() override {
+        return jit_generator_t::create_kernel();
+    }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+
+    static constexpr int simd_w_ = 16;
+    static constexpr int max_unroll_ = 4;
+    static constexpr int max_kept_vecs_ = 16;
+
+    const int typesize_;
+    const dim_t src_stride_;
+    const dim_t tr_src_stride_;
+    const dim_t inv_scales_offset_;
+    const bool is_bf16_;
+
+    opmask_t kRow_tail = k1;
+    opmask_t kBlk_tail = k2;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_scales = rdx;
+    reg64_t reg_K_start = abi_not_param1;
+    reg64_t reg_K_blk = r8;
+    reg64_t reg_M_blk = r9;
+    reg64_t reg_aux_src = r10;
+    reg64_t reg_iters = r11;
+    reg64_t reg_tmp = r12;
+
+    // Zmm(0) - Zmm(3) hold partial maximums, Zmm(4) - Zmm(7) the data.
+    const Zmm zmm_max_s8 = Zmm(8);
+    const Zmm zmm_zero = Zmm(9);
+    const Zmm zmm_inv_scale = Zmm(10);
+    const Zmm zmm_abs_mask = Zmm(11);
+
+    Zmm zmm_max(int i) {
+        assert(i >= 0 && i < max_unroll_);
+        return Zmm(i);
+    }
+
+    Zmm zmm_data(int i) {
+        assert(i >= 0 && i < max_unroll_);
+        return Zmm(max_unroll_ + i);
+    }
+
+    // Zmm(12) - Zmm(27) hold the vectors of the first K block.
+    Zmm zmm_kept(int i) {
+        assert(i >= 0 && i < max_kept_vecs_);
+        return Zmm(12 + i);
+    }
+
+    void set_tail_mask(opmask_t &k, int tail) {
+        mov(reg_tmp.cvt32(), (1 << tail) - 1);
+        jit_generator_t::kmovw(k, reg_tmp.cvt32());
+    }
+
+    void load(const Zmm &zmm, const Xbyak::Address &addr, opmask_t *k_tail);
+    int num_kept_vecs(int K_blk) const;
+    void compute_row_scale(int K_blk);
+    void quantize_row(int K_blk, int n_kept);
+    void copy_M_loop(int K_blk, bool compute_scales);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_quantize_a_impl_t::load(
+        const Zmm &zmm, const Xbyak::Address &addr, opmask_t *k_tail) {
+    if (is_bf16_) {
+        if (k_tail)
+            vpmovzxwd(zmm | *k_tail | T_z, addr);
+        else
+            vpmovzxwd(zmm, addr);
+        vpslld(zmm, zmm, 16);
+    } else {
+        if (k_tail)
+            vmovups(zmm | *k_tail | T_z, addr);
+        else
+            vmovups(zmm, addr);
+    }
+}
+
+int jit_brgemm_matmul_quantize_a_impl_t::num_kept_vecs(int K_blk) const {
+    // A partial vector is kept only if it ends the row: otherwise the
+    // maximum needs the elements past the block.
+    const bool keep_tail = K_blk == conf_->K && K_blk % simd_w_ > 0;
+    const int n_vecs = K_blk / simd_w_ + keep_tail;
+    return n_vecs < max_kept_vecs_ ? n_vecs : max_kept_vecs_;
+}
+
+void jit_brgemm_matmul_quantize_a_impl_t::compute_row_scale(int K_blk) {
+    // The first K block starts the row, so `reg_src` points to its beginning.
+    for (int i = 0; i < max_unroll_; i++)
+        vpxord(zmm_max(i), zmm_max(i), zmm_max(i));
+
+    const int n_kept = num_kept_vecs(K_blk);
+    const bool tail_kept = n_kept > K_blk / simd_w_;
+    for (int i = 0; i < n_kept; i++) {
+        const bool is_tail = tail_kept && i == n_kept - 1;
+        load(zmm_kept(i), EVEX_compress_addr(reg_src, i * simd_w_ * typesize_),
+                is_tail ? &kBlk_tail : nullptr);
+        const Zmm zmm_abs = zmm_data(i % max_unroll_);
+        vandps(zmm_abs, zmm_kept(i), zmm_abs_mask);
+        vmaxps(zmm_max(i % max_unroll_), zmm_max(i % max_unroll_), zmm_abs);
+    }
+
+    auto update_max = [this](int i, dim_t offset, opmask_t *k_tail) {
+        load(zmm_data(i), EVEX_compress_addr(reg_aux_src, offset), k_tail);
+        vandps(zmm_data(i), zmm_data(i), zmm_abs_mask);
+        vmaxps(zmm_max(i), zmm_max(i), zmm_data(i));
+    };
+
+    // The rest of the row.
+    const dim_t K_kept = tail_kept ? conf_->K : n_kept * simd_w_;
+    const dim_t K = conf_->K - K_kept;
+    const dim_t unroll_step = max_unroll_ * simd_w_;
+    const dim_t num_unrolled_iters = K / unroll_step;
+    if (K > 0) lea(reg_aux_src, ptr[reg_src + K_kept * typesize_]);
+    if (num_unrolled_iters > 0) {
+        Label loop_K;
+        mov(reg_iters, num_unrolled_iters);
+        L(loop_K);
+        for (int i = 0; i < max_unroll_; i++)
+            update_max(i, i * simd_w_ * typesize_, nullptr);
+        add(reg_aux_src, unroll_step * typesize_);
+        dec(reg_iters);
+        jnz(loop_K, T_NEAR);
+    }
+    const int num_vecs = (K % unroll_step) / simd_w_;
+    for (int i = 0; i < num_vecs; i++)
+        update_max(i, i * simd_w_ * typesize_, nullptr);
+    if (K % simd_w_ > 0)
+        update_max(num_vecs % max_unroll_, num_vecs * simd_w_ * typesize_,
+                &kRow_tail);
+
+    for (int i = 1; i < max_unroll_; i++)
+        vmaxps(zmm_max(0), zmm_max(0), zmm_max(i));
+    const Ymm ymm_max = Ymm(zmm_max(0).getIdx());
+    const Ymm ymm_tmp = Ymm(zmm_data(0).getIdx());
+    vextractf64x4(ymm_tmp, zmm_max(0), 1);
+    vmaxps(ymm_max, ymm_max, ymm_tmp);
+    const Xmm xmm_max = Xmm(ymm_max.getIdx());
+    const Xmm xmm_tmp = Xmm(ymm_tmp.getIdx());
+    vextractf128(xmm_tmp, ymm_max, 1);
+    vmaxps(xmm_max, xmm_max, xmm_tmp);
+    vshufps(xmm_tmp, xmm_max, xmm_max, 0x4e);
+    vmaxps(xmm_max, xmm_max, xmm_tmp);
+    vshufps(xmm_tmp, xmm_max, xmm_max, 0xb1);
+    vmaxps(xmm_max, xmm_max, xmm_tmp);
+
+    // A row of zeros gets a zero scale and is quantized to zeros.
+    const Xmm xmm_max_s8 = Xmm(zmm_max_s8.getIdx());
+    const Xmm xmm_inv_scale = Xmm(zmm_inv_scale.getIdx());
+    vdivss(xmm_tmp, xmm_max, xmm_max_s8);
+    vmovss(ptr[reg_scales], xmm_tmp);
+    vdivss(xmm_inv_scale, xmm_max_s8, xmm_max);
+    vcmpneqss(xmm_tmp, xmm_max, Xmm(zmm_zero.getIdx()));
+    vandps(xmm_inv_scale, xmm_inv_scale, xmm_tmp);
+    vmovss(ptr[reg_scales + inv_scales_offset_], xmm_inv_scale);
+    vbroadcastss(zmm_inv_scale, xmm_inv_scale);
+}
+
+void jit_brgemm_matmul_quantize_a_impl_t::quantize_row(
+        int K_blk, int n_kept) {
+    const int num_vecs = K_blk / simd_w_;
+    const bool has_tail = K_blk % simd_w_ > 0;
+    // The elements past the block are stored as zeros: the brgemm kernel
+    // reads the K tail rounded up to the vnni granularity.
+    for (int i = 0; i < num_vecs + has_tail; i++) {
+        const bool is_kept = i < n_kept;
+        const Zmm zmm = is_kept ? zmm_kept(i) : zmm_data(i % max_unroll_);
+        const bool is_tail = i == num_vecs;
+        if (!is_kept)
+            load(zmm, EVEX_compress_addr(reg_src, i * simd_w_ * typesize_),
+                    is_tail ? &kBlk_tail : nullptr);
+        vmulps(zmm, zmm, zmm_inv_scale);
+        vcvtps2dq(zmm, zmm);
+        vpmovsdb(ptr[reg_tr_src + i * simd_w_], zmm);
+    }
+}
+
+void jit_brgemm_matmul_quantize_a_impl_t::copy_M_loop(
+        int K_blk, bool compute_scales) {
+    if (K_blk % simd_w_ > 0) set_tail_mask(kBlk_tail, K_blk % simd_w_);
+    if (compute_scales && conf_->K % simd_w_ > 0)
+        set_tail_mask(kRow_tail, conf_->K % simd_w_);
+
+    Label loop_M;
+    L(loop_M);
+
+    if (compute_scales)
+        compute_row_scale(K_blk);
+    else
+        vbroadcastss(zmm_inv_scale, ptr[reg_scales + inv_scales_offset_]);
+    quantize_row(K_blk, compute_scales ? num_kept_vecs(K_blk) : 0);
+
+    add(reg_src, src_stride_);
+    add(reg_tr_src, tr_src_stride_);
+    add(reg_scales, sizeof(float));
+
+    dec(reg_M_blk);
+    jnz(loop_M, T_NEAR);
+}
+
+void jit_brgemm_matmul_quantize_a_impl_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(src_scales_ptr)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+    mov(reg_K_start, ptr[param1 + GET_OFF(current_K_start)]);
+
+    mov(reg_tmp.cvt32(), 0x7fffffff);
+    vpbroadcastd(zmm_abs_mask, reg_tmp.cvt32());
+    mov(reg_tmp.cvt32(), float2int(static_cast<float>(INT8_MAX)));
+    vpbroadcastd(zmm_max_s8, reg_tmp.cvt32());
+    vpxord(zmm_zero, zmm_zero, zmm_zero);
+
+    const int K_blk = static_cast<int>(nstl::min(conf_->K, conf_->K_blk));
+    // might be different from conf_->K_tail
+    const int K_blk_tail = conf_->K_tail > 0 ? conf_->K % conf_->K_blk : 0;
+    auto copy_body = [&](bool compute_scales) {
+        Label copy_body_done;
+        if (K_blk_tail > 0) {
+            Label not_K_tail;
+            cmp(reg_K_blk, K_blk_tail);
+            jne(not_K_tail, T_NEAR);
+            copy_M_loop(K_blk_tail, compute_scales);
+            jmp(copy_body_done, T_NEAR);
+
+            L(not_K_tail);
+        }
+        copy_M_loop(K_blk, compute_scales);
+        L(copy_body_done);
+    };
+
+    Label not_first_K_blk, done;
+    cmp(reg_K_start, 0);
+    jne(not_first_K_blk, T_NEAR);
+    copy_body(true);
+    jmp(done, T_NEAR);
+
+    L(not_first_K_blk);
+    copy_body(false);
+    L(done);
+
+    postamble();
+}
+
 template <typename Vmm>
 struct jit_brgemm_matmul_copy_a_transposed_impl_t
     : public jit_brgemm_matmul_copy_a_t,
@@ -5230,7 +5502,11 @@ status_t create_brgemm_matmul_copy_b(
 status_t create_brgemm_matmul_copy_a(
         std::unique_ptr<jit_brgemm_matmul_copy_a_t> &copy_ker,
         const brgemm_matmul_conf_t *conf) {
-    if (conf->transposed_A) {
+    if (conf->with_src_dynamic_quant) {
+        assert(!conf->transposed_A && is_superset(conf->isa, avx512_core));
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_quantize_a_impl_t(conf)));
+    } else if (conf->transposed_A) {
         if (utils::one_of(conf->src_dt, data_type::s8, data_type::u8))
             CHECK(safe_ptr_assign(copy_ker,
                     new jit_brgemm_matmul_copy_a_transposed_int8_impl_t(conf)));
@@ -61,6 +61,9 @@ struct jit_brgemm_matmul_copy_a_t {
         const void *zp_a_compensation_result_ptr;
         const void *zp_b_neg_value_ptr;
         const void *zp_ab_comp_ptr;
+        // Scales of the rows followed by their inverted values, computed
+        // with dynamic quantization when `current_K_start` is 0.
+        const void *src_scales_ptr;
 
         dim_t current_K_start;
         dim_t current_K_blk;
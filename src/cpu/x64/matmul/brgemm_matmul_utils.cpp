@@ -413,9 +413,9 @@ bool is_gemv_applicable(const brgemm_matmul_conf_t &bgmmc,
         const brgemm_matmul_conf_utils_t &bm_conf_utils,
         const memory_desc_t &A_md, const memory_desc_t &B_md) {
 
-    // Only the N=1 case is supported currently.
-    // TODO: The existing GEMV code path could also support the M=1 case when
-    // B tensor has a transposed format. Enable this by swapping A and B.
+    // Only the N=1 case is supported currently. The M=1 case and non-f32
+    // data types, including decompressed integer weights, are handled by
+    // `jit_uni_gemv_matmul_t` which is dispatched before this implementation.
     if (bgmmc.N != 1) return false;
 
     // Reduction is not supported for GEMV code path.
@@ -1271,10 +1271,58 @@ status_t compute_blocking_heuristic(brgemm_matmul_conf_t &bgmmc,
     return status::success;
 }
 
+// Blocking alternatives explored by the runtime autotuning. A zero chunk size
+// keeps the value chosen by the heuristic.
+struct tuning_candidate_t {
+    dim_t M_chunk_size, N_chunk_size;
+    bool halve_M_blk;
+};
+
+const tuning_candidate_t tuning_candidates[] = {
+        {0, 0, false},
+        {1, 1, false},
+        {1, 2, false},
+        {1, 4, false},
+        {2, 1, false},
+        {2, 2, false},
+        {2, 4, false},
+        {4, 1, false},
+        {4, 2, false},
+        {4, 4, false},
+        {0, 0, true},
+};
+static_assert(sizeof(tuning_candidates) / sizeof(tuning_candidates[0])
+                == brgemm_matmul_n_tuning_candidates,
+        "unexpected number of tuning candidates");
+
+status_t apply_tuning_candidate(brgemm_matmul_conf_t &bgmmc, int candidate) {
+    if (candidate <= 0) return status::success;
+    // The candidate may come from a tuning database written by another build.
+    if (candidate >= brgemm_matmul_n_tuning_candidates)
+        return status::unimplemented;
+    if (bgmmc.is_runtime_M || bgmmc.is_runtime_N || bgmmc.is_gemv)
+        return status::unimplemented;
+
+    const auto &cand = tuning_candidates[candidate];
+    if (cand.halve_M_blk) {
+        // AMX kernels rely on the M block matching the tile rows.
+        if (bgmmc.is_amx || bgmmc.M_blk < 2) return status::unimplemented;
+        bgmmc.M_blk = div_up(bgmmc.M_blk, 2);
+    }
+    if (cand.M_chunk_size > 0)
+        bgmmc.M_chunk_size = nstl::min(
+                cand.M_chunk_size, div_up(bgmmc.M, bgmmc.M_blk));
+    if (cand.N_chunk_size > 0)
+        bgmmc.N_chunk_size = nstl::min(
+                cand.N_chunk_size, div_up(bgmmc.N, bgmmc.N_blk));
+    return status::success;
+}
+
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr) {
+        memory_desc_t &bias_md, primitive_attr_t &attr,
+        int tuning_candidate) {
     const memory_desc_wrapper src_d(&src_md);
     const memory_desc_wrapper weights_d(&weights_md);
     const memory_desc_wrapper dst_d(&dst_md);
@@ -1290,6 +1338,23 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.wei_dt = weights_d.data_type();
     bgmmc.orig_wei_dt = weights_d.data_type();
 
+    // Source dynamic quantization: the f32 or bf16 source is quantized to s8
+    // with a scale per row while it is copied to the A buffer, so the problem
+    // is computed as an int8 one. The scales are computed over the whole row
+    // when the first K block is copied.
+    bgmmc.with_src_dynamic_quant
+            = !attr.dynamic_quantization_.has_default_values(DNNL_ARG_SRC);
+    if (bgmmc.with_src_dynamic_quant) {
+        VCONDCHECK_BG(one_of(bgmmc.src_dt, f32, bf16) && bgmmc.wei_dt == s8
+                        && !attr.fpmath_.apply_to_int_,
+                VERBOSE_UNSUPPORTED_DQ_CFG);
+        // Per-row source scales are not supported by AMX brgemm kernels.
+        VCONDCHECK_BG(is_superset(isa, avx512_core_vnni)
+                        && !is_superset(isa, avx512_core_amx),
+                VERBOSE_UNSUPPORTED_ISA);
+        bgmmc.src_dt = s8;
+    }
+
     bgmmc.with_reduce = mmd.reduce_desc.format_kind != format_kind::undef;
     bgmmc.reduce_dt
             = bgmmc.with_reduce ? mmd.reduce_desc.data_type : data_type::undef;
@@ -1318,12 +1383,20 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    if (bgmmc.with_src_dynamic_quant)
+        bgmmc.a_dt_sz = types::data_type_size(bgmmc.orig_src_dt);
 
     bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
     if (bgmmc.packed_sparse_weights) {
         VCONDCHECK_BG(bgmmc.is_amx, VERBOSE_ISA_SPARSE_ENCODING_MISMATCH);
         VCONDCHECK_BG(bgmmc.wei_dt == s8, VERBOSE_UNSUPPORTED_DT);
     }
+    // The weights are replicated per NUMA node when they are dense and their
+    // size is known.
+    bgmmc.replicate_weights = attr.weights_replication_
+            && platform::get_num_numa_nodes() > 1
+            && !weights_d.is_sparse_desc()
+            && !weights_d.has_runtime_dims_or_strides();
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
     bgmmc.is_tf32 = bm_conf_utils.is_tf32();
     bgmmc.is_bf16_with_int_wei = bm_conf_utils.is_bf16_with_int_wei();
@@ -1375,7 +1448,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
-    bgmmc.with_src_scales = !src_scales.has_default_values();
+    bgmmc.with_src_scales = !src_scales.has_default_values()
+            || bgmmc.with_src_dynamic_quant;
     bgmmc.with_wei_scales = !wei_scales.has_default_values();
     if (bgmmc.with_wei_scales) {
         const auto wei_qmask_N = 1 << (bgmmc.ndims - 1);
@@ -1420,6 +1494,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                     everyone_is(brgemm_broadcast_t::none, bgmmc.src_zp_type,
                             bgmmc.wei_zp_type, bgmmc.dst_zp_type)),
             VERBOSE_UNSUPPORTED_ZP_CFG);
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dynamic_quant,
+                          everyone_is(brgemm_broadcast_t::none,
+                                  bgmmc.src_zp_type, bgmmc.wei_zp_type)),
+            VERBOSE_UNSUPPORTED_DQ_CFG);
 
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
@@ -1621,9 +1699,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                             && isa == avx512_core_fp16)
                     || (bgmmc.wei_zp_type != brgemm_broadcast_t::none
                             && !bm_conf_utils.with_weights_decompression())
-                    || bgmmc.transposed_A);
+                    || bgmmc.transposed_A
+                    || bgmmc.with_src_dynamic_quant);
 
     bgmmc.use_buffer_a = is_copy_a_required;
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dynamic_quant,
+                          !bgmmc.is_gemv && !bgmmc.transposed_A),
+            VERBOSE_UNSUPPORTED_DQ_CFG);
 
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
@@ -1676,6 +1758,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     // - nthr_K
     VCHECK_BG(compute_blocking_heuristic(bgmmc, bm_conf_utils),
             VERBOSE_BLOCKING_FAIL, "");
+    CHECK(apply_tuning_candidate(bgmmc, tuning_candidate));
+    // Per-row scales must be known before any K block is computed.
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_src_dynamic_quant,
+                          bgmmc.nthr_k == 1 && !bgmmc.use_buffer_a_tail_only),
+            VERBOSE_UNSUPPORTED_DQ_CFG);
 
     if (bgmmc.wei_n_blk > bgmmc.N_blk && bgmmc.N != bgmmc.N_blk) {
         assert(!bgmmc.is_runtime_N
@@ -2128,6 +2215,11 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.zp_b_comp_elems_per_thr = bgmmc.M_chunk_size
             * (bgmmc.zp_b_comp_result_shift_m + bgmmc.zp_b_comp_buffer_shift_m);
 
+    // Scales and inverted scales of every row of an M chunk.
+    bgmmc.src_dq_scales_elems_per_thr = bgmmc.with_src_dynamic_quant
+            ? 2 * bgmmc.M_chunk_size * bgmmc.M_blk
+            : 0;
+
     bgmmc.brgemm_batch_element_per_thr_sz = 16 * bgmmc.brgemm_batch_size;
 }
 
@@ -2177,6 +2269,11 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 bgmmc.nthr * bgmmc.zp_b_comp_elems_per_thr,
                 types::data_type_size(s32));
 
+    if (bgmmc.with_src_dynamic_quant)
+        scratchpad.book(key_brgemm_primitive_src_dq_scales,
+                bgmmc.nthr * bgmmc.src_dq_scales_elems_per_thr,
+                sizeof(float));
+
     if (is_superset(bgmmc.isa, avx512_core_amx))
         scratchpad.book(key_conv_amx_tile_buffer,
                 static_cast<size_t>(bgmmc.nthr) * bgmmc.wsp_tile_per_thr_bytes,
@@ -109,10 +109,14 @@ struct brgemm_matmul_conf_t {
     bool with_eltwise;
     bool with_binary;
     bool with_src_scales;
+    // The source is quantized to int8 per row while copied to the A buffer.
+    bool with_src_dynamic_quant;
     bool with_wei_scales;
     bool with_dst_scales;
     bool s8s8_compensation_required;
     bool packed_sparse_weights;
+    // Each thread reads the weights from the copy of its NUMA node.
+    bool replicate_weights;
     bool with_wei_decompression;
     int postops_inst_count;
     brgemm_broadcast_t src_zp_type;
@@ -208,6 +212,7 @@ struct brgemm_matmul_conf_t {
     dim_t zp_b_comp_buffer_start;
     dim_t zp_b_comp_buffer_shift_m;
     dim_t zp_b_comp_elems_per_thr;
+    dim_t src_dq_scales_elems_per_thr;
 
     int wsp_tile_per_thr_bytes;
     int brgemm_batch_element_per_thr_sz;
@@ -436,10 +441,18 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
         const memory_desc_wrapper &src_d, const memory_desc_wrapper &wei_d,
         const memory_desc_wrapper &dst_d);
 
+// Number of blocking candidates explored by the runtime autotuning. Candidate
+// 0 is the blocking chosen by the heuristic.
+constexpr int brgemm_matmul_n_tuning_candidates = 11;
+
+// A non-negative `tuning_candidate` overrides the heuristic blocking, see
+// `cpu/cpu_tuning.hpp`. Fails with `unimplemented` if the candidate doesn't
+// apply to the problem.
 status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
         const matmul_desc_t &mmd, memory_desc_t &src_md,
         memory_desc_t &weights_md, memory_desc_t &dst_md,
-        memory_desc_t &bias_md, primitive_attr_t &attr);
+        memory_desc_t &bias_md, primitive_attr_t &attr,
+        int tuning_candidate = -1);
 
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc);
@@ -0,0 +1,413 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+#include "cpu/x64/matmul/jit_avx512_core_sparse_wei_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace Xbyak;
+
+namespace {
+// Masks of the first `i` lanes of a 16-lane vector.
+const uint16_t tail_masks[17] = {0x0000, 0x0001, 0x0003, 0x0007, 0x000f,
+        0x001f, 0x003f, 0x007f, 0x00ff, 0x01ff, 0x03ff, 0x07ff, 0x0fff, 0x1fff,
+        0x3fff, 0x7fff, 0xffff};
+} // namespace
+
+struct sparse_wei_matmul_kernel_t : public jit_generator_t {
+    struct call_params_t {
+        // Row `m` of the source and of the accumulator.
+        const void *src;
+        float *acc;
+        // CSR buffers of the whole weights.
+        const void *wei_values;
+        const int32_t *wei_indices;
+        const int32_t *wei_pointers;
+        // Rows of the weights to process.
+        size_t k_start, k_end;
+    };
+
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(sparse_wei_matmul_kernel_t)
+
+    sparse_wei_matmul_kernel_t(
+            const jit_avx512_core_sparse_wei_matmul_conf_t &conf, int rows)
+        : jit_generator_t(jit_name())
+        , conf_(conf)
+        , rows_(rows)
+        , src_sz_(types::data_type_size(conf.src_dt))
+        , wei_sz_(types::data_type_size(conf.wei_dt)) {
+        assert(rows_ > 0 && rows_ <= max_rows);
+    }
+
+    void operator()(const call_params_t *p) const {
+        return jit_generator_t::operator()(p);
+    }
+
+    static constexpr int max_rows = 4;
+
+private:
+    const jit_avx512_core_sparse_wei_matmul_conf_t conf_;
+    const int rows_;
+    const size_t src_sz_;
+    const size_t wei_sz_;
+
+    // The parameters pointer is replaced by the table of masks once the
+    // parameters are loaded.
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_masks = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_values = r9;
+    const Reg64 reg_indices = r10;
+    const Reg64 reg_pointers = r11;
+    const Reg64 reg_k = r12;
+    const Reg64 reg_k_end = r13;
+    const Reg64 reg_nz = r14;
+    const Reg64 reg_nz_end = r15;
+    const Reg64 reg_tmp = rbp;
+    Reg64 reg_acc(int r) const {
+        const Reg64 regs[max_rows] = {rax, rbx, rdx, rsi};
+        return regs[r];
+    }
+
+    const Opmask k_load = k1;
+    // Gathers and scatters clear their masks, each row has its own copy.
+    Opmask k_row(int r) const { return Opmask(2 + r); }
+
+    const Zmm zmm_idx = Zmm(0);
+    const Zmm zmm_val = Zmm(1);
+    Zmm zmm_src(int r) const { return Zmm(2 + r); }
+    Zmm zmm_acc(int r) const { return Zmm(2 + max_rows + r); }
+
+    void load_src(int r) {
+        const size_t row_offt = r * conf_.K * src_sz_;
+        const auto addr = ptr[reg_src + reg_k * src_sz_ + row_offt];
+        if (conf_.src_dt == bf16) {
+            vpbroadcastw(zmm_src(r), addr);
+            vpslld(zmm_src(r), zmm_src(r), 16);
+        } else {
+            vbroadcastss(zmm_src(r), addr);
+        }
+    }
+
+    void load_values() {
+        const auto addr = ptr[reg_values + reg_nz * wei_sz_];
+        if (conf_.wei_dt == bf16) {
+            vpmovzxwd(zmm_val | k_load | T_z, addr);
+            vpslld(zmm_val, zmm_val, 16);
+        } else {
+            vmovups(zmm_val | k_load | T_z, addr);
+        }
+    }
+
+    void generate() override {
+#define GET_OFF(field) offsetof(call_params_t, field)
+        preamble();
+
+        mov(reg_src, ptr[reg_param + GET_OFF(src)]);
+        mov(reg_acc(0), ptr[reg_param + GET_OFF(acc)]);
+        mov(reg_values, ptr[reg_param + GET_OFF(wei_values)]);
+        mov(reg_indices, ptr[reg_param + GET_OFF(wei_indices)]);
+        mov(reg_pointers, ptr[reg_param + GET_OFF(wei_pointers)]);
+        mov(reg_k, ptr[reg_param + GET_OFF(k_start)]);
+        mov(reg_k_end, ptr[reg_param + GET_OFF(k_end)]);
+#undef GET_OFF
+        mov(reg_masks, reinterpret_cast<size_t>(tail_masks));
+        mov(reg_tmp, conf_.N * sizeof(float));
+        for (int r = 1; r < rows_; r++)
+            lea(reg_acc(r), ptr[reg_acc(r - 1) + reg_tmp]);
+
+        Label k_loop, k_loop_end, nz_loop, next_k, full_mask;
+        L(k_loop);
+        {
+            cmp(reg_k, reg_k_end);
+            jge(k_loop_end, T_NEAR);
+
+            movsxd(reg_nz, dword[reg_pointers + reg_k * sizeof(int32_t)]);
+            movsxd(reg_nz_end,
+                    dword[reg_pointers + reg_k * sizeof(int32_t)
+                            + sizeof(int32_t)]);
+            cmp(reg_nz, reg_nz_end);
+            jge(next_k, T_NEAR);
+
+            for (int r = 0; r < rows_; r++)
+                load_src(r);
+
+            L(nz_loop);
+            {
+                mov(reg_tmp, reg_nz_end);
+                sub(reg_tmp, reg_nz);
+                cmp(reg_tmp, conf_.simd_w);
+                jle(full_mask, T_NEAR);
+                mov(reg_tmp, conf_.simd_w);
+                L(full_mask);
+                kmovw(k_load, word[reg_masks + reg_tmp * sizeof(uint16_t)]);
+
+                vmovdqu32(zmm_idx | k_load | T_z,
+                        ptr[reg_indices + reg_nz * sizeof(int32_t)]);
+                load_values();
+
+                // The indices of a row are unique, so the lanes of a scatter
+                // never collide.
+                for (int r = 0; r < rows_; r++) {
+                    kmovw(k_row(r), k_load);
+                    vgatherdps(zmm_acc(r) | k_row(r),
+                            ptr[reg_acc(r) + zmm_idx * sizeof(float)]);
+                }
+                for (int r = 0; r < rows_; r++)
+                    vfmadd231ps(zmm_acc(r), zmm_val, zmm_src(r));
+                for (int r = 0; r < rows_; r++) {
+                    kmovw(k_row(r), k_load);
+                    vscatterdps(ptr[reg_acc(r) + zmm_idx * sizeof(float)]
+                                    | k_row(r),
+                            zmm_acc(r));
+                }
+
+                add(reg_nz, conf_.simd_w);
+                cmp(reg_nz, reg_nz_end);
+                jl(nz_loop, T_NEAR);
+            }
+
+            L(next_k);
+            inc(reg_k);
+            jmp(k_loop, T_NEAR);
+        }
+        L(k_loop_end);
+
+        postamble();
+    }
+};
+
+status_t jit_avx512_core_sparse_wei_matmul_t::pd_t::init(engine_t *engine) {
+    auto &c = conf_;
+
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper wei_d(weights_md());
+
+    VDISPATCH_MATMUL(mayiuse(avx512_core), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc() && !src_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::csr,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::everyone_is(s32, wei_d.metadata_type(0),
+                             wei_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(utils::everyone_is(f32, src_dt, wei_dt, dst_dt)
+                    || (utils::everyone_is(bf16, src_dt, wei_dt)
+                            && utils::one_of(dst_dt, f32, bf16)),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(src_d.matches_one_of_tag(format_tag::ab)
+                    && memory_desc_wrapper(dst_md()).matches_one_of_tag(
+                            format_tag::ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    c.src_dt = src_dt;
+    c.wei_dt = wei_dt;
+    c.dst_dt = dst_dt;
+    c.M = M();
+    c.N = N();
+    c.K = K();
+    c.simd_w = cpu_isa_traits_t<avx512_core>::vlen / sizeof(float);
+    c.m_blk = (int)nstl::min<dim_t>(sparse_wei_matmul_kernel_t::max_rows, c.M);
+
+    // The source rows of a block are addressed with a displacement.
+    VDISPATCH_MATMUL(
+            c.m_blk * c.K * types::data_type_size(src_dt) <= INT_MAX,
+            VERBOSE_LARGE_SHAPES);
+
+    init_threading();
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_avx512_core_sparse_wei_matmul_t::pd_t::init_threading() {
+    auto &c = conf_;
+    const int nthr = dnnl_get_max_threads();
+    const dim_t n_m_blks = utils::div_up(c.M, c.m_blk);
+
+    // Split the weights rows only when the source rows can't occupy all the
+    // threads, keeping enough non-zeros per thread to amortize the
+    // reduction of the partial results.
+    c.nthr_m = (int)nstl::min<dim_t>(nthr, n_m_blks);
+    c.nthr_k = 1;
+    if (n_m_blks < nthr) {
+        const dim_t min_nnz_per_thr = 4096;
+        const dim_t nnz = memory_desc_wrapper(weights_md()).nnz();
+        c.nthr_k = (int)nstl::max<dim_t>(1,
+                nstl::min<dim_t>(
+                        nthr / c.nthr_m, nnz * c.m_blk / min_nnz_per_thr));
+    }
+    c.nthr = c.nthr_m * c.nthr_k;
+    c.dst_is_acc = c.dst_dt == f32 && c.nthr_k == 1;
+}
+
+void jit_avx512_core_sparse_wei_matmul_t::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    if (c.dst_is_acc) return;
+
+    const dim_t acc_size = c.nthr_k == 1 ? c.nthr * c.m_blk * c.N
+                                         : c.nthr_k * c.M * c.N;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_matmul_dst_in_acc_dt, acc_size);
+}
+
+jit_avx512_core_sparse_wei_matmul_t::jit_avx512_core_sparse_wei_matmul_t(
+        const pd_t *apd)
+    : primitive_t(apd) {}
+
+jit_avx512_core_sparse_wei_matmul_t::~jit_avx512_core_sparse_wei_matmul_t()
+        = default;
+
+status_t jit_avx512_core_sparse_wei_matmul_t::init(engine_t *engine) {
+    const auto &c = pd()->conf();
+    kernels_.resize(c.m_blk);
+    for (int rows = 1; rows <= c.m_blk; rows++) {
+        auto &kernel = kernels_[rows - 1];
+        CHECK(safe_ptr_assign(kernel, new sparse_wei_matmul_kernel_t(c, rows)));
+        CHECK(kernel->create_kernel());
+    }
+    return status::success;
+}
+
+status_t jit_avx512_core_sparse_wei_matmul_t::execute(
+        const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf();
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei_values = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+    const auto wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *acc_buf = c.dst_is_acc
+            ? reinterpret_cast<float *>(dst)
+            : scratchpad.template get<float>(key_matmul_dst_in_acc_dt);
+
+    const size_t src_sz = types::data_type_size(c.src_dt);
+    const dim_t n_m_blks = utils::div_up(c.M, c.m_blk);
+
+    // Stores `rows` rows of f32 results starting from row `m`.
+    auto store_rows = [&](const float *acc, dim_t m, dim_t rows) {
+        const dim_t off = m * c.N;
+        if (c.dst_dt == bf16)
+            cvt_float_to_bfloat16(reinterpret_cast<bfloat16_t *>(dst) + off,
+                    acc, rows * c.N);
+        else
+            utils::array_copy(
+                    reinterpret_cast<float *>(dst) + off, acc, rows * c.N);
+    };
+
+    auto compute = [&](int ithr, int ithr_m, int ithr_k) {
+        dim_t mb_start {0}, mb_end {0}, k_start {0}, k_end {0};
+        balance211(n_m_blks, c.nthr_m, ithr_m, mb_start, mb_end);
+        if (mb_start >= mb_end) return;
+        cpu::matmul::balance_csr_rows(
+                wei_pointers, c.K, c.nthr_k, ithr_k, k_start, k_end);
+
+        for (dim_t mb = mb_start; mb < mb_end; mb++) {
+            const dim_t m = mb * c.m_blk;
+            const dim_t rows = nstl::min<dim_t>(c.m_blk, c.M - m);
+
+            float *acc = nullptr;
+            if (c.dst_is_acc)
+                acc = acc_buf + m * c.N;
+            else if (c.nthr_k == 1)
+                acc = acc_buf + ithr * c.m_blk * c.N;
+            else
+                acc = acc_buf + (ithr_k * c.M + m) * c.N;
+            utils::array_set(acc, 0.f, rows * c.N);
+
+            if (k_start < k_end) {
+                sparse_wei_matmul_kernel_t::call_params_t p;
+                p.src = src + m * c.K * src_sz;
+                p.acc = acc;
+                p.wei_values = wei_values;
+                p.wei_indices = wei_indices;
+                p.wei_pointers = wei_pointers;
+                p.k_start = k_start;
+                p.k_end = k_end;
+                (*kernels_[rows - 1])(&p);
+            }
+
+            if (!c.dst_is_acc && c.nthr_k == 1) store_rows(acc, m, rows);
+        }
+    };
+
+    parallel(c.nthr, [&](int ithr, int nthr) {
+        // Work is split for `c.nthr` threads, fewer threads process several
+        // of the work items each.
+        for (int t = ithr; t < c.nthr; t += nthr)
+            compute(t, t / c.nthr_k, t % c.nthr_k);
+    });
+
+    if (c.nthr_k == 1) return status::success;
+
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(c.M, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        float *acc = acc_buf + start * c.N;
+        const dim_t len = (end - start) * c.N;
+        for (int ik = 1; ik < c.nthr_k; ik++) {
+            const float *part = acc + ik * c.M * c.N;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; i++)
+                acc[i] += part[i];
+        }
+        store_rows(acc, start, end - start);
+    });
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
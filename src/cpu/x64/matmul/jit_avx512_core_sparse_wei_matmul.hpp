@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_AVX512_CORE_SPARSE_WEI_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_AVX512_CORE_SPARSE_WEI_MATMUL_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Dense source times CSR-encoded weights. Each non-zero row `k` of the
+// weights scatters `src[m][k] * values` into the columns `indices` of the
+// destination row `m`. The kernel processes the non-zeros of a weights row
+// 16 at a time with gathers and scatters of the f32 accumulator, for `m_blk`
+// rows of the source sharing the loads of the values and indices.
+//
+// Rows of the source are split between threads. When there are too few of
+// them, the rows of the weights are split as well, with the same number of
+// non-zeros per thread, and the partial results are reduced at the end.
+struct jit_avx512_core_sparse_wei_matmul_conf_t {
+    data_type_t src_dt, wei_dt, dst_dt;
+    dim_t M, N, K;
+    int simd_w, m_blk;
+    int nthr, nthr_m, nthr_k;
+    // The kernel accumulates into the destination directly. Otherwise, each
+    // thread accumulates into its own buffer of `m_blk` rows, or, when the
+    // weights rows are split, into `nthr_k` buffers of the whole destination.
+    bool dst_is_acc;
+};
+
+struct sparse_wei_matmul_kernel_t;
+
+struct jit_avx512_core_sparse_wei_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", avx512_core, ""),
+                jit_avx512_core_sparse_wei_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_avx512_core_sparse_wei_matmul_conf_t &conf() const {
+            return conf_;
+        }
+
+    private:
+        void init_threading();
+        void init_scratchpad();
+
+        jit_avx512_core_sparse_wei_matmul_conf_t conf_
+                = utils::zero<decltype(conf_)>();
+    };
+
+    jit_avx512_core_sparse_wei_matmul_t(const pd_t *apd);
+    ~jit_avx512_core_sparse_wei_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Kernels for 1 to `m_blk` rows of the source.
+    std::vector<std::unique_ptr<sparse_wei_matmul_kernel_t>> kernels_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,787 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cassert>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/binary_injector_utils.hpp"
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_regops.hpp"
+
+#include "cpu/x64/matmul/jit_uni_gemv_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace Xbyak;
+
+struct gemv_matmul_kernel_t : public jit_generator_t {
+    struct call_params_t {
+        const void *mat;
+        const float *vec;
+        const void *scales;
+        const void *zps;
+        float *dst;
+        size_t rows;
+        // K of the call is `ngroups` groups of `nchunks` blocks of `k_blk`.
+        size_t ngroups;
+        size_t nchunks;
+    };
+
+    gemv_matmul_kernel_t(
+            const char *name, const jit_uni_gemv_matmul_conf_t &conf)
+        : jit_generator_t(name), conf_(conf) {}
+
+    ~gemv_matmul_kernel_t() override = default;
+
+    void operator()(const call_params_t *p) const {
+        return jit_generator_t::operator()(p);
+    }
+
+protected:
+    const jit_uni_gemv_matmul_conf_t conf_;
+};
+
+#define GET_OFF(field) offsetof(gemv_matmul_kernel_t::call_params_t, field)
+
+template <cpu_isa_t isa>
+struct jit_uni_gemv_matmul_kernel_t : public gemv_matmul_kernel_t {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gemv_matmul_kernel_t)
+
+    using Vmm = typename cpu_isa_traits_t<isa>::Vmm;
+
+    jit_uni_gemv_matmul_kernel_t(const jit_uni_gemv_matmul_conf_t &conf)
+        : gemv_matmul_kernel_t(jit_name(), conf)
+        , is_int4_(utils::one_of(conf.mat_dt, s4, u4))
+        , with_scales_(conf.is_m1 && conf.with_scales)
+        , with_zp_(conf.is_m1 && conf.with_zp)
+        , row_bytes_(conf.mat_ld * types::data_type_bits(conf.mat_dt) / 8)
+        , chunk_bytes_(conf.k_blk * types::data_type_bits(conf.mat_dt) / 8)
+        , sc_sz_(with_scales_ ? types::data_type_size(conf.scales_dt) : 0)
+        , zp_sz_(with_zp_ ? types::data_type_size(conf.zp_dt) : 0) {}
+
+private:
+    const bool is_int4_;
+    const bool with_scales_;
+    const bool with_zp_;
+    const size_t row_bytes_;
+    const size_t chunk_bytes_;
+    const size_t sc_sz_;
+    const size_t zp_sz_;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_mat = r8;
+    const Reg64 reg_vec = r9;
+    const Reg64 reg_scales = r10;
+    const Reg64 reg_zps = r11;
+    const Reg64 reg_dst = r12;
+    const Reg64 reg_rows = r13;
+    const Reg64 reg_aux_mat = r14;
+    const Reg64 reg_aux_vec = r15;
+    const Reg64 reg_aux_sc = rax;
+    const Reg64 reg_aux_zp = rbx;
+    const Reg64 reg_grp = rdx;
+    const Reg64 reg_chunk = rsi;
+    const Reg64 reg_tmp = rbp;
+
+    // Accumulators come first and the temporary right after them, so that
+    // both stay encodable by the VEX-only instructions of the horizontal
+    // reduction.
+    Vmm vmm_acc(int r) const { return Vmm(r); }
+    Vmm vmm_tmp() const { return Vmm(conf_.ur); }
+    Vmm vmm_vec(int i) const { return Vmm(conf_.ur + 1 + i); }
+    Vmm vmm_wei(int i) const { return Vmm(conf_.ur + 3 + i); }
+    Vmm vmm_grp(int r) const { return Vmm(conf_.ur + 5 + r); }
+    Vmm vmm_zp(int r) const {
+        return Vmm(conf_.ur * (1 + conf_.with_grp_scales) + 5 + r);
+    }
+
+    // Broadcasts a scalar of type `dt` converted to f32.
+    void load_bcast(const Vmm &v, const Reg64 &base, size_t offt,
+            data_type_t dt) {
+        const Xmm xmm_tmp = Xmm(vmm_tmp().getIdx());
+        const Reg32 reg_tmp32 = reg_tmp.cvt32();
+        switch (dt) {
+            case f32: uni_vbroadcastss(v, dword[base + offt]); break;
+            case s32:
+                vpbroadcastd(v, dword[base + offt]);
+                uni_vcvtdq2ps(v, v);
+                break;
+            case bf16:
+                movzx(reg_tmp32, word[base + offt]);
+                shl(reg_tmp32, 16);
+                vmovd(xmm_tmp, reg_tmp32);
+                vbroadcastss(v, xmm_tmp);
+                break;
+            case f16:
+                movzx(reg_tmp32, word[base + offt]);
+                vmovd(xmm_tmp, reg_tmp32);
+                vcvtph2ps(xmm_tmp, xmm_tmp);
+                vbroadcastss(v, xmm_tmp);
+                break;
+            case s8:
+            case u8:
+                if (dt == s8)
+                    movsx(reg_tmp32, byte[base + offt]);
+                else
+                    movzx(reg_tmp32, byte[base + offt]);
+                vmovd(xmm_tmp, reg_tmp32);
+                vpbroadcastd(v, xmm_tmp);
+                uni_vcvtdq2ps(v, v);
+                break;
+            default: assert(!"unsupported data type");
+        }
+    }
+
+    void fma_row(int r) {
+        const Vmm acc = conf_.with_grp_scales ? vmm_grp(r) : vmm_acc(r);
+        const Vmm w0 = vmm_wei(0), w1 = vmm_wei(1);
+        const auto addr = ptr[reg_aux_mat + r * row_bytes_];
+        switch (conf_.mat_dt) {
+            case f32: uni_vfmadd231ps(acc, vmm_vec(0), addr); return;
+            case bf16:
+                vpmovzxwd(w0, addr);
+                vpslld(w0, w0, 16);
+                break;
+            case f16: vcvtph2ps(w0, addr); break;
+            case s8:
+                vpmovsxbd(w0, addr);
+                uni_vcvtdq2ps(w0, w0);
+                break;
+            case u8:
+                vpmovzxbd(w0, addr);
+                uni_vcvtdq2ps(w0, w0);
+                break;
+            case s4:
+            case u4:
+                // Even elements of K are in the low nibbles and odd ones in
+                // the high nibbles, `vec` is permuted accordingly.
+                vpmovzxbd(w0, addr);
+                if (conf_.mat_dt == s4) {
+                    vpslld(w1, w0, 24);
+                    vpsrad(w1, w1, 28);
+                    vpslld(w0, w0, 28);
+                    vpsrad(w0, w0, 28);
+                } else {
+                    vpsrld(w1, w0, 4);
+                    vpslld(w0, w0, 28);
+                    vpsrld(w0, w0, 28);
+                }
+                uni_vcvtdq2ps(w0, w0);
+                uni_vcvtdq2ps(w1, w1);
+                break;
+            default: assert(!"unsupported data type");
+        }
+        if (with_zp_) {
+            vsubps(w0, w0, vmm_zp(r));
+            if (is_int4_) vsubps(w1, w1, vmm_zp(r));
+        }
+        uni_vfmadd231ps(acc, w0, vmm_vec(0));
+        if (is_int4_) uni_vfmadd231ps(acc, w1, vmm_vec(1));
+    }
+
+    void compute_rows(int nrows) {
+        for (int r = 0; r < nrows; r++)
+            uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+
+        mov(reg_aux_mat, reg_mat);
+        mov(reg_aux_vec, reg_vec);
+        if (with_scales_) mov(reg_aux_sc, reg_scales);
+        if (with_zp_) mov(reg_aux_zp, reg_zps);
+
+        Label grp_loop, chunk_loop;
+        mov(reg_grp, ptr[reg_param + GET_OFF(ngroups)]);
+        L(grp_loop);
+        {
+            for (int r = 0; r < nrows; r++) {
+                if (with_zp_)
+                    load_bcast(vmm_zp(r), reg_aux_zp,
+                            r * conf_.zp_row_stride * zp_sz_, conf_.zp_dt);
+                if (conf_.with_grp_scales)
+                    uni_vpxor(vmm_grp(r), vmm_grp(r), vmm_grp(r));
+            }
+
+            mov(reg_chunk, ptr[reg_param + GET_OFF(nchunks)]);
+            L(chunk_loop);
+            {
+                uni_vmovups(vmm_vec(0), ptr[reg_aux_vec]);
+                if (is_int4_)
+                    uni_vmovups(vmm_vec(1),
+                            ptr[reg_aux_vec + conf_.simd_w * sizeof(float)]);
+                for (int r = 0; r < nrows; r++)
+                    fma_row(r);
+                add(reg_aux_mat, chunk_bytes_);
+                add(reg_aux_vec, conf_.k_blk * sizeof(float));
+                dec(reg_chunk);
+                jnz(chunk_loop, T_NEAR);
+            }
+
+            if (conf_.with_grp_scales) {
+                for (int r = 0; r < nrows; r++) {
+                    load_bcast(vmm_tmp(), reg_aux_sc,
+                            r * conf_.sc_row_stride * sc_sz_, conf_.scales_dt);
+                    uni_vfmadd231ps(vmm_acc(r), vmm_grp(r), vmm_tmp());
+                }
+            }
+            if (with_scales_ && conf_.sc_grp_stride != 0)
+                add(reg_aux_sc, conf_.sc_grp_stride * sc_sz_);
+            if (with_zp_ && conf_.zp_grp_stride != 0)
+                add(reg_aux_zp, conf_.zp_grp_stride * zp_sz_);
+            dec(reg_grp);
+            jnz(grp_loop, T_NEAR);
+        }
+
+        for (int r = 0; r < nrows; r++) {
+            const Xmm xmm_acc = Xmm(vmm_acc(r).getIdx());
+            regops::horizontal_add_ps(this, vmm_acc(r), vmm_tmp());
+            if (with_scales_ && !conf_.with_grp_scales) {
+                load_bcast(vmm_tmp(), reg_scales,
+                        r * conf_.sc_row_stride * sc_sz_, conf_.scales_dt);
+                vmulss(xmm_acc, xmm_acc, Xmm(vmm_tmp().getIdx()));
+            }
+            uni_vmovss(ptr[reg_dst + r * sizeof(float)], xmm_acc);
+        }
+    }
+
+    void advance_rows(int nrows) {
+        safe_add(reg_mat, nrows * row_bytes_, reg_tmp);
+        add(reg_dst, nrows * sizeof(float));
+        if (with_scales_ && conf_.sc_row_stride != 0)
+            add(reg_scales, nrows * conf_.sc_row_stride * sc_sz_);
+        if (with_zp_ && conf_.zp_row_stride != 0)
+            add(reg_zps, nrows * conf_.zp_row_stride * zp_sz_);
+    }
+
+    void generate() override {
+        preamble();
+
+        mov(reg_mat, ptr[reg_param + GET_OFF(mat)]);
+        mov(reg_vec, ptr[reg_param + GET_OFF(vec)]);
+        if (with_scales_) mov(reg_scales, ptr[reg_param + GET_OFF(scales)]);
+        if (with_zp_) mov(reg_zps, ptr[reg_param + GET_OFF(zps)]);
+        mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+        mov(reg_rows, ptr[reg_param + GET_OFF(rows)]);
+
+        Label blk_loop, tail_loop, done;
+        if (conf_.ur > 1) {
+            L(blk_loop);
+            cmp(reg_rows, conf_.ur);
+            jl(tail_loop, T_NEAR);
+            compute_rows(conf_.ur);
+            advance_rows(conf_.ur);
+            sub(reg_rows, conf_.ur);
+            jmp(blk_loop, T_NEAR);
+        }
+        L(tail_loop);
+        cmp(reg_rows, 0);
+        jle(done, T_NEAR);
+        compute_rows(1);
+        advance_rows(1);
+        dec(reg_rows);
+        jmp(tail_loop, T_NEAR);
+        L(done);
+
+        postamble();
+    }
+};
+
+#undef GET_OFF
+
+template <cpu_isa_t isa>
+status_t jit_uni_gemv_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+    auto &c = conf_;
+
+    const auto src_dt = src_md()->data_type;
+    const auto wei_dt = weights_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+
+    VDISPATCH_MATMUL(is_dense_format_kind(), VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!with_reduce(), VERBOSE_UNSUPPORTED_FEATURE, "reduce");
+    VDISPATCH_MATMUL(ndims() <= 3 && batch() == 1, VERBOSE_UNSUPPORTED_FEATURE,
+            "batched matmul");
+    VDISPATCH_MATMUL(utils::one_of(1, M(), N()), VERBOSE_UNSUPPORTED_FEATURE,
+            "matrix-matrix product");
+
+    const bool is_int_wei = utils::one_of(wei_dt, s8, u8, s4, u4);
+    VDISPATCH_MATMUL(utils::one_of(src_dt, f32, bf16, f16)
+                    && (wei_dt == src_dt
+                            || (is_int_wei && attr()->fpmath_.apply_to_int_))
+                    && utils::one_of(dst_dt, f32, bf16, f16),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_MATMUL(!with_bias()
+                    || (utils::one_of(weights_md(1)->data_type, f32, bf16)
+                            && is_bias_1xN()),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    const auto skip_mask = smask_t::scales_groups | smask_t::scales_data_type
+            | smask_t::zero_points_groups | smask_t::zero_points_data_type
+            | smask_t::post_ops | smask_t::sum_dt | smask_t::fpmath_mode;
+    VDISPATCH_MATMUL(attr()->has_default_values(skip_mask, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(attr_scales_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt,
+                             /* is_int8 */ false),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    c.is_m1 = M() == 1;
+    c.mat_dt = c.is_m1 ? wei_dt : src_dt;
+    c.vec_dt = c.is_m1 ? src_dt : wei_dt;
+    c.dst_dt = dst_dt;
+    c.R = c.is_m1 ? N() : M();
+    c.K = K();
+
+    CHECK(set_formats(engine));
+    VDISPATCH_MATMUL(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+    VDISPATCH_MATMUL(
+            inner_product_utils::post_ops_ok(attr()->post_ops_, dst_md()),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    c.with_pp = with_bias() || !attr()->post_ops_.has_default_values()
+            || !attr()->scales_.has_default_values(DNNL_ARG_SRC)
+            || !attr()->scales_.has_default_values(DNNL_ARG_DST);
+    // The post-processing kernel has no f16 destination support and relies
+    // on avx512_core for bf16 conversions.
+    VDISPATCH_MATMUL(IMPLICATION(c.with_pp,
+                             dst_dt == f32
+                                     || (dst_dt == bf16
+                                             && mayiuse(avx512_core))),
+            VERBOSE_UNSUPPORTED_DT_CFG);
+
+    const bool is_int4_mat = utils::one_of(c.mat_dt, s4, u4);
+    c.simd_w = cpu_isa_traits_t<isa>::vlen / sizeof(float);
+    c.k_blk = is_int4_mat ? 2 * c.simd_w : c.simd_w;
+
+    CHECK(init_quantization(engine));
+
+    const int n_grp_vregs = c.with_grp_scales + (c.is_m1 && c.with_zp);
+    c.ur = (int)nstl::min<dim_t>(
+            nstl::min(8, (isa_num_vregs(isa) - 5) / (1 + n_grp_vregs)), c.R);
+
+    const dim_t row_bytes = c.mat_ld * types::data_type_bits(c.mat_dt) / 8;
+    VDISPATCH_MATMUL(c.ur * row_bytes <= INT_MAX, VERBOSE_LARGE_SHAPES);
+    VDISPATCH_MATMUL(IMPLICATION(is_int4_mat,
+                             c.mat_ld % 2 == 0 && c.wei_off0 % 2 == 0),
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+
+    // Integer weights are converted in the kernel for M=1, for N=1 they are
+    // dequantized once into `vec`.
+    c.copy_vec = c.vec_dt != f32 || is_int4_mat
+            || (!c.is_m1 && (c.with_scales || c.with_zp));
+
+    CHECK(pp_attr_.copy_from(*attr()));
+    VDISPATCH_MATMUL_SC(
+            pp_attr_.scales_.set(DNNL_ARG_WEIGHTS, default_quant_entry()),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    init_threading();
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_gemv_matmul_t<isa>::pd_t::init_quantization(engine_t *engine) {
+    auto &c = conf_;
+    const auto &sc = attr()->scales_;
+    const auto &zp = attr()->zero_points_;
+    const bool is_int_wei = types::is_integral_dt(weights_md()->data_type);
+    const int wei_mask_ok = wei_qmask_N() | wei_qmask_K();
+
+    VDISPATCH_MATMUL(sc.get_mask(DNNL_ARG_SRC) == 0
+                    && sc.get_mask(DNNL_ARG_DST) == 0
+                    && sc.has_default_groups(DNNL_ARG_SRC)
+                    && sc.has_default_groups(DNNL_ARG_DST),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_MATMUL(zp.has_default_values(DNNL_ARG_SRC)
+                    && zp.has_default_values(DNNL_ARG_DST),
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+
+    dim_t sc_k_grp = c.K, zp_k_grp = c.K;
+
+    c.with_scales = !sc.has_default_values(DNNL_ARG_WEIGHTS);
+    if (c.with_scales) {
+        const int mask = sc.get_mask(DNNL_ARG_WEIGHTS);
+        c.scales_dt = sc.get_data_type(DNNL_ARG_WEIGHTS);
+        VDISPATCH_MATMUL(utils::one_of(c.scales_dt, f32, bf16, f16)
+                        && (mask & ~wei_mask_ok) == 0
+                        && sc.get_group(DNNL_ARG_WEIGHTS, 1) == 1,
+                VERBOSE_UNSUPPORTED_SCALES_CFG);
+        const bool per_n = mask & wei_qmask_N();
+        const bool per_k = mask & wei_qmask_K();
+        if (per_k) sc_k_grp = sc.get_group(DNNL_ARG_WEIGHTS, 0);
+        c.sc_row_stride = per_n ? 1 : 0;
+        c.sc_grp_stride = per_k ? (per_n ? N() : 1) : 0;
+    }
+
+    c.with_zp = !zp.has_default_values(DNNL_ARG_WEIGHTS);
+    if (c.with_zp) {
+        const int mask = zp.get_mask(DNNL_ARG_WEIGHTS);
+        c.zp_dt = zp.get_data_type(DNNL_ARG_WEIGHTS);
+        VDISPATCH_MATMUL(is_int_wei && utils::one_of(c.zp_dt, s8, u8, s32)
+                        && (mask & ~wei_mask_ok) == 0
+                        && zp.get_group(DNNL_ARG_WEIGHTS, 1) == 1,
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        const bool per_n = mask & wei_qmask_N();
+        const bool per_k = mask & wei_qmask_K();
+        if (per_k) zp_k_grp = zp.get_group(DNNL_ARG_WEIGHTS, 0);
+        c.zp_row_stride = per_n ? 1 : 0;
+        c.zp_grp_stride = per_k ? (per_n ? N() : 1) : 0;
+    }
+
+    // Scales and zero points grouped over K must share the groups.
+    VDISPATCH_MATMUL(
+            utils::one_of(c.K, sc_k_grp, zp_k_grp) || sc_k_grp == zp_k_grp,
+            VERBOSE_UNSUPPORTED_ZP_CFG);
+    c.k_grp = nstl::min(sc_k_grp, zp_k_grp);
+    VDISPATCH_MATMUL(c.k_grp > 0 && c.K % c.k_grp == 0,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    // For M=1 groups are processed by the kernel as a whole, for N=1 the
+    // weights are dequantized elementwise.
+    const bool k_grouped = c.is_m1 && c.k_grp < c.K;
+    VDISPATCH_MATMUL(IMPLICATION(k_grouped, c.k_grp % c.k_blk == 0),
+            VERBOSE_SHAPE_RESTRICTION);
+    c.k_unit = k_grouped ? c.k_grp : c.k_blk;
+    c.with_grp_scales = c.is_m1 && c.with_scales && c.sc_grp_stride != 0;
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_gemv_matmul_t<isa>::pd_t::set_formats(engine_t *engine) {
+    using namespace format_tag;
+    auto &c = conf_;
+    const bool is_3d = ndims() == 3;
+    const format_tag_t plain_tag = is_3d ? abc : ab;
+    // For M=1 rows of `mat` go over N, so K has to be the innermost
+    // dimension of the weights.
+    const format_tag_t wei_tag = c.is_m1 ? (is_3d ? acb : ba) : plain_tag;
+
+    auto init_md = [](memory_desc_t &md, format_tag_t tag) {
+        if (md.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_tag(md, tag);
+    };
+    VDISPATCH_MATMUL_SC(init_md(src_md_, plain_tag), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL_SC(init_md(weights_md_, wei_tag), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL_SC(init_md(dst_md_, plain_tag), VERBOSE_UNSUPPORTED_TAG);
+    if (with_bias())
+        VDISPATCH_MATMUL_SC(
+                init_md(bias_md_, plain_tag), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper src_d(src_md_), wei_d(weights_md_),
+            dst_d(dst_md_);
+    auto is_plain = [](const memory_desc_wrapper &d) {
+        return d.is_blocking_desc() && d.blocking_desc().inner_nblks == 0;
+    };
+    VDISPATCH_MATMUL(is_plain(src_d) && is_plain(wei_d)
+                    && dst_d.matches_tag(plain_tag),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    const int k_src = ndims() - 1, k_wei = ndims() - 2;
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &wei_strides = wei_d.blocking_desc().strides;
+    VDISPATCH_MATMUL(IMPLICATION(c.K > 1,
+                             src_strides[k_src] == 1
+                                     && wei_strides[k_wei] == 1),
+            VERBOSE_UNSUPPORTED_MEM_STRIDE);
+
+    c.mat_ld = c.is_m1 ? wei_strides[ndims() - 1] : src_strides[ndims() - 2];
+    c.src_off0 = src_d.offset0();
+    c.wei_off0 = wei_d.offset0();
+    c.dst_off0 = dst_d.offset0();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gemv_matmul_t<isa>::pd_t::init_threading() {
+    auto &c = conf_;
+    c.nthr = dnnl_get_max_threads();
+    c.k_units = c.K / c.k_unit;
+    c.K_tail = c.K % c.k_unit;
+
+    // Split K only when the rows can't occupy all the threads, keeping
+    // enough of K per thread to amortize the reduction of partial sums.
+    const dim_t n_row_blks = utils::div_up(c.R, c.ur);
+    c.nthr_k = 1;
+    if (n_row_blks < c.nthr) {
+        const dim_t min_k_units = utils::div_up(1024, c.k_unit);
+        c.nthr_k = (int)nstl::max<dim_t>(1,
+                nstl::min<dim_t>(c.nthr / n_row_blks, c.k_units / min_k_units));
+    }
+
+    c.vec_buf_per_thr = utils::rnd_up(
+            utils::div_up(c.k_units, c.nthr_k) * c.k_unit, c.simd_w);
+    c.dst_is_acc = c.dst_dt == f32 && !c.with_pp && c.nthr_k == 1;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gemv_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &c = conf_;
+    auto scratchpad = scratchpad_registry().registrar();
+    if (c.copy_vec && c.k_units > 0)
+        scratchpad.template book<float>(
+                key_matmul_vec_f32, c.nthr * c.vec_buf_per_thr);
+    if (!c.dst_is_acc)
+        scratchpad.template book<float>(
+                key_matmul_dst_in_acc_dt, c.nthr_k * c.R);
+}
+
+template <cpu_isa_t isa>
+jit_uni_gemv_matmul_t<isa>::jit_uni_gemv_matmul_t(const pd_t *apd)
+    : primitive_t(apd) {}
+
+template <cpu_isa_t isa>
+jit_uni_gemv_matmul_t<isa>::~jit_uni_gemv_matmul_t() = default;
+
+template <cpu_isa_t isa>
+status_t jit_uni_gemv_matmul_t<isa>::init(engine_t *engine) {
+    const auto &c = pd()->conf();
+    if (c.k_units > 0) {
+        CHECK(safe_ptr_assign(
+                kernel_, new jit_uni_gemv_matmul_kernel_t<isa>(c)));
+        CHECK(kernel_->create_kernel());
+    }
+    if (c.with_pp) {
+        CHECK(safe_ptr_assign(pp_kernel_,
+                inner_product_utils::pp_kernel_t::create(pd()->N(),
+                        DNNL_RUNTIME_DIM_VAL, pd()->N(), pd()->pp_attr(),
+                        pd()->desc()->bias_desc.data_type, f32, pd()->dst_md(),
+                        false)));
+        CHECK(pp_kernel_->create_kernel());
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_gemv_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &c = pd()->conf();
+
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    const void *wei_scales
+            = CTX_IN_MEM(const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *wei_zps = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector_utils::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
+    const auto src_dt = pd()->src_md()->data_type;
+    const auto wei_dt = pd()->weights_md()->data_type;
+    const dim_t N = pd()->N();
+    dst += c.dst_off0 * types::data_type_size(c.dst_dt);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *acc = c.dst_is_acc
+            ? reinterpret_cast<float *>(dst)
+            : scratchpad.template get<float>(key_matmul_dst_in_acc_dt);
+    float *vec_buf = scratchpad.template get<float>(key_matmul_vec_f32);
+
+    const char *mat = c.is_m1 ? wei : src;
+    const dim_t mat_off0 = c.is_m1 ? c.wei_off0 : c.src_off0;
+    const size_t mat_bits = types::data_type_bits(c.mat_dt);
+    const size_t sc_sz
+            = c.with_scales ? types::data_type_size(c.scales_dt) : 0;
+    const size_t zp_sz = c.with_zp ? types::data_type_size(c.zp_dt) : 0;
+
+    // Dequantized value of the weights at (k, n).
+    auto wei_value = [&](dim_t n, dim_t k) {
+        const dim_t off = c.is_m1 ? n * c.mat_ld + k : k;
+        float w = io::load_float_value(wei_dt, wei, c.wei_off0 + off);
+        const dim_t g = k / c.k_grp;
+        if (c.with_zp)
+            w -= io::load_float_value(c.zp_dt, wei_zps,
+                    n * c.zp_row_stride + g * c.zp_grp_stride);
+        if (c.with_scales)
+            w *= io::load_float_value(c.scales_dt, wei_scales,
+                    n * c.sc_row_stride + g * c.sc_grp_stride);
+        return w;
+    };
+    auto src_value = [&](dim_t m, dim_t k) {
+        return io::load_float_value(
+                src_dt, src, c.src_off0 + m * c.mat_ld + k);
+    };
+
+    // Converts `vec` over [k_start, k_end) into the buffer of the thread.
+    auto prepare_vec = [&](int ithr, dim_t k_start, dim_t k_end) {
+        if (!c.copy_vec) {
+            const auto *v
+                    = reinterpret_cast<const float *>(c.is_m1 ? src : wei);
+            return v + (c.is_m1 ? c.src_off0 : c.wei_off0) + k_start;
+        }
+
+        float *buf = vec_buf + ithr * c.vec_buf_per_thr;
+        const dim_t len = k_end - k_start;
+        if (!c.is_m1) {
+            for (dim_t k = k_start; k < k_end; k++)
+                buf[k - k_start] = wei_value(0, k);
+        } else if (utils::one_of(c.mat_dt, s4, u4)) {
+            // Even elements go to the first half of a block and odd ones to
+            // the second half, matching the order of unpacked nibbles.
+            for (dim_t kb = 0; kb < len; kb += c.k_blk) {
+                for (int j = 0; j < c.simd_w; j++) {
+                    const dim_t k = k_start + kb + 2 * j;
+                    buf[kb + j] = src_value(0, k);
+                    buf[kb + c.simd_w + j] = src_value(0, k + 1);
+                }
+            }
+        } else if (src_dt == bf16) {
+            cvt_bfloat16_to_float(buf,
+                    reinterpret_cast<const bfloat16_t *>(src) + c.src_off0
+                            + k_start,
+                    len);
+        } else if (src_dt == f16) {
+            cvt_float16_to_float(buf,
+                    reinterpret_cast<const float16_t *>(src) + c.src_off0
+                            + k_start,
+                    len);
+        } else {
+            for (dim_t k = k_start; k < k_end; k++)
+                buf[k - k_start] = src_value(0, k);
+        }
+        return static_cast<const float *>(buf);
+    };
+
+    const bool k_grouped = c.is_m1 && c.k_grp < c.K;
+    const dim_t n_row_blks = utils::div_up(c.R, c.ur);
+    const int nthr_r = c.nthr / c.nthr_k;
+
+    auto compute = [&](int ithr, int ithr_r, int ithr_k) {
+        dim_t r_start {0}, r_end {0}, u_start {0}, u_end {0};
+        balance211(n_row_blks, nthr_r, ithr_r, r_start, r_end);
+        r_start *= c.ur;
+        r_end = nstl::min(r_end * c.ur, c.R);
+        if (r_start >= r_end) return;
+        balance211(c.k_units, c.nthr_k, ithr_k, u_start, u_end);
+
+        float *part = acc + ithr_k * c.R;
+        if (u_start < u_end) {
+            const dim_t k_start = u_start * c.k_unit;
+            const dim_t k_end = u_end * c.k_unit;
+            gemv_matmul_kernel_t::call_params_t p;
+            p.mat = mat
+                    + (mat_off0 + r_start * c.mat_ld + k_start) * mat_bits / 8;
+            p.vec = prepare_vec(ithr, k_start, k_end);
+            p.scales = c.is_m1 && c.with_scales
+                    ? static_cast<const char *>(wei_scales)
+                            + (r_start * c.sc_row_stride
+                                      + k_start / c.k_grp * c.sc_grp_stride)
+                                    * sc_sz
+                    : nullptr;
+            p.zps = c.is_m1 && c.with_zp
+                    ? static_cast<const char *>(wei_zps)
+                            + (r_start * c.zp_row_stride
+                                      + k_start / c.k_grp * c.zp_grp_stride)
+                                    * zp_sz
+                    : nullptr;
+            p.dst = part + r_start;
+            p.rows = r_end - r_start;
+            p.ngroups = k_grouped ? u_end - u_start : 1;
+            p.nchunks = k_grouped ? c.k_unit / c.k_blk : u_end - u_start;
+            (*kernel_)(&p);
+        } else {
+            utils::array_set(part + r_start, 0.f, r_end - r_start);
+        }
+
+        if (ithr_k != c.nthr_k - 1) return;
+        for (dim_t r = r_start; r < r_end; r++) {
+            float s = 0.f;
+            for (dim_t k = c.K - c.K_tail; k < c.K; k++)
+                s += c.is_m1 ? wei_value(r, k) * src_value(0, k)
+                             : src_value(r, k) * wei_value(0, k);
+            part[r] += s;
+        }
+    };
+
+    parallel(c.nthr, [&](int ithr, int nthr) {
+        // Work is split for `c.nthr` threads, fewer threads process several
+        // of the work items each.
+        for (int t = ithr; t < c.nthr; t += nthr)
+            compute(ithr, t / c.nthr_k, t % c.nthr_k);
+    });
+
+    if (c.dst_is_acc) return status::success;
+
+    parallel(c.nthr, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(c.R, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        for (int ik = 1; ik < c.nthr_k; ik++) {
+            const float *part = acc + ik * c.R;
+            PRAGMA_OMP_SIMD()
+            for (dim_t r = start; r < end; r++)
+                acc[r] += part[r];
+        }
+
+        if (c.with_pp) {
+            (*pp_kernel_)(dst, acc, bias, src_scales, dst_scales[0], start,
+                    start, start % N, end, (size_t)N, N, nullptr,
+                    post_ops_binary_rhs_arg_vec.data(), dst, 0, ctx,
+                    *pd()->dst_md());
+        } else if (c.dst_dt == bf16) {
+            cvt_float_to_bfloat16(reinterpret_cast<bfloat16_t *>(dst) + start,
+                    acc + start, end - start);
+        } else if (c.dst_dt == f16) {
+            cvt_float_to_float16(reinterpret_cast<float16_t *>(dst) + start,
+                    acc + start, end - start);
+        } else {
+            utils::array_copy(reinterpret_cast<float *>(dst) + start,
+                    acc + start, end - start);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_gemv_matmul_t<avx512_core>;
+template struct jit_uni_gemv_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_UNI_GEMV_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_UNI_GEMV_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/primitive_attr.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/gemm_inner_product_utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Matrix-vector products met in token-by-token decoding: either M=1 or N=1.
+// The product is computed as `acc[r] = sum_k mat[r][k] * vec[k]`, where
+// - for M=1 `mat` is the weights (rows over N, contiguous over K) and `vec`
+//   is the single row of the source,
+// - for N=1 `mat` is the source and `vec` is the single column of the
+//   weights.
+// The kernel streams `mat` once converting it to f32 on the fly, so integer
+// weights are dequantized in registers with their scales and zero points
+// applied per group of K. When there are too few rows to occupy all the
+// threads, the K dimension is split as well and the partial sums are reduced
+// before the post-processing.
+struct jit_uni_gemv_matmul_conf_t {
+    bool is_m1;
+    data_type_t mat_dt, vec_dt, dst_dt;
+    // Rows of `mat` and the reduction size.
+    dim_t R, K;
+    // Row stride of `mat` and offsets of the operands, in elements.
+    dim_t mat_ld;
+    dim_t src_off0, wei_off0, dst_off0;
+
+    // Elements of K consumed by one iteration of the kernel. For int4
+    // weights two vector registers are consumed at once.
+    int simd_w, k_blk;
+    // Rows processed together sharing the loads of `vec`.
+    int ur;
+
+    // Weights quantization applied by the kernel (M=1) or while preparing
+    // `vec` (N=1). Strides are in elements.
+    bool with_scales, with_zp;
+    data_type_t scales_dt, zp_dt;
+    dim_t sc_row_stride, sc_grp_stride;
+    dim_t zp_row_stride, zp_grp_stride;
+    // Scales applied per group of K need a separate accumulator.
+    bool with_grp_scales;
+    // K group of the quantization parameters, K if none is grouped.
+    dim_t k_grp;
+
+    // K is split in units of `k_unit` elements, the remaining `K_tail`
+    // elements are processed outside of the kernel.
+    dim_t k_unit, k_units, K_tail;
+    int nthr, nthr_k;
+
+    // `vec` must be converted to f32 (or permuted for int4 weights).
+    bool copy_vec;
+    size_t vec_buf_per_thr;
+    bool with_pp;
+    // The kernel stores the result to the destination directly.
+    bool dst_is_acc;
+};
+
+struct gemv_matmul_kernel_t;
+
+template <cpu_isa_t isa>
+struct jit_uni_gemv_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:gemv:", isa, ""),
+                jit_uni_gemv_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_uni_gemv_matmul_conf_t &conf() const { return conf_; }
+        const primitive_attr_t *pp_attr() const { return &pp_attr_; }
+
+    private:
+        status_t init_quantization(engine_t *engine);
+        status_t set_formats(engine_t *engine);
+        void init_threading();
+        void init_scratchpad();
+
+        jit_uni_gemv_matmul_conf_t conf_ = utils::zero<decltype(conf_)>();
+        // Attributes of the post-processing with the weights scales taken
+        // out, as those are applied by the kernel.
+        primitive_attr_t pp_attr_;
+    };
+
+    jit_uni_gemv_matmul_t(const pd_t *apd);
+    ~jit_uni_gemv_matmul_t() override;
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<gemv_matmul_kernel_t> kernel_;
+    std::unique_ptr<inner_product_utils::pp_kernel_t> pp_kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino+=l0,\:4,N-s
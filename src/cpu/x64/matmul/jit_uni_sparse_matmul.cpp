@@ -23,6 +23,8 @@
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/matmul/matmul_utils.hpp"
+
 #include "cpu/x64/jit_generator.hpp"
 
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
@@ -361,9 +363,6 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
 
-    // TODO: Implement a load balancing mechanism that would distribute
-    // rows between threads based on the number of non-zero elements in those
-    // rows.
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
     // Empirical.
     const size_t threshold_in_kb = 1400;
@@ -372,10 +371,15 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     // If not, use 0, which means all threads.
     const int nthr = data_to_process_in_kb < threshold_in_kb;
+#else
+    const int nthr = 0;
+#endif
 
+    // Rows are distributed between threads by the number of non-zero
+    // elements in them rather than evenly.
     parallel(nthr, [&](const int ithr, const int nthr) {
         dim_t start = 0, end = 0;
-        balance211(M, nthr, ithr, start, end);
+        cpu::matmul::balance_csr_rows(src_pointers, M, nthr, ithr, start, end);
         if (start >= end) return;
 
         for (dim_t m = start; m < end; m++) {
@@ -393,23 +397,6 @@ status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
             (*kernel_)(&p);
         }
     });
-#else
-
-    parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
-        const int nnz = row_end - row_begin;
-
-        sparse_matmul_kernel_t::call_params_t p;
-        p.nnz = nnz;
-        p.src_values = src_values + row_begin;
-        p.src_indices = src_indices + row_begin;
-        p.wei = weights;
-        p.dst = dst + (m * N);
-        p.block_size = kernel_->block_size();
-        (*kernel_)(&p);
-    });
-#endif
     return status::success;
 }
 
@@ -109,15 +109,22 @@ template <typename src_t, typename weights_t, typename scratch_t,
         typename gemm_acc_t>
 void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t, gemm_acc_t>::execute()
         const {
-    if (is_fused_layer_iter_brgemm_) {
-        parallel(max_nthr_, [this](const int ithr, const int nthr) {
-            this->kernel_fused_iter_layer(ithr, nthr);
-        });
-    } else {
-        parallel(max_nthr_, [this](const int ithr, const int nthr) {
-            this->kernel(ithr, nthr);
-        });
-    }
+    parallel(max_nthr_, [this](const int ithr, const int nthr) {
+        int start = 0, end = 0;
+        balance211(work_amount_, nthr, ithr, start, end);
+        this->execute_blocks(ithr, start, end);
+    });
+}
+
+template <typename src_t, typename weights_t, typename scratch_t,
+        typename gemm_acc_t>
+void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t,
+        gemm_acc_t>::execute_blocks(const int ithr, const int start,
+        const int end) const {
+    if (is_fused_layer_iter_brgemm_)
+        kernel_fused_iter_layer(ithr, start, end);
+    else
+        kernel(ithr, start, end);
 }
 
 // Returns the number of threads to use. Returns 1 for small problems to avoid multithreading overhead.
@@ -155,12 +162,9 @@ int brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t,
 template <typename src_t, typename weights_t, typename scratch_t,
         typename gemm_acc_t>
 void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t, gemm_acc_t>::kernel(
-        const int ithr, const int nthr) const {
+        const int ithr, int start, const int end) const {
     using namespace cpu::rnn_utils;
 
-    int start = 0, end = 0;
-    balance211(work_amount_, nthr, ithr, start, end);
-
     const bool is_amx = is_superset(rnn_.brgemm_isa, x64::avx512_core_amx);
     gemm_acc_t *const amx_buffer = is_amx
             ? amx_scratchpad_ + rnn_.m_block * rnn_.n_block * ithr
@@ -322,13 +326,10 @@ void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t, gemm_acc_t>::kernel(
 template <typename src_t, typename weights_t, typename scratch_t,
         typename gemm_acc_t>
 void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t,
-        gemm_acc_t>::kernel_fused_iter_layer(const int ithr,
-        const int nthr) const {
+        gemm_acc_t>::kernel_fused_iter_layer(const int ithr, int start,
+        const int end) const {
     using namespace cpu::rnn_utils;
 
-    int start = 0, end = 0;
-    balance211(work_amount_, nthr, ithr, start, end);
-
     const bool is_amx = is_superset(rnn_.brgemm_isa, x64::avx512_core_amx);
     gemm_acc_t *const amx_buffer = is_amx
             ? amx_scratchpad_ + rnn_.m_block * rnn_.n_block * ithr
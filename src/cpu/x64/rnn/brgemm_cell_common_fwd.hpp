@@ -43,11 +43,16 @@ public:
             x64::brgemm_batch_element_t *addr_batch_global,
             const postgemm_fused_t &fused_postgemm);
     void execute() const;
+    // Computes the blocks [start, end) of the cell on the calling thread, the
+    // blocks are enumerated in the rnn.loop_order order.
+    void execute_blocks(const int ithr, const int start, const int end) const;
+    int work_amount() const { return work_amount_; }
 
 private:
     int calculate_nthr() const;
-    void kernel(const int ithr, const int nthr) const;
-    void kernel_fused_iter_layer(const int ithr, const int nthr) const;
+    void kernel(const int ithr, int start, const int end) const;
+    void kernel_fused_iter_layer(
+            const int ithr, int start, const int end) const;
 
     const ref_rnn_brgemm_t &rnn_brgemm_;
     const rnn_utils::rnn_conf_t &rnn_;
@@ -564,8 +564,28 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
     rnn.brgemm_fwd_iter_layer_fuse_possible
             = rnn.slc == rnn.sic && !rnn.merge_gemm_layer;
 
+    // When a single cell doesn't have enough blocks to keep all the threads
+    // busy (small batch and hidden size), blocks of cells on the same
+    // (layer, iteration) wavefront and of both directions are computed
+    // concurrently. Blocks wait only for the rows they consume instead of a
+    // barrier per cell, so the post-gemm has to be fused. GRU cells with
+    // several gemm parts, the projection and AMX tile buffers are not
+    // supported. For testing, _ONEDNN_RNN_WAVEFRONT=0 disables the mode and
+    // _ONEDNN_RNN_WAVEFRONT=1 enables it regardless of the number of blocks.
+    const bool wavefront_grid_ok = rnn.n_layer > 1 || rnn.n_dir > 1;
+    const int wavefront_env = getenv_int("_ONEDNN_RNN_WAVEFRONT", -1);
+    const bool wavefront_work_ok = wavefront_env < 0
+            ? rnn.M_blocks * rnn.N_blocks < rnn.nthr
+            : wavefront_env > 0;
+    rnn.wavefront = !rnn.is_training && !rnn.merge_gemm_layer
+            && !rnn.is_orig_gru && !rnn.is_lbr && !rnn.is_lstm_projection
+            && !rnn.is_cell_amx() && wavefront_grid_ok && rnn.nthr > 1
+            && wavefront_work_ok;
+    if (rnn.wavefront) rnn.unfused_post_gemm = false;
+
     if (!rnn.is_orig_gru) {
-        rnn.loop_order = rnn.is_cell_int8_amx() || rnn.is_cell_xf16_amx()
+        rnn.loop_order = rnn.wavefront || rnn.is_cell_int8_amx()
+                        || rnn.is_cell_xf16_amx()
                 ? brgemm_rnn_execute_loop_order_t::mblk_nblk
                 : brgemm_rnn_execute_loop_order_t::nblk_mblk;
     }
@@ -40,9 +40,7 @@ using namespace dnnl::impl::cpu::ukernel;
     VCONDCHECK(ukernel, create, check, brgemm, (cond), (status), msg, \
             ##__VA_ARGS__)
 
-dnnl_brgemm::~dnnl_brgemm() {
-    brgemm_kernel_destroy(brgemm_kernel_);
-}
+dnnl_brgemm::~dnnl_brgemm() = default;
 
 // Typical usage is either `1.f` to append to previous result, or `0.f` to write
 // C from scratch.
@@ -173,9 +171,11 @@ status_t brgemm_t::generate() {
     // Re-generation won't take any effect.
     if (brgemm_kernel_ != nullptr) return status::success;
 
-    auto status = brgemm_kernel_create(&brgemm_kernel_, brgemm_desc_);
-    VCHECK_BRGEMM_STATUS(
-            status, status == status::success, "brgemm_kernel_create failed");
+    // The kernel is shared with other objects and primitives generating the
+    // same one.
+    auto status = brgemm_kernel_get_or_create(brgemm_kernel_, brgemm_desc_);
+    VCHECK_BRGEMM_STATUS(status, status == status::success,
+            "brgemm_kernel_get_or_create failed");
 
     // Generate a verbose info string at the point where configuration is done.
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
@@ -195,7 +195,7 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         double start_ms = get_msec();
-        brgemm_kernel_execute(brgemm_kernel_, batch_size, A_ptr, B_ptr,
+        brgemm_kernel_execute(brgemm_kernel_.get(), batch_size, A_ptr, B_ptr,
                 v_batch_element.data(), C_ptr, scratchpad_ptr,
                 /* dynamic_values = */ nullptr);
         double duration_ms = get_msec() - start_ms;
@@ -205,7 +205,7 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
                 duration_ms);
     } else {
-        brgemm_kernel_execute(brgemm_kernel_, batch_size, A_ptr, B_ptr,
+        brgemm_kernel_execute(brgemm_kernel_.get(), batch_size, A_ptr, B_ptr,
                 v_batch_element.data(), C_ptr, scratchpad_ptr,
                 /* dynamic_values = */ nullptr);
     }
@@ -264,8 +264,8 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
 
     if (get_verbose(verbose_t::exec_profile, component_t::ukernel)) {
         double start_ms = get_msec();
-        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
-                v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
+        brgemm_kernel_execute_postops(brgemm_kernel_.get(), batch_size, A_ptr,
+                B_ptr, v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
                 post_ops_data, scratchpad_ptr,
                 /* dynamic_values = */ nullptr);
         double duration_ms = get_msec() - start_ms;
@@ -275,8 +275,8 @@ status_t brgemm_t::execute(const void *A_ptr, const void *B_ptr,
         VPROF(start_ms, ukernel, exec, VERBOSE_profile, ss.str().c_str(),
                 duration_ms);
     } else {
-        brgemm_kernel_execute_postops(brgemm_kernel_, batch_size, A_ptr, B_ptr,
-                v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
+        brgemm_kernel_execute_postops(brgemm_kernel_.get(), batch_size, A_ptr,
+                B_ptr, v_batch_element.data(), const_cast<void *>(C_ptr), D_ptr,
                 post_ops_data, scratchpad_ptr,
                 /* dynamic_values = */ nullptr);
     }
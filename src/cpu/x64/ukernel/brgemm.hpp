@@ -17,6 +17,8 @@
 #ifndef CPU_X64_UKERNEL_BRGEMM_HPP
 #define CPU_X64_UKERNEL_BRGEMM_HPP
 
+#include <memory>
+
 #include "cpu/ukernel/c_types_map.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -45,7 +47,7 @@ struct dnnl_brgemm : public dnnl::impl::c_compatible {
         , c_dt_(c_dt)
         , d_dt_(c_dt) // User may overwrite with set_post_ops().
         , beta_(0.f) // User may overwrite with set_add_C().
-        , brgemm_kernel_(nullptr) {}
+    {}
 
     ~dnnl_brgemm();
 
@@ -90,7 +92,7 @@ private:
 
     // A main kernel.
     dnnl::impl::cpu::x64::brgemm_desc_t brgemm_desc_;
-    dnnl::impl::cpu::x64::brgemm_kernel_t *brgemm_kernel_;
+    std::shared_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> brgemm_kernel_;
 
     // Creates a `verbose_info_` string once during `generate()` call, and calls
     // it during execute(). This is done to avoid string re-creation.
@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/wino_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+
+namespace {
+constexpr int alpha = 6;
+constexpr int r = 3;
+
+// Filter transform matrix of F(4x4, 3x3) for the interpolation points
+// {0, -1, 1, 1/2, -1/2, inf}.
+const float G[alpha][r] = {
+        {1.f / 4, 0.f, 0.f},
+        {-1.f / 6, -1.f / 6, -1.f / 6},
+        {-1.f / 6, 1.f / 6, -1.f / 6},
+        {1.f / 24, 1.f / 12, 1.f / 6},
+        {1.f / 24, -1.f / 12, 1.f / 6},
+        {0.f, 0.f, 1.f},
+};
+} // namespace
+
+status_t wino_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
+        engine_t *engine, const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    const memory_desc_wrapper input_d(src_md);
+    const memory_desc_wrapper output_d(dst_md);
+
+    VDISPATCH_REORDER_IC(
+            input_d.is_blocking_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    VDISPATCH_REORDER_IC(
+            output_d.is_wino_desc(), VERBOSE_UNSUPPORTED_FORMAT_KIND);
+    const auto &wd = output_d.wino_desc();
+    VDISPATCH_REORDER_IC(
+            wd.wino_format == wino_memory_format_t::wino_wei_OBaaIoi,
+            VERBOSE_UNSUPPORTED_FEATURE,
+            "only wino_wei_OBaaIoi is supported for dst");
+    VDISPATCH_REORDER_IC(wd.r == r && wd.alpha == alpha,
+            VERBOSE_UNSUPPORTED_FEATURE, "only F(4x4, 3x3) is supported");
+    VDISPATCH_REORDER_IC(input_d.ndims() == 4 && output_d.ndims() == 4,
+            VERBOSE_BAD_NDIMS, "src", input_d.ndims());
+    VDISPATCH_REORDER_IC(input_d.dims()[2] == r && input_d.dims()[3] == r
+                    && input_d.dims()[0] == wd.oc
+                    && input_d.dims()[1] == wd.ic,
+            VERBOSE_INCONSISTENT_MDS, "src", "dst");
+    VDISPATCH_REORDER_IC(!input_d.has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_REORDER_IC(
+            utils::one_of(output_d.data_type(), f32, bf16)
+                    && utils::one_of(input_d.data_type(), f32, bf16)
+                    && IMPLICATION(input_d.data_type() == bf16,
+                            output_d.data_type() == bf16),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_REORDER_IC(attr->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return status::out_of_memory;
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+    return safe_ptr_assign(*reorder_pd, _pd.release());
+}
+
+status_t wino_reorder_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    const auto input = CTX_IN_MEM(const char *, DNNL_ARG_FROM);
+    auto output = CTX_OUT_CLEAN_MEM(char *, DNNL_ARG_TO, status);
+    CHECK(status);
+
+    const memory_desc_wrapper input_d(pd()->src_md());
+    const memory_desc_wrapper output_d(pd()->dst_md());
+    const auto &wd = output_d.wino_desc();
+    const auto idt = input_d.data_type();
+    const auto odt = output_d.data_type();
+    const size_t idt_sz = input_d.data_type_size();
+
+    const dim_t OC = wd.oc, IC = wd.ic;
+    const dim_t oc_block = wd.oc_block, vnni = wd.ic_block;
+    const dim_t ic_pad = utils::rnd_up(IC, vnni);
+
+    // The padded input and output channels are zero.
+    std::memset(output, 0, wd.size);
+
+    parallel_nd(OC, IC, [&](dim_t oc, dim_t ic) {
+        float g[r][r];
+        for_(int h = 0; h < r; h++)
+        for (int w = 0; w < r; w++)
+            g[h][w] = io::load_float_value(
+                    idt, input + input_d.off(oc, ic, h, w) * idt_sz, 0);
+
+        // tmp = G g
+        float tmp[alpha][r];
+        for_(int i = 0; i < alpha; i++)
+        for (int w = 0; w < r; w++)
+            tmp[i][w] = G[i][0] * g[0][w] + G[i][1] * g[1][w]
+                    + G[i][2] * g[2][w];
+
+        const dim_t ob = oc / oc_block, o = oc % oc_block;
+        const dim_t blk_off
+                = (ic - ic % vnni) * oc_block + o * vnni + ic % vnni;
+        // U = tmp G^T
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            const float u = tmp[i][0] * G[j][0] + tmp[i][1] * G[j][1]
+                    + tmp[i][2] * G[j][2];
+            const dim_t a = i * alpha + j;
+            io::store_float_value(odt, u, output,
+                    (ob * alpha * alpha + a) * ic_pad * oc_block + blk_off);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
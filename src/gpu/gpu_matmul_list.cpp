@@ -56,7 +56,9 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
 } // namespace
 
 const impl_list_item_t *get_matmul_impl_list(const matmul_desc_t *desc) {
-    UNUSED(desc);
+    // Grouped matmul is not supported on GPU.
+    static const impl_list_item_t empty_list[] = {nullptr};
+    if (desc->group_offsets_desc.ndims != 0) return empty_list;
     return impl_list;
 }
 
@@ -110,6 +110,8 @@ struct micro_t : public primitive_t {
         status_t init(impl::engine_t *engine) {
             using namespace data_type;
 
+            VDISPATCH_SDPA(!with_paged_kv(), VERBOSE_UNSUPPORTED_FEATURE,
+                    "paged K/V cache");
             VCHECK_SDPA_COND(
                     utils::everyone_is(4, qry_md()->ndims, key_md()->ndims,
                             val_md()->ndims, dst_md()->ndims),
@@ -16,6 +16,11 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_CONSTANT_TENSOR_CACHE_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_CONSTANT_TENSOR_CACHE_HPP
 
+#include "common/utils.hpp"
+
+#include "cpu/cpu_weights_replicas.hpp"
+#include "cpu/platform.hpp"
+
 #include "graph/interface/constant_tensor_cache.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -34,6 +39,20 @@ struct dnnl_constant_buffer_t : public graph::constant_buffer_t {
         : graph::constant_buffer_t(
                 size, engine.get(), alc, malloc_func, free_func) {}
 
+    ~dnnl_constant_buffer_t() override {
+        if (replicas_) cpu::unregister_weights_replicas(replicas_.get());
+    }
+
+    // Makes a copy of the filled buffer on each NUMA node. The primitives
+    // created with the weights replication attribute find the copies by the
+    // address of their weights.
+    void replicate() {
+        if (replicas_) return;
+        if (cpu::weights_replicas_t::create(replicas_, data_, size_)
+                == status::success)
+            cpu::register_weights_replicas(replicas_);
+    }
+
     static void *malloc_func(
             size_t size, impl::engine_t *eng, graph::allocator_t *alc) {
         dnnl::engine engine;
@@ -60,6 +79,9 @@ struct dnnl_constant_buffer_t : public graph::constant_buffer_t {
 #endif
         }
     }
+
+private:
+    std::shared_ptr<cpu::weights_replicas_t> replicas_;
 };
 
 inline graph::constant_tensor_cache_t::value_t dnnl_constant_cache_get_or_add(
@@ -88,6 +110,34 @@ inline bool is_constant_cache_enabled(const dnnl::engine &eng) {
     return cache && cache->get_capacity() != 0;
 }
 
+// Returns true if the constant buffers of CPU partitions are replicated on
+// each NUMA node, which is requested with ONEDNN_GRAPH_WEIGHTS_REPLICATION=1.
+// The replication requires the constant cache.
+inline bool is_weights_replication_enabled(const dnnl::engine &eng) {
+    static const bool enabled
+            = getenv_int_user("GRAPH_WEIGHTS_REPLICATION", 0) > 0
+            && cpu::platform::get_num_numa_nodes() > 1;
+    return enabled && eng.get_kind() == dnnl::engine::kind::cpu
+            && is_constant_cache_enabled(eng);
+}
+
+// Returns the size taken in the constant cache by a buffer of `size` bytes,
+// including its copies if it is replicated.
+inline size_t dnnl_constant_cache_footprint(
+        const dnnl::engine &eng, size_t size) {
+    if (!is_weights_replication_enabled(eng)) return size;
+    return size * (1 + cpu::platform::get_num_numa_nodes());
+}
+
+// Replicates `buffer`, once filled with the constant tensors, if the weights
+// replication is enabled.
+inline void dnnl_constant_buffer_replicate(const dnnl::engine &eng,
+        const graph::constant_tensor_cache_t::cached_t &buffer) {
+    if (!is_weights_replication_enabled(eng)) return;
+    dnnl::impl::utils::downcast<dnnl_constant_buffer_t *>(buffer.get())
+            ->replicate();
+}
+
 inline void dnnl_constant_cache_retain(const dnnl::engine &eng) {
     auto cache = graph::get_constant_tensor_cache(
             eng.get()->kind(), eng.get()->index());
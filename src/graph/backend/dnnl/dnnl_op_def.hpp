@@ -319,6 +319,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_convolution, 1,
                 .set_attr(op_attr::with_bias, false, attribute_kind::b, false)
                 .set_attr(
                         op_attr::canonicalized, false, attribute_kind::b, false)
+                .set_attr(op_attr::use_plain_layout, false, attribute_kind::b,
+                        false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_dnnl_conv_output_shape)
@@ -994,6 +996,30 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_matmul, 1,
                 .SET_EXECUTABLE_CREATOR(executable_creator<matmul_executable_t>)
                 .SET_ARG_INDICES_GETTER(matmul_executable_t))
 
+DNNL_GRAPH_OP_SCHEMA(dnnl_grouped_matmul, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::variadic)
+                .set_num_inputs(std::set<size_t>({3, 32}))
+                .set_num_outputs(2)
+                .set_input(0, "src")
+                .set_input(1, "weights")
+                .set_input(2, "group_offsets")
+                .set_input(3, "bias") // optional
+                .set_output(0, "dst")
+                .set_output(1, "scratchpad")
+                // New added attributes
+                .set_attr(op_attr::fusion_info, false,
+                        attribute_kind::fusion_info)
+                .set_attr(op_attr::with_bias, false, attribute_kind::b, false)
+                .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // Analysis rules
+                .set_shape_inference_function(
+                        infer_grouped_matmul_output_shape)
+                .SET_LAYOUT_PROPAGATOR(layout_propagator_for_grouped_matmul)
+                .SET_EXECUTABLE_CREATOR(
+                        executable_creator<grouped_matmul_executable_t>)
+                .SET_ARG_INDICES_GETTER(grouped_matmul_executable_t))
+
 DNNL_GRAPH_OP_SCHEMA(dnnl_softmax, 1,
         op_schema_t()
                 .set_inputs_option(op_schema_t::param_num_option::variadic)
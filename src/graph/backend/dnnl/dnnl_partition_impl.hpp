@@ -93,6 +93,8 @@ public:
 
     std::string str() const override { return kernel_->str(); }
 
+    const kernel_ptr &get_kernel() const { return kernel_; }
+
 private:
     kernel_ptr kernel_;
 };
@@ -71,6 +71,7 @@ namespace op_kind {
     X(dnnl_conv_bwd_weights, Dnnl_conv_bwd_weights) \
     X(dnnl_pool_bwd, Dnnl_pool_bwd) \
     X(dnnl_matmul, Dnnl_matmul) \
+    X(dnnl_grouped_matmul, Dnnl_grouped_matmul) \
     X(dnnl_softmax, Dnnl_softmax) \
     X(dnnl_logsoftmax, Dnnl_logsoftmax) \
     X(dnnl_layernorm, Dnnl_layernorm) \
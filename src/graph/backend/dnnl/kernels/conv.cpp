@@ -19,6 +19,7 @@
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
 #include "graph/backend/dnnl/passes/constant_propagation.hpp"
 #include "graph/backend/dnnl/passes/insert_ops.hpp"
+#include "graph/backend/dnnl/passes/layout_assignment.hpp"
 #include "graph/backend/dnnl/passes/layout_propagation.hpp"
 #include "graph/backend/dnnl/passes/lower.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
@@ -100,8 +101,10 @@ status_t conv_fwd_t<quantized>::compile_impl(const dnnl_partition_impl_t *part,
         BACKEND_DNNL_ADD_PASS(pipeline, constant_propagation);
     }
 
+    BACKEND_DNNL_ADD_PASS(pipeline, layout_assignment);
     BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
     BACKEND_DNNL_ADD_PASS(pipeline, common_reorder_elimination);
+    BACKEND_DNNL_ADD_PASS(pipeline, fuse_adjacent_reorders);
 
     // constant propagation
     if (enabled_constant_cache()) {
@@ -68,7 +68,9 @@ status_t conv_base_t::execute_impl(const stream_t *g_stream,
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
                 = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
-                        memory_planner_.total_internal_persistent_size(),
+                        dnnl_constant_cache_footprint(p_engine_,
+                                memory_planner_
+                                        .total_internal_persistent_size()),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
         if (is_from_cache) {
@@ -95,6 +97,7 @@ status_t conv_base_t::execute_impl(const stream_t *g_stream,
                 subgraph_->execs_[i]->execute(
                         p_stream, res->get_exec_args()[i]);
             }
+            dnnl_constant_buffer_replicate(p_engine_, c_buffer);
 
             c_promise.set_value(c_buffer);
         }
@@ -0,0 +1,506 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_set>
+
+#include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "graph/backend/dnnl/kernels/gated_mlp_decomp.hpp"
+
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+#include "graph/backend/dnnl/passes/utils.hpp"
+
+#include "graph/interface/shape_infer.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+#include "cpu/cpu_stream.hpp"
+#include "oneapi/dnnl/dnnl_threadpool.h"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+using ltw = logical_tensor_wrapper_t;
+
+namespace {
+
+// Smallest number of rows worth a block of its own.
+constexpr dim_t min_m_blk = 16;
+// Smallest number of intermediate columns of a slice.
+constexpr dim_t min_n_blk = 64;
+
+bool is_dense_row_major(const logical_tensor_t &lt) {
+    const ltw lw(lt);
+    if (!lw.is_strided() || lw.ndims() < 2) return false;
+    dim_t stride = 1;
+    for (int d = lw.ndims() - 1; d >= 0; d--) {
+        if (lw.dims()[d] != 1 && lw.strides()[d] != stride) return false;
+        stride *= lw.dims()[d];
+    }
+    return true;
+}
+
+// Returns a 2D row-major logical tensor of `rows` rows with the same columns
+// as `lt`.
+logical_tensor_t make_rows_lt(const logical_tensor_t &lt, dim_t rows) {
+    logical_tensor_t ret = lt;
+    const dims shape {rows, ltw(lt).dims()[ltw(lt).ndims() - 1]};
+    ret.layout_type = layout_type::strided;
+    dnnl::impl::utils::array_copy(ret.dims, shape.data(), shape.size());
+    const dims strides = get_dense_strides(shape);
+    dnnl::impl::utils::array_copy(
+            ret.layout.strides, strides.data(), strides.size());
+    ret.ndims = 2;
+    return ret;
+}
+
+} // namespace
+
+status_t gated_mlp_block_kernel_t::prepare_subgraph(
+        std::shared_ptr<subgraph_t> &sg) {
+    // The internal tensors have the shapes of the whole partition. They are
+    // reset so that their shapes are inferred from the block ones.
+    std::unordered_set<size_t> out_ids;
+    for (const auto &out : sg->outs_)
+        out_ids.insert(out.id);
+    for (auto &op : sg->get_ops()) {
+        for (auto &val : op->get_output_values()) {
+            logical_tensor_t lt = val->get_logical_tensor();
+            if (out_ids.count(lt.id)) continue;
+            lt.ndims = DNNL_GRAPH_UNKNOWN_NDIMS;
+            lt.layout_type = layout_type::any;
+            val->set_logical_tensor(lt);
+        }
+    }
+    return infer_shape(sg);
+}
+
+bool gated_mlp_block_kernel_t::has_runtime_reorder() const {
+    for (const auto &op : subgraph_->get_ops()) {
+        if (op->get_kind() != op_kind::dnnl_reorder) continue;
+        if (!(op->has_attr(op_attr::is_constant)
+                    && op->get_attr<bool>(op_attr::is_constant)))
+            return true;
+    }
+    return false;
+}
+
+bool gated_mlp_decomp_kernel_t::init_slicing(
+        const std::vector<logical_tensor_t> &inputs, const value_t *val,
+        int w_axis) {
+    auto set_axis = [&](const value_t *in, int axis, bool is_param) {
+        if (in->has_producer()) return false;
+        const size_t id = in->get_logical_tensor().id;
+        size_t idx = inputs.size();
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (inputs[i].id == id) idx = i;
+        }
+        if (idx == inputs.size() || idx == src_idx_) return false;
+
+        const logical_tensor_t &lt = inputs[idx];
+        if (!ltw(lt).is_strided()) return false;
+        if (axis < 0 || lt.dims[axis] == 1) return slice_axis_[idx] < 0;
+        if (N_ % lt.dims[axis] != 0) return false;
+        if (slice_axis_[idx] >= 0 && slice_axis_[idx] != axis) return false;
+
+        // Quantization parameters are passed as dense buffers and sub-byte
+        // data can't be addressed by columns, so their slices are to be
+        // contiguous.
+        bool is_contiguous = true;
+        for (int d = 0; d < axis; d++)
+            is_contiguous = is_contiguous && lt.dims[d] == 1;
+        const bool is_sub_byte
+                = dnnl::impl::types::data_type_bits(lt.data_type) < 8;
+        if ((is_param || is_sub_byte) && !is_contiguous) return false;
+
+        slice_axis_[idx] = axis;
+        slice_grp_[idx] = N_ / lt.dims[axis];
+        return true;
+    };
+
+    if (!val->has_producer()) return set_axis(val, w_axis, false);
+
+    // The weights are dequantized from the partition inputs. The scales and
+    // zero points have the dimensions of the weights, or a single one for
+    // per-channel quantization.
+    const op_t &deq = val->get_producer();
+    if (!dnnl::impl::utils::one_of(deq.get_kind(), graph::op_kind::Dequantize,
+                graph::op_kind::DynamicDequantize))
+        return false;
+    const int w_ndims = ltw(val->get_logical_tensor()).ndims();
+    const std::string qtype = deq.has_attr(op_attr::qtype)
+            ? deq.get_attr<std::string>(op_attr::qtype)
+            : "per_tensor";
+    int64_t q_axis = deq.has_attr(op_attr::axis)
+            ? deq.get_attr<int64_t>(op_attr::axis)
+            : 1;
+    if (q_axis < 0) q_axis += w_ndims;
+
+    if (!set_axis(deq.get_input_value(0).get(), w_axis, false)) return false;
+    for (size_t i = 1; i < deq.num_inputs(); i++) {
+        const value_t *param = deq.get_input_value(i).get();
+        const int ndims = ltw(param->get_logical_tensor()).ndims();
+        int axis = -1;
+        if (ndims == w_ndims)
+            axis = w_axis;
+        else if (ndims == 1 && qtype == "per_channel" && q_axis == w_axis)
+            axis = 0;
+        else if (ndims != 1)
+            return false;
+        if (!set_axis(param, axis, true)) return false;
+    }
+    return true;
+}
+
+status_t gated_mlp_decomp_kernel_t::compile_blocks(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const logical_tensor_t &dst, dim_t m_blk, dim_t n_blk) {
+    m_blk_ = m_blk;
+    nm_ = dnnl::impl::utils::div_up(M_, m_blk);
+    n_blk_ = n_blk;
+    ns_ = dnnl::impl::utils::div_up(N_, n_blk);
+    if (ns_ == 1) {
+        slice_axis_.assign(inputs.size(), -1);
+        slice_grp_.assign(inputs.size(), 1);
+    }
+
+    // The slices start at whole groups and bytes.
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (slice_axis_[i] < 0) continue;
+        if (n_blk % slice_grp_[i] != 0) return status::unimplemented;
+        const dim_t off = n_blk / slice_grp_[i]
+                * inputs[i].layout.strides[slice_axis_[i]];
+        if (off * dnnl::impl::types::data_type_bits(inputs[i].data_type) % 8)
+            return status::unimplemented;
+    }
+
+    const logical_tensor_t &src = inputs[src_idx_];
+    const dim_t m_tail = M_ % m_blk, n_tail = N_ % n_blk;
+    for (int mi = 0; mi < 2; mi++) {
+        for (int ni = 0; ni < 2; ni++) {
+            auto &kernel = kernels_[mi][ni];
+            kernel.reset();
+            const dim_t rows = mi ? m_tail : m_blk;
+            const dim_t cols = ni ? n_tail : n_blk;
+            if (rows == 0 || cols == 0) continue;
+
+            std::vector<logical_tensor_t> ins = inputs;
+            ins[src_idx_] = make_rows_lt(src, rows);
+            for (size_t i = 0; i < ins.size(); i++) {
+                if (slice_axis_[i] < 0) continue;
+                ins[i].dims[slice_axis_[i]] = cols / slice_grp_[i];
+            }
+            // The slices write partial destinations which are summed in
+            // f32.
+            logical_tensor_t block_dst = make_rows_lt(dst, rows);
+            if (ns_ > 1) block_dst.data_type = graph::data_type::f32;
+
+            std::vector<logical_tensor_t> outs {block_dst};
+            kernel = std::make_shared<gated_mlp_block_kernel_t>();
+            CHECK(kernel->compile(part, g_engine, ins, outs));
+            // Reordering the weights for each block would cost more than
+            // computing them with the whole partition.
+            if (kernel->has_runtime_reorder()) return status::unimplemented;
+            block_ins_[mi][ni] = ins;
+            block_dst_[mi][ni] = outs[0];
+        }
+    }
+    return status::success;
+}
+
+status_t gated_mlp_decomp_kernel_t::compile_impl(
+        const dnnl_partition_impl_t *part, const engine_t *g_engine,
+        const std::vector<logical_tensor_t> &inputs,
+        const std::vector<logical_tensor_t> &outputs) {
+    p_engine_ = make_dnnl_engine(*g_engine);
+    g_alloc_
+            = reinterpret_cast<graph::allocator_t *>(g_engine->get_allocator());
+    if (p_engine_.get_kind() != dnnl::engine::kind::cpu || outputs.size() != 1)
+        return status::unimplemented;
+
+    // Infer the shapes on a copy of the partition to check that its rows are
+    // computed independently.
+    subgraph_ = std::make_shared<subgraph_t>(part->get_ops(), p_engine_,
+            part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
+    BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+    BACKEND_DNNL_CHECK(infer_shape(subgraph_));
+
+    // The down matmul writes the destination and the gate and up matmuls
+    // read the source, their weights being possibly dequantized. All the
+    // weights are 2D, so that the rows of the source are the rows of each
+    // matmul.
+    const logical_tensor_t &dst = subgraph_->outs_[0];
+    std::vector<op_t *> src_mms;
+    op_t *down_mm = nullptr;
+    for (const auto &op : subgraph_->get_ops()) {
+        if (op->get_kind() != graph::op_kind::MatMul) continue;
+        if (op->has_attr(op_attr::transpose_a)
+                && op->get_attr<bool>(op_attr::transpose_a))
+            return status::unimplemented;
+        if (ltw(op->get_input_value(1)->get_logical_tensor()).ndims() != 2)
+            return status::unimplemented;
+        if (op->get_output_value(0)->get_logical_tensor().id == dst.id)
+            down_mm = op.get();
+        else
+            src_mms.emplace_back(op.get());
+    }
+    if (src_mms.size() != 2 || !down_mm) return status::unimplemented;
+
+    const value_t *src_val = src_mms[0]->get_input_value(0).get();
+    const logical_tensor_t src = src_val->get_logical_tensor();
+    const logical_tensor_t inter
+            = src_mms[0]->get_output_value(0)->get_logical_tensor();
+    if (src_val->has_producer()
+            || src_mms[1]->get_input_value(0)->get_logical_tensor().id
+                    != src.id)
+        return status::unimplemented;
+
+    // Blocks of rows are contiguous in dense row-major tensors only. A
+    // destination with any layout is given the row-major one.
+    logical_tensor_t dst_given = outputs[0];
+    if (ltw(dst_given).is_any()) {
+        dst_given = dst;
+        dst_given.layout_type = layout_type::strided;
+        const dims strides = get_dense_strides(ltw(dst).vdims());
+        dnnl::impl::utils::array_copy(
+                dst_given.layout.strides, strides.data(), strides.size());
+    }
+    if (!is_dense_row_major(src) || !is_dense_row_major(dst_given)
+            || ltw(src).has_zero_dim())
+        return status::unimplemented;
+
+    src_idx_ = inputs.size();
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (inputs[i].id == src.id) src_idx_ = i;
+    }
+    if (src_idx_ == inputs.size()) return status::unimplemented;
+
+    M_ = ltw(src).nelems() / ltw(src).dims()[ltw(src).ndims() - 1];
+    if (M_ != ltw(dst).nelems() / ltw(dst).dims()[ltw(dst).ndims() - 1])
+        return status::unimplemented;
+    N_ = ltw(inter).dims()[ltw(inter).ndims() - 1];
+    dst_cols_ = ltw(dst).dims()[ltw(dst).ndims() - 1];
+    dst_dt_ = dst.data_type;
+    src_row_size_ = ltw(src).size() / M_;
+    dst_row_size_ = ltw(dst).size() / M_;
+
+    // Find how the inputs are sliced along the intermediate dimension. The
+    // bias of the down matmul would be added by each slice.
+    slice_axis_.assign(inputs.size(), -1);
+    slice_grp_.assign(inputs.size(), 1);
+    bool can_slice = down_mm->num_inputs() < 3;
+    for (op_t *mm : {src_mms[0], src_mms[1], down_mm}) {
+        const bool transpose_b = mm->has_attr(op_attr::transpose_b)
+                && mm->get_attr<bool>(op_attr::transpose_b);
+        const bool is_down = mm == down_mm;
+        const int w_axis = (transpose_b != is_down) ? 0 : 1;
+        can_slice = can_slice
+                && init_slicing(inputs, mm->get_input_value(1).get(), w_axis);
+        if (!is_down && mm->num_inputs() > 2) {
+            const value_t *bia = mm->get_input_value(2).get();
+            const int b_axis = ltw(bia->get_logical_tensor()).ndims() - 1;
+            can_slice = can_slice && init_slicing(inputs, bia, b_axis);
+        }
+    }
+
+    nthr_ = dnnl_get_max_threads();
+    const size_t l2_size = cpu::platform::get_per_core_cache_size(2);
+    auto get_m_blk = [&](dim_t n_blk, dim_t nm) {
+        // The gate and up outputs of a block are to fit in the L2 cache
+        // together with its source and destination rows.
+        const size_t row_size = src_row_size_ + 2 * n_blk * sizeof(float)
+                + (n_blk < N_ ? dst_cols_ * sizeof(float) : dst_row_size_);
+        dim_t m_blk = std::max<dim_t>(1, l2_size / row_size);
+        m_blk = std::min(m_blk, dnnl::impl::utils::div_up(M_, nm));
+        if (m_blk > min_m_blk)
+            m_blk = dnnl::impl::utils::rnd_dn(m_blk, min_m_blk);
+        return m_blk;
+    };
+
+    status_t status = status::unimplemented;
+    if (can_slice) {
+        dim_t n_align = min_n_blk;
+        size_t wei_size = 0;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (slice_axis_[i] < 0) continue;
+            n_align = math::lcm(n_align, slice_grp_[i]);
+            wei_size += ltw(inputs[i]).size();
+        }
+        // Each thread reads its own slice of the weights. The partial
+        // destinations written and read back by the slices are to cost less
+        // than reading the weights once more.
+        const size_t partial_size = 2 * M_ * dst_cols_ * sizeof(float);
+        dim_t ns = std::min<dim_t>(nthr_, N_ / n_align);
+        ns = std::min<dim_t>(ns, wei_size / partial_size);
+        if (ns > 1) {
+            const dim_t n_blk = dnnl::impl::utils::rnd_up(
+                    dnnl::impl::utils::div_up(N_, ns), n_align);
+            ns = dnnl::impl::utils::div_up(N_, n_blk);
+            const dim_t nm = dnnl::impl::utils::div_up(nthr_, ns);
+            if (ns > 1)
+                status = compile_blocks(part, g_engine, inputs, dst,
+                        get_m_blk(n_blk, nm), n_blk);
+        }
+    }
+
+    // Otherwise, the rows are split over the threads, each block reading all
+    // the weights. It's worth it only with blocks large enough to be compute
+    // bound.
+    if (status != status::success) {
+        const dim_t m_blk = get_m_blk(N_, nthr_);
+        if (m_blk < min_m_blk || M_ < 2 * m_blk) return status::unimplemented;
+        CHECK(compile_blocks(part, g_engine, inputs, dst, m_blk, N_));
+    }
+
+    // fill information for inputs logical tensors
+    for (size_t i = 0; i < inputs.size(); i++) {
+        if (i == src_idx_ || slice_axis_[i] >= 0) continue;
+        auto &in = const_cast<logical_tensor_t &>(inputs[i]);
+        in = block_ins_[0][0][i];
+    }
+
+    // fill information for outputs logical tensors
+    auto &out = const_cast<logical_tensor_t &>(outputs[0]);
+    out = dst_given;
+
+    return status::success;
+}
+
+status_t gated_mlp_decomp_kernel_t::execute_block(const stream_t *g_stream,
+        dim_t mb, dim_t nb, const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs, char *partial) const {
+    const int mi = (mb == nm_ - 1 && M_ % m_blk_ != 0) ? 1 : 0;
+    const int ni = (nb == ns_ - 1 && N_ % n_blk_ != 0) ? 1 : 0;
+    const std::vector<logical_tensor_t> &ins_lt = block_ins_[mi][ni];
+    const dim_t row = mb * m_blk_, col = nb * n_blk_;
+
+    std::vector<tensor_t> ins = inputs;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        char *ptr = static_cast<char *>(inputs[i].get_data_handle());
+        if (i == src_idx_) {
+            ptr += row * src_row_size_;
+        } else if (slice_axis_[i] >= 0) {
+            const logical_tensor_t &lt = ins_lt[i];
+            const dim_t off
+                    = col / slice_grp_[i] * lt.layout.strides[slice_axis_[i]];
+            ptr += off * dnnl::impl::types::data_type_bits(lt.data_type) / 8;
+        } else {
+            continue;
+        }
+        ins[i] = tensor_t(ins_lt[i], inputs[i].get_engine(), ptr);
+    }
+
+    const tensor_t &dst = outputs[0];
+    char *dst_ptr = ns_ > 1
+            ? partial + (nb * M_ + row) * dst_cols_ * sizeof(float)
+            : static_cast<char *>(dst.get_data_handle()) + row * dst_row_size_;
+    std::vector<tensor_t> outs {
+            tensor_t(block_dst_[mi][ni], dst.get_engine(), dst_ptr)};
+
+    return kernels_[mi][ni]->execute_impl(g_stream, ins, outs);
+}
+
+status_t gated_mlp_decomp_kernel_t::execute_impl(const stream_t *g_stream,
+        const std::vector<tensor_t> &inputs,
+        const std::vector<tensor_t> &outputs) {
+    temporary_scratchpad_t scratchpad(
+            ns_ > 1 ? ns_ * M_ * dst_cols_ * sizeof(float) : 0, p_engine_,
+            *g_alloc_);
+    char *partial = scratchpad.get_buffer();
+    if (ns_ > 1 && !partial) return status::out_of_memory;
+
+    // With a single slice, the first block and the tail are executed with
+    // all the threads when the constant cache is enabled, so that the
+    // constant weights are prepared once before the blocks are distributed
+    // over the threads. The blocks are the last ones in the work order.
+    dim_t first = 0, nwork = nm_ * ns_;
+    if (ns_ == 1 && enabled_constant_cache()) {
+        CHECK(execute_block(g_stream, 0, 0, inputs, outputs, partial));
+        first = 1;
+        nwork--;
+        if (M_ % m_blk_ != 0) {
+            CHECK(execute_block(
+                    g_stream, nm_ - 1, 0, inputs, outputs, partial));
+            nwork--;
+        }
+    }
+
+    int nthr = nthr_;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    auto *tp_stream
+            = dnnl::impl::utils::downcast<dnnl::impl::cpu::cpu_stream_t *>(
+                    const_cast<stream_t *>(g_stream));
+    tp_stream->before_exec_hook();
+    dnnl_threadpool_interop_get_max_concurrency(&nthr);
+#endif
+
+    // In the parallel region the primitives of a block use a single thread.
+    // The work is ordered by slices and split in contiguous ranges, so that
+    // a thread runs the blocks of the same slice one after the other and
+    // reuses its weights.
+    std::atomic<status_t> ret {status::success};
+    if (nwork > 0) {
+        parallel(nthr, [&](int ithr, int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(nwork, nthr, ithr, start, end);
+            for (dim_t i = first + start; i < first + end; i++) {
+                if (ret.load() != status::success) return;
+                const status_t st = execute_block(
+                        g_stream, i % nm_, i / nm_, inputs, outputs, partial);
+                if (st != status::success) ret.store(st);
+            }
+        });
+    }
+
+    // Sum the partial destinations of the slices.
+    if (ns_ > 1 && ret.load() == status::success) {
+        float *acc = reinterpret_cast<float *>(partial);
+        void *dst = outputs[0].get_data_handle();
+        const dim_t partial_nelems = M_ * dst_cols_;
+        parallel_nd(M_, [&](dim_t m) {
+            float *acc_row = acc + m * dst_cols_;
+            for (dim_t s = 1; s < ns_; s++) {
+                const float *row = acc_row + s * partial_nelems;
+                for (dim_t k = 0; k < dst_cols_; k++)
+                    acc_row[k] += row[k];
+            }
+            for (dim_t k = 0; k < dst_cols_; k++)
+                cpu::io::store_float_value(
+                        dst_dt_, acc_row[k], dst, m * dst_cols_ + k);
+        });
+    }
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+    tp_stream->after_exec_hook();
+#endif
+    return ret.load();
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_GATED_MLP_DECOMP_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graph/backend/dnnl/kernels/kernel_base.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Compiles a gated MLP partition for a block of rows of its source and
+// destination. The shapes of the internal tensors are inferred again from the
+// given inputs.
+class gated_mlp_block_kernel_t : public larger_partition_kernel_t {
+public:
+    // Returns true if a reorder is executed on every execution, e.g. for the
+    // weights when they can't be cached as constants.
+    bool has_runtime_reorder() const;
+
+    DEF_KERNEL_METHOD_STR(gated_mlp_block_kernel_t)
+
+protected:
+    status_t prepare_subgraph(std::shared_ptr<subgraph_t> &sg) override;
+};
+
+// Computes a gated MLP partition by blocks. The intermediate dimension, i.e.
+// the columns of the gate and up weights and the rows of the down weights, is
+// split into slices, so that each thread reads its own share of the weights
+// instead of all the weights, and the rows of the source and the destination
+// are split into blocks, so that the intermediate tensors of a block stay in
+// the core's cache. A block runs the gate and up matmuls, with the activation
+// and the binary operation fused as post-ops of the gate matmul, followed by
+// the down matmul, and runs single-threaded. With several slices, the down
+// matmul of each slice writes a partial f32 destination and the partial
+// destinations are summed at the end.
+class gated_mlp_decomp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    // Kernels indexed by whether the block is the tail of the rows and
+    // whether the slice is the tail of the intermediate dimension.
+    std::shared_ptr<gated_mlp_block_kernel_t> kernels_[2][2];
+    // Inputs and destination of the kernels.
+    std::vector<logical_tensor_t> block_ins_[2][2];
+    logical_tensor_t block_dst_[2][2];
+
+    // Index of the source in the partition inputs.
+    size_t src_idx_ = 0;
+    size_t src_row_size_ = 0, dst_row_size_ = 0;
+
+    // Axis of each partition input along the intermediate dimension, -1 if
+    // the input isn't sliced, and the number of intermediate columns per
+    // element along this axis, e.g. the group size of grouped scales.
+    std::vector<int> slice_axis_;
+    std::vector<dim_t> slice_grp_;
+
+    dim_t M_ = 0, N_ = 0, dst_cols_ = 0;
+    dim_t m_blk_ = 0, nm_ = 0, n_blk_ = 0, ns_ = 0;
+    data_type_t dst_dt_ = graph::data_type::undef;
+    // Number of threads the partition was split for.
+    int nthr_ = 1;
+
+public:
+    gated_mlp_decomp_kernel_t() = default;
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override;
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override;
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(sycl_deps);
+        UNUSED(sycl_event);
+        return status::unimplemented;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    status_t ocl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<cl_event> &cl_deps,
+            cl_event *ret_event) override {
+        UNUSED(g_stream);
+        UNUSED(inputs);
+        UNUSED(outputs);
+        UNUSED(cl_deps);
+        UNUSED(ret_event);
+        return status::unimplemented;
+    }
+#endif
+
+    status_t reset_engine(const engine_t *g_engine) override {
+        for (auto &kernels : kernels_) {
+            for (auto &kernel : kernels) {
+                if (kernel) CHECK(kernel->reset_engine(g_engine));
+            }
+        }
+        return status::success;
+    }
+
+    DEF_KERNEL_METHOD_STR(gated_mlp_decomp_kernel_t)
+    DNNL_DISALLOW_COPY_AND_ASSIGN(gated_mlp_decomp_kernel_t)
+
+private:
+    // Sets the slicing of the partition inputs feeding the weights `val` of
+    // a matmul, `w_axis` being the axis of the weights along the
+    // intermediate dimension. Returns false if the intermediate dimension
+    // can't be sliced.
+    bool init_slicing(const std::vector<logical_tensor_t> &inputs,
+            const value_t *val, int w_axis);
+
+    // Splits the partition in blocks of `m_blk` rows and slices of `n_blk`
+    // intermediate columns, `n_blk` being `N_` for a single slice, and
+    // compiles the kernels.
+    status_t compile_blocks(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const logical_tensor_t &dst, dim_t m_blk, dim_t n_blk);
+
+    // Executes the partition on the rows of block `mb` and the intermediate
+    // columns of slice `nb`. The destination of a slice is written to
+    // `partial` when there are several slices.
+    status_t execute_block(const stream_t *g_stream, dim_t mb, dim_t nb,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, char *partial) const;
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,11 +14,19 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <mutex>
+
+#include "common/dnnl_thread.hpp"
+
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
 #include "graph/backend/dnnl/passes/constant_propagation.hpp"
 #include "graph/backend/dnnl/passes/insert_ops.hpp"
+#include "graph/backend/dnnl/passes/layout_assignment.hpp"
 #include "graph/backend/dnnl/passes/layout_propagation.hpp"
 #include "graph/backend/dnnl/passes/lower.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
@@ -32,6 +40,44 @@ namespace impl {
 namespace graph {
 namespace dnnl_impl {
 
+namespace {
+
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_TBB
+// The primitives of a concurrent stage run single-threaded unless TBB is
+// used, which pays off only for executables too small to keep all the threads
+// busy. Larger executables are moved to stages of their own.
+std::vector<std::vector<size_t>> split_large_execs(
+        const std::vector<std::vector<size_t>> &stages,
+        const std::vector<exec_args> &args, int nthr) {
+    // Minimal number of destination elements per thread for an executable to
+    // use all the threads.
+    const dim_t min_dst_nelems_per_thr = 1024;
+    const auto is_small = [&](size_t i) {
+        const auto it = args[i].find(DNNL_ARG_DST);
+        if (it == args[i].end()) return false;
+        const auto dims = it->second.get_desc().get_dims();
+        const dim_t nelems = std::accumulate(dims.begin(), dims.end(),
+                dim_t(1), std::multiplies<dim_t>());
+        return nelems < nthr * min_dst_nelems_per_thr;
+    };
+
+    std::vector<std::vector<size_t>> ret;
+    for (const auto &stage : stages) {
+        std::vector<size_t> small;
+        for (size_t i : stage) {
+            if (is_small(i))
+                small.push_back(i);
+            else
+                ret.push_back({i});
+        }
+        if (!small.empty()) ret.push_back(std::move(small));
+    }
+    return ret;
+}
+#endif
+
+} // namespace
+
 void larger_partition_kernel_t::setup_pipeline_stage1(
         pass_pipeline_t &pipeline) {
     // Directly lower down (1 to 1 mapping)
@@ -144,6 +190,7 @@ void larger_partition_kernel_t::setup_pipeline_stage2(pass_pipeline_t &pipeline,
     BACKEND_DNNL_ADD_PASS(pipeline, infer_shape);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_src_transpose_to_matmul);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_dst_transpose_to_predecessor);
+    BACKEND_DNNL_ADD_PASS(pipeline, layout_assignment);
     BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
     BACKEND_DNNL_ADD_PASS(pipeline, common_reorder_elimination);
     BACKEND_DNNL_ADD_PASS(pipeline, fuse_adjacent_reorders);
@@ -211,6 +258,7 @@ status_t larger_partition_kernel_t::compile_impl(
     subgraph_ = std::make_shared<subgraph_t>(part->get_ops(), p_engine_,
             part->get_fpmath_mode(), part->get_use_blocked_layout(), true);
     BACKEND_DNNL_CHECK(set_given_inputs_outputs(subgraph_, inputs, outputs));
+    BACKEND_DNNL_CHECK(prepare_subgraph(subgraph_));
 
     // Populate the transform passes into the pipeline
     // Note: `std::call_once` should be kept in a single translation unit since
@@ -245,6 +293,24 @@ status_t larger_partition_kernel_t::compile_impl(
     const_md_hash_ = generate_constant_md_hash(part->id(),
             memory_planner_.get_exec_args_set().get_persistent_mem_desc_list());
 
+    // Independent executables are run concurrently only when requested, as
+    // they compete for the threads otherwise used by each primitive.
+    exec_stages_.clear();
+    const int nthr = dnnl_get_max_threads();
+    if (p_engine_.get_kind() == dnnl::engine::kind::cpu
+            && getenv_int_user("GRAPH_INTER_OP_PARALLELISM", 0) > 0
+            && nthr > 1) {
+        auto stages = memory_planner_.get_exec_stages(subgraph_);
+#if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_TBB
+        stages = split_large_execs(stages,
+                memory_planner_.get_exec_args_set().get_exec_args(), nthr);
+#endif
+        const bool has_concurrent_execs = std::any_of(stages.begin(),
+                stages.end(),
+                [](const std::vector<size_t> &s) { return s.size() > 1; });
+        if (has_concurrent_execs) exec_stages_ = std::move(stages);
+    }
+
     return status::success;
 }
 
@@ -273,7 +339,9 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
         std::promise<constant_tensor_cache_t::cached_t> c_promise;
         constant_tensor_cache_t::value_t cached_value
                 = dnnl_constant_cache_get_or_add(p_engine_, encoded_key,
-                        memory_planner_.total_internal_persistent_size(),
+                        dnnl_constant_cache_footprint(p_engine_,
+                                memory_planner_
+                                        .total_internal_persistent_size()),
                         c_promise.get_future());
         bool is_from_cache = cached_value.valid();
         if (is_from_cache) {
@@ -300,11 +368,18 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
                 subgraph_->execs_[i]->execute(
                         p_stream, res->get_exec_args()[i]);
             }
+            dnnl_constant_buffer_replicate(p_engine_, c_buffer);
 
             c_promise.set_value(c_buffer);
         }
     }
 
+    if (!exec_stages_.empty()) {
+        for (const auto &stage : exec_stages_)
+            execute_stage(p_stream, res, stage);
+        return status::success;
+    }
+
     for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
         if (subgraph_->is_constant_[i]) continue;
         subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
@@ -313,6 +388,49 @@ status_t larger_partition_kernel_t::execute_impl(const stream_t *g_stream,
     return status::success;
 }
 
+void larger_partition_kernel_t::execute_stage(const dnnl::stream &p_stream,
+        const execution_args_set_t *res, const std::vector<size_t> &stage) {
+    auto execute_one = [&](size_t i) {
+        subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+    };
+
+    const int nexecs = static_cast<int>(stage.size());
+    if (nexecs == 1) {
+        execute_one(stage[0]);
+        return;
+    }
+
+    // The executables of a stage are distributed over the threads. With TBB
+    // each of them runs in its own arena with an explicit share of the
+    // threads. Other runtimes execute the nested parallel regions of the
+    // primitives on the calling thread, so each executable runs
+    // single-threaded: such stages only hold small executables.
+    std::exception_ptr eptr;
+    std::mutex eptr_mutex;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+    const int max_nthr = dnnl_get_max_threads();
+#endif
+    parallel(nexecs, [&](int ithr, int nthr) {
+        for (int i = ithr; i < nexecs; i += nthr) {
+            try {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+                // The first `max_nthr % nthr` executables get an extra thread.
+                const int exec_nthr
+                        = max_nthr / nthr + (ithr < max_nthr % nthr);
+                tbb::task_arena arena(std::max(1, exec_nthr));
+                arena.execute([&] { execute_one(stage[i]); });
+#else
+                execute_one(stage[i]);
+#endif
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(eptr_mutex);
+                if (!eptr) eptr = std::current_exception();
+            }
+        }
+    });
+    if (eptr) std::rethrow_exception(eptr);
+}
+
 #ifdef DNNL_WITH_SYCL
 status_t larger_partition_kernel_t::sycl_execute_impl(const stream_t *g_stream,
         const std::vector<tensor_t> &inputs,
@@ -49,10 +49,21 @@ protected:
 
     size_t const_md_hash_ = 0;
 
+    // Stages of executables which can run concurrently on a CPU engine, empty
+    // if the executables are executed one by one.
+    std::vector<std::vector<size_t>> exec_stages_;
+
     std::once_flag once_flag_;
     subgraph_visualizer_t vis_;
     pass_pipeline_t pipeline_;
 
+    // Called on the subgraph once the given inputs and outputs are set and
+    // before the passes run.
+    virtual status_t prepare_subgraph(std::shared_ptr<subgraph_t> &sg) {
+        UNUSED(sg);
+        return status::success;
+    }
+
 public:
     larger_partition_kernel_t() {
         thread_local_cache_t<execution_args_set_t> res_cache;
@@ -90,6 +101,13 @@ public:
             const std::vector<tensor_t> &inputs,
             const std::vector<tensor_t> &outputs) override;
 
+    void execute_stage(const dnnl::stream &p_stream,
+            const execution_args_set_t *res, const std::vector<size_t> &stage);
+
+    const std::vector<std::vector<size_t>> &get_exec_stages() const {
+        return exec_stages_;
+    }
+
 #ifdef DNNL_WITH_SYCL
     status_t sycl_execute_impl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -267,7 +267,8 @@ status_t mqa_decomp_kernel_t<quantized, dt>::execute_impl(
     omp_set_num_threads(mqa_cfg_.nthr);
 #endif
 
-    parallel_nd_ext(mqa_cfg_.nthr, MBO, MBI, loop);
+    // Work stealing keeps the fast cores of hybrid CPUs busy.
+    parallel_nd_dynamic_ext(mqa_cfg_.nthr, MBO, MBI, loop);
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     tp_stream->after_exec_hook();
@@ -55,6 +55,9 @@ public:
         bool enable_ukernel = false;
 
         if (ekind == engine_kind::cpu) {
+            // The primitive based kernel relies on the CPU sdpa primitive
+            // which doesn't support quantized K and V yet.
+            enable_ukernel = !quantized && !force_primitive();
             enable_decomp = enable_decomp_kernel();
         } else if (ekind == engine_kind::gpu) {
             enable_ukernel = !force_primitive();
@@ -102,7 +105,7 @@ public:
     }
 
     // An internal env var is provided to force using primitive based SDPA
-    // implementation and skipping ukernel based optimization on GPU or
+    // implementation and skipping ukernel based optimization or
     // decomposition based optimization on CPU. Currently it's for oneDNN debug
     // and testing only.
     bool force_primitive() const {
@@ -391,7 +391,8 @@ status_t sdp_decomp_kernel_t<quantized, dt>::execute_impl(
     tp_stream->before_exec_hook();
 #endif
 
-    parallel_nd_ext(sdp_cfg_.nthr, MBO, MBI, loop);
+    // Work stealing keeps the fast cores of hybrid CPUs busy.
+    parallel_nd_dynamic_ext(sdp_cfg_.nthr, MBO, MBI, loop);
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     tp_stream->after_exec_hook();
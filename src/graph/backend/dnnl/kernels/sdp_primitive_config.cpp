@@ -59,10 +59,20 @@ status_t sdp_primitive_config_t::initial_check(
                 status::unimplemented, "Not support quantized SDPA");
         if (opk == graph::op_kind::GenIndex) { has_genindex = true; }
     }
-    if (is_f32 && !has_genindex) {
+    const bool is_cpu = sg->get_engine_kind() == graph::engine_kind::cpu;
+    if (is_f32 && !has_genindex && !is_cpu) {
         VCHECK_SDP_PRIMITIVE(false, status::unimplemented,
                 "only implicit causal mask for f32 sdpa");
     }
+    // GQA reshapes are only folded into sdpa on GPU, see
+    // fuse_reshape_for_gqa_gpu.
+    if (is_cpu) {
+        for (size_t i = 0; i < 3; i++) {
+            VCHECK_SDP_PRIMITIVE(ltw(inputs[i]).ndims() == 4,
+                    status::unimplemented,
+                    "only 4D query, key and value are supported on cpu");
+        }
+    }
 
     // step1(pattern check): Not support sdpa variants with select as mask
     // We already have a pattern matcher to ensure that the sdpa patterns
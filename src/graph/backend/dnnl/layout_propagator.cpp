@@ -572,6 +572,58 @@ status_t layout_propagator_for_matmul(op_ptr &op, const dnnl::engine &p_engine,
     return status;
 }
 
+status_t layout_propagator_for_grouped_matmul(op_ptr &op,
+        const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+        const fpmath_t &fpmath, bool use_block_layout,
+        subgraph_rewriter_t &rewriter) {
+    status_t status = status::success;
+    const auto &pd = grouped_matmul_executable_t::create_desc(
+            op, p_engine, pd_cache, fpmath, use_block_layout);
+
+    insert_reorder_before(op, 0, pd.src_desc(), p_engine, pd_cache, fpmath,
+            use_block_layout, rewriter);
+    value_ptr src = op->get_input_value(0);
+    status = fill_layout_info(src, pd.src_desc());
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for reorder before grouped matmul "
+            "src");
+
+    insert_reorder_before(op, 1, pd.weights_desc(), p_engine, pd_cache, fpmath,
+            use_block_layout, rewriter);
+    value_ptr wei = op->get_input_value(1);
+    status = fill_layout_info(wei, pd.weights_desc());
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for reorder before grouped matmul "
+            "weights");
+
+    value_ptr offsets = op->get_input_value(2);
+    status = fill_layout_info(offsets, pd.group_offsets_desc());
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for grouped matmul group offsets");
+
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        insert_reorder_before(op, 3, pd.bias_desc(), p_engine, pd_cache, fpmath,
+                use_block_layout, rewriter);
+        value_ptr bias = op->get_input_value(3);
+        status = fill_layout_info(bias, pd.bias_desc());
+        VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+                "failed to fill layout info for reorder before grouped matmul "
+                "bias");
+    }
+
+    insert_reorder_after(op, 0, pd.dst_desc(), p_engine, pd_cache, fpmath,
+            use_block_layout, rewriter);
+    value_ptr dst = op->get_output_value(0);
+    status = fill_layout_info(dst, pd.dst_desc());
+    VCHECK_LAYOUT_PROPAGATOR(status == status::success, status,
+            "failed to fill layout info for reorder after grouped matmul dst");
+
+    value_ptr scratchpad_val = op->get_output_value(1);
+    status = fill_layout_info(scratchpad_val, pd.scratchpad_desc());
+    return status;
+}
+
 status_t layout_propagator_for_pool(op_ptr &op, const dnnl::engine &p_engine,
         pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout,
         subgraph_rewriter_t &rewriter) {
@@ -1750,9 +1802,6 @@ status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
         const dnnl::engine &p_engine, pd_cache_t &pd_cache,
         const fpmath_t &fpmath, bool use_block_layout,
         subgraph_rewriter_t &rewriter) {
-    UNUSED(p_engine);
-    UNUSED(pd_cache);
-    UNUSED(fpmath);
     UNUSED(use_block_layout);
     UNUSED(rewriter);
 
@@ -1796,9 +1845,20 @@ status_t layout_propagator_for_sdpa(std::shared_ptr<op_t> &op,
     }
     status_t status = fill_layout_info(dst_val, expected_md);
 
-    // fill scratchpads dimensions and data type to scratchpad value_t
+    if (status != status::success) return status;
+
+    // fill scratchpads dimensions and data type to scratchpad value_t. The
+    // primitive descriptor can't be created for unsupported cases, an empty
+    // scratchpad is kept for them and the failure is reported in compile_ops.
+    memory::desc scratchpad_desc;
+    const auto pd = sdpa_executable_t::create_desc(
+            op, p_engine, pd_cache, fpmath);
+    if (pd) {
+        dnnl_memory_desc_t cloned_md = nullptr;
+        CHECK(dnnl_memory_desc_clone(&cloned_md, pd->scratchpad_md()));
+        scratchpad_desc = memory::desc(cloned_md);
+    }
     value_ptr scratchpad_val = op->get_output_value(1);
-    const memory::desc scratchpad_desc;
     status = fill_layout_info(scratchpad_val, scratchpad_desc);
     return status;
 }
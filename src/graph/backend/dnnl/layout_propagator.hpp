@@ -61,6 +61,7 @@ DECLARE_LAYOUT_PROPAGATOR(binary);
 DECLARE_LAYOUT_PROPAGATOR(concat);
 DECLARE_LAYOUT_PROPAGATOR(shuffle);
 DECLARE_LAYOUT_PROPAGATOR(matmul);
+DECLARE_LAYOUT_PROPAGATOR(grouped_matmul);
 DECLARE_LAYOUT_PROPAGATOR(pool);
 DECLARE_LAYOUT_PROPAGATOR(pool_bwd);
 DECLARE_LAYOUT_PROPAGATOR(batchnorm);
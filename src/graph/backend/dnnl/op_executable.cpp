@@ -89,6 +89,11 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
             : prop_kind::forward_training;
     auto weight = make_dnnl_memory_desc(wei_lt);
     weight = to_format_any(weight);
+    // The constant weights are read from the copy of the NUMA node of each
+    // thread.
+    if (logical_tensor_wrapper_t(wei_lt).is_constant()
+            && is_weights_replication_enabled(p_engine))
+        prm_attr.set_weights_replication(true);
 
     auto base_conv_dst_lt = op->get_output_value(0)->get_logical_tensor();
     if (fusion_info.has_post_dw_conv()) {
@@ -118,7 +123,11 @@ conv_fwd_executable_t::desc_t conv_fwd_executable_t::create_desc(
         }
     };
 
-    if (!use_block_layout) {
+    // The layout assignment pass may have found that the plain layout is
+    // cheaper for this op once the reorders around it are accounted for.
+    const bool use_plain_layout = op->has_attr(op_attr::use_plain_layout)
+            && op->get_attr<bool>(op_attr::use_plain_layout);
+    if (!use_block_layout || use_plain_layout) {
         src = to_nxc_format(src);
         dst = to_nxc_format(dst);
     } else {
@@ -370,6 +379,10 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
                                 .is_constant()
             && is_constant_cache_enabled(p_engine);
     if (use_block_layout && const_weight) { wei = to_format_any(wei); }
+    // The constant weights are read from the copy of the NUMA node of each
+    // thread.
+    if (const_weight && is_weights_replication_enabled(p_engine))
+        prm_attr.set_weights_replication(true);
     auto dst = make_dnnl_memory_desc(
             op->get_output_value(0)->get_logical_tensor());
     const bool keep_dst_layout = op->has_attr(op_attr::keep_dst_layout)
@@ -399,6 +412,63 @@ matmul_executable_t::desc_t matmul_executable_t::create_desc(
     return {pd, false};
 }
 
+grouped_matmul_executable_t::desc_t grouped_matmul_executable_t::create_desc(
+        std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+        pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout) {
+    // first look up the cache
+    if (pd_cache.find(op.get()) != pd_cache.end()) {
+        auto pd = graph::utils::any_cast<dnnl::grouped_matmul::primitive_desc>(
+                pd_cache.at(op.get()));
+        return {pd, true};
+    }
+    dnnl::primitive_attr prm_attr;
+    if (op->has_attr(op_attr::fusion_info)) {
+        const fusion_info_t &fusion_info
+                = op->get_attr<fusion_info_t>(op_attr::fusion_info);
+        prm_attr = make_dnnl_primitive_attr(op, fusion_info);
+    }
+    prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    prm_attr.set_fpmath_mode(
+            static_cast<dnnl::fpmath_mode>(fpmath.mode_), fpmath.apply_to_int_);
+
+    // Activations are always plain, only constant weights may be packed by
+    // the implementation.
+    const auto plain_md = [](const dnnl::memory::desc &md) {
+        return md.get_format_kind() == dnnl::memory::format_kind::any
+                ? to_ncx_format(md)
+                : md;
+    };
+    auto src = plain_md(make_dnnl_memory_desc(
+            op->get_input_value(0)->get_logical_tensor()));
+    auto wei = make_dnnl_memory_desc(
+            op->get_input_value(1)->get_logical_tensor());
+    bool const_weight = logical_tensor_wrapper_t(
+                                op->get_input_value(1)->get_logical_tensor())
+                                .is_constant()
+            && is_constant_cache_enabled(p_engine);
+    if (use_block_layout && const_weight) { wei = to_format_any(wei); }
+    auto offsets = plain_md(make_dnnl_memory_desc(
+            op->get_input_value(2)->get_logical_tensor()));
+    auto dst = plain_md(make_dnnl_memory_desc(
+            op->get_output_value(0)->get_logical_tensor()));
+
+    dnnl::grouped_matmul::primitive_desc pd;
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        auto bias = plain_md(make_dnnl_memory_desc(
+                op->get_input_value(3)->get_logical_tensor()));
+        pd = dnnl::grouped_matmul::primitive_desc(
+                p_engine, src, wei, bias, offsets, dst, prm_attr);
+    } else {
+        pd = dnnl::grouped_matmul::primitive_desc(
+                p_engine, src, wei, offsets, dst, prm_attr);
+    }
+
+    pd_cache.insert({op.get(), pd});
+
+    return {pd, false};
+}
+
 pool_executable_t::desc_t pool_executable_t::create_desc(
         std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
         pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout) {
@@ -1904,6 +1974,28 @@ arg_indices_t matmul_executable_t::get_arg_indices(const op_t *op) {
     return get_arg_indices_for_conv_and_matmul(op);
 }
 
+arg_indices_t grouped_matmul_executable_t::get_arg_indices(const op_t *op) {
+    arg_indices_t arg_indices;
+
+    // add input args
+    size_t index = 0;
+    arg_indices.insert({DNNL_ARG_SRC, indices_t {input, index++}});
+    arg_indices.insert({DNNL_ARG_WEIGHTS, indices_t {input, index++}});
+    arg_indices.insert({DNNL_ARG_GROUP_OFFSETS, indices_t {input, index++}});
+    if (op->has_attr(op_attr::with_bias)
+            && op->get_attr<bool>(op_attr::with_bias)) {
+        arg_indices.insert({DNNL_ARG_BIAS, indices_t {input, index++}});
+    }
+
+    get_arg_indices_for_post_ops(op, arg_indices, index);
+
+    // add output args
+    arg_indices.insert({DNNL_ARG_DST, indices_t {output, 0}});
+    arg_indices.insert({DNNL_ARG_SCRATCHPAD, indices_t {output, 1}});
+
+    return arg_indices;
+}
+
 arg_indices_t binary_executable_t::get_arg_indices(const op_t *op) {
     arg_indices_t arg_indices;
     const algorithm algo = static_cast<dnnl::algorithm>(
@@ -1020,6 +1020,47 @@ private:
     dummy_impl_t dummy_impl_;
 };
 
+struct grouped_matmul_executable_t : public op_executable_t {
+    DECLARE_DESC_CLASS_AND_CREATOR(dnnl::grouped_matmul::primitive_desc);
+    DECLARE_ARG_INDICES_GETTER;
+    DECLARE_RESET_ENGINE(dnnl::grouped_matmul);
+
+    grouped_matmul_executable_t(std::shared_ptr<op_t> &op,
+            const dnnl::engine &p_engine, pd_cache_t &pd_cache,
+            const fpmath_t &fpmath, bool use_block_layout) {
+        auto desc
+                = create_desc(op, p_engine, pd_cache, fpmath, use_block_layout);
+        prim_ = dnnl::grouped_matmul(desc);
+    }
+
+    void execute(const stream &stream,
+            const std::unordered_map<int, memory> &args) const override {
+        prim_.execute(stream, args);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    ::sycl::event execute_sycl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<::sycl::event> &deps) const override {
+        auto e = dnnl::sycl_interop::execute(prim_, stream, args, deps);
+        if (stream.get_engine().get_kind() == engine::kind::cpu) e.wait();
+        return e;
+    }
+#endif
+
+#if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+    cl_event execute_ocl(const stream &stream,
+            const std::unordered_map<int, memory> &args,
+            const std::vector<cl_event> &deps) const override {
+        auto e = dnnl::ocl_interop::execute(prim_, stream, args, deps);
+        return e;
+    }
+#endif
+
+private:
+    dnnl::grouped_matmul prim_;
+};
+
 struct eltwise_executable_t : public op_executable_t {
     DECLARE_DESC_CLASS_AND_CREATOR(dnnl::eltwise_forward::primitive_desc);
     DECLARE_ARG_INDICES_GETTER;
@@ -2922,11 +2963,18 @@ private:
 struct sdpa_executable_t : public op_executable_t {
     DECLARE_ARG_INDICES_GETTER;
 
-    sdpa_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
-            pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout)
-        : with_scale_(op->get_attr<bool>(op_attr::with_scale))
-        , mask_type_(static_cast<attn_mask_type_t>(
-                  op->get_attr<int64_t>(op_attr::mask_type))) {
+    static std::shared_ptr<primitive_desc_t> create_desc(
+            std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            pd_cache_t &pd_cache, const fpmath_t &fpmath) {
+        // first look up the cache
+        if (pd_cache.find(op.get()) != pd_cache.end()) {
+            return graph::utils::any_cast<std::shared_ptr<primitive_desc_t>>(
+                    pd_cache.at(op.get()));
+        }
+
+        const bool with_scale = op->get_attr<bool>(op_attr::with_scale);
+        const auto mask_type = static_cast<attn_mask_type_t>(
+                op->get_attr<int64_t>(op_attr::mask_type));
 
         auto md_q = make_dnnl_memory_desc(
                 op->get_input_value(0)->get_logical_tensor());
@@ -2939,21 +2987,21 @@ struct sdpa_executable_t : public op_executable_t {
 
         auto md_scale = dnnl::memory::desc();
         size_t idx = 3;
-        if (with_scale_)
+        if (with_scale)
             md_scale = make_dnnl_memory_desc(
                     op->get_input_value(idx++)->get_logical_tensor());
 
         dnnl::memory::desc md_mask;
-        with_explicit_mask_ = mask_type_ == attn_mask_type::buffer;
-        if (with_explicit_mask_)
+        if (mask_type == attn_mask_type::buffer)
             md_mask = make_dnnl_memory_desc(
                     op->get_input_value(idx++)->get_logical_tensor());
 
         dnnl::primitive_attr attr, qk_attr, vs_attr;
         attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
         attr.set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath.mode_));
+        bool is_invert_scale = false;
         if (op->has_attr(op_attr::is_invert_scale))
-            is_invert_scale_ = op->get_attr<bool>(op_attr::is_invert_scale);
+            is_invert_scale = op->get_attr<bool>(op_attr::is_invert_scale);
 
         if (op->has_attr(op_attr::fusion_info)) {
             const auto &sdpa_fusion_info
@@ -2979,13 +3027,34 @@ struct sdpa_executable_t : public op_executable_t {
         const alg_kind_t softmax_alg = softmax_mode == "inf_as_zero"
                 ? alg_kind::softmax_accurate_inf_as_zero
                 : alg_kind::softmax_accurate;
-        status_t s = create_sdpa_pd(sdpa_pd_, p_engine.get(), md_q.get(),
+        std::shared_ptr<primitive_desc_t> pd;
+        status_t s = create_sdpa_pd(pd, p_engine.get(), md_q.get(),
                 md_k.get(), md_v.get(), md_dst.get(), md_mask.get(),
-                md_scale.get(), is_invert_scale_, kv_head_number, mask_type_,
+                md_scale.get(), is_invert_scale, kv_head_number, mask_type,
                 softmax_alg, attr.get(), qk_attr.get(), vs_attr.get());
-        if (s != dnnl::impl::status::success) {
+        if (s != status::success) return nullptr;
+
+        pd_cache.insert({op.get(), pd});
+        return pd;
+    }
+
+    sdpa_executable_t(std::shared_ptr<op_t> &op, const dnnl::engine &p_engine,
+            pd_cache_t &pd_cache, const fpmath_t &fpmath, bool use_block_layout)
+        : with_scale_(op->get_attr<bool>(op_attr::with_scale))
+        , mask_type_(static_cast<attn_mask_type_t>(
+                  op->get_attr<int64_t>(op_attr::mask_type))) {
+        with_explicit_mask_ = mask_type_ == attn_mask_type::buffer;
+        is_invert_scale_ = op->has_attr(op_attr::is_invert_scale)
+                && op->get_attr<bool>(op_attr::is_invert_scale);
+
+        sdpa_pd_ = create_desc(op, p_engine, pd_cache, fpmath);
+        is_initialized_ = sdpa_pd_ != nullptr;
+        // The reference CPU implementation is much slower than the
+        // decomposition kernel, let the latter handle such cases.
+        if (is_initialized_ && p_engine.get_kind() == dnnl::engine::kind::cpu
+                && std::string(sdpa_pd_->name()).find("ref") == 0)
             is_initialized_ = false;
-        } else {
+        if (is_initialized_) {
             status_t s = sdpa_pd_->create_primitive(sdpa_prim_, p_engine.get());
             is_initialized_ = s == status::success ? true : false;
         }
@@ -3045,6 +3114,9 @@ struct sdpa_executable_t : public op_executable_t {
                 = mem_arg_k_zero_points;
         exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
                 = mem_arg_v_zero_points;
+        if (args.find(DNNL_ARG_SCRATCHPAD) != args.end())
+            exec_args[DNNL_ARG_SCRATCHPAD]
+                    = {args.at(DNNL_ARG_SCRATCHPAD).get(), false};
 
         exec_ctx_t ctx(stream.get(), std::move(exec_args));
         sdpa_prim_->execute(ctx);
@@ -3105,6 +3177,9 @@ struct sdpa_executable_t : public op_executable_t {
                 = mem_arg_k_zero_points;
         exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
                 = mem_arg_v_zero_points;
+        if (args.find(DNNL_ARG_SCRATCHPAD) != args.end())
+            exec_args[DNNL_ARG_SCRATCHPAD]
+                    = {args.at(DNNL_ARG_SCRATCHPAD).get(), false};
 
         auto strm_t = stream.get();
         exec_ctx_t ctx(strm_t, std::move(exec_args));
@@ -3177,6 +3252,9 @@ struct sdpa_executable_t : public op_executable_t {
                 = mem_arg_k_zero_points;
         exec_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_VALUES]
                 = mem_arg_v_zero_points;
+        if (args.find(DNNL_ARG_SCRATCHPAD) != args.end())
+            exec_args[DNNL_ARG_SCRATCHPAD]
+                    = {args.at(DNNL_ARG_SCRATCHPAD).get(), false};
 
         exec_ctx_t ctx(stream.get(), std::move(exec_args));
 
@@ -0,0 +1,384 @@
+/*******************************************************************************
+ * Copyright 2025 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/value.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/fusion_info.hpp"
+#include "graph/backend/dnnl/internal_attrs.hpp"
+#include "graph/backend/dnnl/internal_ops.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
+#include "graph/backend/dnnl/utils.hpp"
+
+#include "graph/backend/dnnl/passes/layout_assignment.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+using op_ptr = std::shared_ptr<op_t>;
+using ltw = logical_tensor_wrapper_t;
+using perms_t = std::vector<std::vector<int64_t>>;
+
+// Layout labels of a convolution.
+const int preferred = 0;
+const int plain = 1;
+const int num_labels = 2;
+
+// Connected groups of up to this many convolutions are solved exactly.
+const size_t max_exhaustive_nodes = 10;
+const int max_sweeps = 10;
+
+const double infeasible = std::numeric_limits<double>::infinity();
+
+struct candidate_t {
+    bool valid = false;
+    dnnl::convolution_forward::primitive_desc pd;
+    memory::desc src, dst;
+};
+
+struct node_t {
+    op_ptr op;
+    candidate_t cands[num_labels];
+    // Cost of the convolution and of the reorders to the subgraph inputs and
+    // outputs for each label.
+    double cost[num_labels] = {0, 0};
+    int label = preferred;
+    // Edges where the node is the consumer, and all of its edges.
+    std::vector<size_t> in_edges, edges;
+};
+
+struct edge_t {
+    size_t producer, consumer;
+    // Cost of the reorder between the two nodes for each pair of labels.
+    double cost[num_labels][num_labels];
+};
+
+size_t tensor_bytes(const value_t &val) {
+    const auto lt = val.get_logical_tensor();
+    const dim_t nelems = ltw(lt).nelems();
+    return nelems > 0 ? static_cast<size_t>(nelems) * ltw(lt).data_type_size()
+                      : 0;
+}
+
+// Layouts are compared regardless of the data type, and the strides of the
+// dims of size 1 are ignored.
+bool same_layout(const memory::desc &a, const memory::desc &b) {
+    if (a.get_format_kind() != format_kind::blocked
+            || b.get_format_kind() != format_kind::blocked)
+        return false;
+    if (a.get_dims() != b.get_dims()) return false;
+    if (a.get_inner_nblks() != b.get_inner_nblks()
+            || a.get_inner_blks() != b.get_inner_blks()
+            || a.get_inner_idxs() != b.get_inner_idxs())
+        return false;
+
+    const auto &dims = a.get_dims();
+    const auto a_strides = a.get_strides();
+    const auto b_strides = b.get_strides();
+    for (size_t d = 0; d < dims.size(); ++d) {
+        if (dims[d] > 1 && a_strides[d] != b_strides[d]) return false;
+    }
+    return true;
+}
+
+memory::desc apply_perms(const memory::desc &md, const perms_t &perms) {
+    memory::desc ret = md;
+    for (const auto &perm : perms)
+        ret = ret.permute_axes(dnnl_impl::utils::cast_to_int32(perm));
+    return ret;
+}
+
+bool is_layout_preserving(const op_t &op) {
+    return impl::utils::one_of(op.get_kind(), op_kind::dnnl_eltwise,
+            op_kind::dnnl_binary, op_kind::dnnl_permute);
+}
+
+// Walks up from `val` through the ops whose output follows the layout of
+// their first input, and returns the first value not produced by such an op.
+// The permutations met on the way are collected in execution order.
+value_t *trace_up(value_t *val, perms_t &perms) {
+    while (val->has_producer() && is_layout_preserving(val->get_producer())) {
+        op_t &producer = val->get_producer();
+        if (producer.get_kind() == op_kind::dnnl_permute) {
+            perms.insert(perms.begin(),
+                    producer.get_attr<std::vector<int64_t>>(
+                            op_attr::permutation));
+        }
+        val = producer.get_input_value(0).get();
+    }
+    return val;
+}
+
+// Same as trace_up(), downwards through single consumers.
+value_t *trace_down(value_t *val, perms_t &perms) {
+    while (val->get_consumers().size() == 1) {
+        const auto &csm = val->get_consumers()[0];
+        op_t &consumer = csm.get_op();
+        if (csm.get_offset() != 0 || !is_layout_preserving(consumer)) break;
+        if (consumer.get_kind() == op_kind::dnnl_permute) {
+            perms.emplace_back(consumer.get_attr<std::vector<int64_t>>(
+                    op_attr::permutation));
+        }
+        val = consumer.get_output_value(0).get();
+    }
+    return val;
+}
+
+bool is_fixed(const logical_tensor_t &lt) {
+    return !ltw(lt).is_any() && ltw(lt).is_strided();
+}
+
+bool is_ref(const dnnl::convolution_forward::primitive_desc &pd) {
+    return std::strstr(pd.impl_info_str(), "ref") != nullptr;
+}
+
+candidate_t make_candidate(op_ptr &op, bool use_plain_layout,
+        const dnnl::engine &p_engine, const fpmath_t &fpm) {
+    candidate_t cand;
+    pd_cache_t pd_cache;
+    op->set_attr<bool>(op_attr::use_plain_layout, use_plain_layout);
+    try {
+        cand.pd = conv_fwd_executable_t::create_desc(
+                op, p_engine, pd_cache, fpm, true);
+        cand.src = cand.pd.src_desc();
+        cand.dst = cand.pd.dst_desc();
+        cand.valid = true;
+    } catch (...) { cand.valid = false; }
+    op->set_attr<bool>(op_attr::use_plain_layout, false);
+    return cand;
+}
+
+double local_cost(const std::vector<node_t> &nodes,
+        const std::vector<edge_t> &edges, size_t n, int label) {
+    double cost = nodes[n].cost[label];
+    for (size_t e : nodes[n].edges) {
+        const auto &edge = edges[e];
+        if (edge.consumer == n)
+            cost += edge.cost[nodes[edge.producer].label][label];
+        else
+            cost += edge.cost[label][nodes[edge.consumer].label];
+    }
+    return cost;
+}
+
+double total_cost(const std::vector<node_t> &nodes,
+        const std::vector<edge_t> &edges, const std::vector<size_t> &group) {
+    double cost = 0;
+    for (size_t n : group) {
+        cost += nodes[n].cost[nodes[n].label];
+        for (size_t e : nodes[n].in_edges) {
+            const auto &edge = edges[e];
+            cost += edge.cost[nodes[edge.producer].label][nodes[n].label];
+        }
+    }
+    return cost;
+}
+
+void solve_group(std::vector<node_t> &nodes, const std::vector<edge_t> &edges,
+        const std::vector<size_t> &group) {
+    auto set_labels = [&](size_t mask) {
+        for (size_t i = 0; i < group.size(); ++i)
+            nodes[group[i]].label = (mask >> i) & 1 ? plain : preferred;
+    };
+
+    if (group.size() <= max_exhaustive_nodes) {
+        size_t best_mask = 0;
+        double best_cost = total_cost(nodes, edges, group);
+        for (size_t mask = 1; mask < (size_t(1) << group.size()); ++mask) {
+            set_labels(mask);
+            const double cost = total_cost(nodes, edges, group);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_mask = mask;
+            }
+        }
+        set_labels(best_mask);
+        return;
+    }
+
+    // Start from the better of the two uniform assignments and flip single
+    // nodes as long as it lowers the cost.
+    const double preferred_cost = total_cost(nodes, edges, group);
+    for (size_t n : group)
+        nodes[n].label = plain;
+    if (total_cost(nodes, edges, group) >= preferred_cost) {
+        for (size_t n : group)
+            nodes[n].label = preferred;
+    }
+
+    for (int sweep = 0; sweep < max_sweeps; ++sweep) {
+        bool improved = false;
+        for (size_t n : group) {
+            const int cur = nodes[n].label;
+            const int alt = cur == plain ? preferred : plain;
+            if (local_cost(nodes, edges, n, alt)
+                    < local_cost(nodes, edges, n, cur)) {
+                nodes[n].label = alt;
+                improved = true;
+            }
+        }
+        if (!improved) break;
+    }
+}
+
+} // namespace
+
+status_t layout_assignment(std::shared_ptr<subgraph_t> &sg) {
+    // Without blocked layouts, all the convolutions already use nxc.
+    if (!sg->can_use_blocked_layout_) return status::success;
+
+    const auto &p_engine = *(sg->p_engine_);
+    const auto &fpm = sg->get_fpmath_mode();
+
+    std::vector<node_t> nodes;
+    std::unordered_map<op_t *, size_t> node_idx;
+    for (const auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_convolution) continue;
+        if (cur_op->has_attr(op_attr::fusion_info)
+                && cur_op->get_attr<fusion_info_t>(op_attr::fusion_info)
+                           .has_post_dw_conv())
+            continue;
+        if (sg->pd_cache_.count(cur_op.get())) continue;
+
+        node_t node;
+        node.op = cur_op;
+        node.cands[preferred] = make_candidate(node.op, false, p_engine, fpm);
+        // Let the layout propagation report the error.
+        if (!node.cands[preferred].valid) continue;
+        node.cands[plain] = make_candidate(node.op, true, p_engine, fpm);
+
+        auto &pref = node.cands[preferred];
+        auto &pl = node.cands[plain];
+        if (pl.valid && is_ref(pl.pd) && !is_ref(pref.pd)) pl.valid = false;
+        if (pl.valid && same_layout(pl.src, pref.src)
+                && same_layout(pl.dst, pref.dst))
+            pl.valid = false;
+
+        const size_t src_bytes = tensor_bytes(*cur_op->get_input_value(0));
+        const size_t dst_bytes = tensor_bytes(*cur_op->get_output_value(0));
+        if (!pl.valid)
+            node.cost[plain] = infeasible;
+        else if (std::strcmp(pl.pd.impl_info_str(), pref.pd.impl_info_str()))
+            node.cost[plain] = static_cast<double>(src_bytes + dst_bytes);
+
+        // Reorders from the subgraph inputs and to the subgraph outputs.
+        perms_t src_perms, dst_perms;
+        const value_t *src
+                = trace_up(cur_op->get_input_value(0).get(), src_perms);
+        const value_t *dst
+                = trace_down(cur_op->get_output_value(0).get(), dst_perms);
+        const bool fixed_src
+                = !src->has_producer() && is_fixed(src->get_logical_tensor());
+        const bool fixed_dst = dst->get_consumers().empty()
+                && is_fixed(dst->get_logical_tensor());
+        for (int l = 0; l < num_labels; ++l) {
+            if (!node.cands[l].valid) continue;
+            if (fixed_src) {
+                const auto md = apply_perms(
+                        make_dnnl_memory_desc(src->get_logical_tensor()),
+                        src_perms);
+                if (!same_layout(md, node.cands[l].src))
+                    node.cost[l] += 2.0 * src_bytes;
+            }
+            if (fixed_dst) {
+                const auto md = apply_perms(node.cands[l].dst, dst_perms);
+                if (!same_layout(md,
+                            make_dnnl_memory_desc(dst->get_logical_tensor())))
+                    node.cost[l] += 2.0 * dst_bytes;
+            }
+        }
+
+        node_idx[cur_op.get()] = nodes.size();
+        nodes.emplace_back(std::move(node));
+    }
+    if (nodes.empty()) return status::success;
+
+    // Reorders between the convolutions.
+    std::vector<edge_t> edges;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        perms_t perms;
+        const value_t *src
+                = trace_up(nodes[n].op->get_input_value(0).get(), perms);
+        if (!src->has_producer()) continue;
+        const auto it = node_idx.find(&src->get_producer());
+        if (it == node_idx.end() || it->second == n) continue;
+
+        edge_t edge;
+        edge.producer = it->second;
+        edge.consumer = n;
+        const double bytes
+                = 2.0 * tensor_bytes(*nodes[n].op->get_input_value(0));
+        for (int lp = 0; lp < num_labels; ++lp) {
+            for (int lc = 0; lc < num_labels; ++lc) {
+                const auto &prod = nodes[edge.producer].cands[lp];
+                const auto &cons = nodes[n].cands[lc];
+                edge.cost[lp][lc] = 0;
+                if (!prod.valid || !cons.valid) continue;
+                if (!same_layout(apply_perms(prod.dst, perms), cons.src))
+                    edge.cost[lp][lc] = bytes;
+            }
+        }
+        nodes[edge.producer].edges.push_back(edges.size());
+        nodes[n].edges.push_back(edges.size());
+        nodes[n].in_edges.push_back(edges.size());
+        edges.push_back(edge);
+    }
+
+    // Solve each connected group of convolutions separately.
+    std::vector<bool> visited(nodes.size(), false);
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        if (visited[n]) continue;
+        std::vector<size_t> group {n};
+        visited[n] = true;
+        for (size_t i = 0; i < group.size(); ++i) {
+            for (size_t e : nodes[group[i]].edges) {
+                for (size_t m : {edges[e].producer, edges[e].consumer}) {
+                    if (visited[m]) continue;
+                    visited[m] = true;
+                    group.push_back(m);
+                }
+            }
+        }
+        solve_group(nodes, edges, group);
+    }
+
+    for (auto &node : nodes) {
+        if (node.label == plain)
+            node.op->set_attr<bool>(op_attr::use_plain_layout, true);
+        // The layout propagation creates the same primitive descriptor.
+        sg->pd_cache_.insert({node.op.get(), node.cands[node.label].pd});
+    }
+
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * Copyright 2025 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+#ifndef GRAPH_BACKEND_DNNL_PASSES_LAYOUT_ASSIGNMENT_HPP
+#define GRAPH_BACKEND_DNNL_PASSES_LAYOUT_ASSIGNMENT_HPP
+
+#include <memory>
+
+#include "graph/interface/c_types_map.hpp"
+
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+/// Chooses the layouts of the convolutions in the subgraph so that the total
+/// estimated cost of the reorders between them, and to the subgraph inputs
+/// and outputs, plus the cost of using a less efficient implementation, is
+/// minimal.
+///
+/// Each convolution can either use the layout preferred by the primitive,
+/// which is what the layout propagation picks for it alone, or the plain nxc
+/// layout for its src and dst. A reorder costs twice the bytes of the tensor,
+/// and a convolution using the plain layout through a different
+/// implementation than the preferred one costs the bytes of its src and dst.
+/// Connected groups of convolutions are solved exactly when they are small,
+/// and by local improvements of single convolutions otherwise.
+///
+/// The chosen layout is recorded in the op_attr::use_plain_layout attribute,
+/// which is then honored by the layout propagation.
+status_t layout_assignment(std::shared_ptr<subgraph_t> &sg);
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -925,6 +925,7 @@ static status_t gen_index_handler(
 static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // matmul
         ITEM(MatMul, common_handler<op_kind::kDnnl_matmul>),
+        ITEM(GroupedMatMul, common_handler<op_kind::kDnnl_grouped_matmul>),
         // conv
         ITEM(Convolution, common_handler<op_kind::kDnnl_convolution>),
         ITEM(ConvolutionBackwardData,
@@ -15,6 +15,7 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <set>
 #include <vector>
@@ -72,11 +73,14 @@ std::vector<op_inplace_pair_t> get_op_inplace_pairs(op_t &op) {
         size_t index = 1;
         if (op.get_kind() == op_kind::dnnl_convolution
                 || op.get_kind() == op_kind::dnnl_matmul
+                || op.get_kind() == op_kind::dnnl_grouped_matmul
                 || op.get_kind() == op_kind::dnnl_convtranspose) {
             index = op.has_attr(op_attr::with_bias)
                             && op.get_attr<bool>(op_attr::with_bias)
                     ? 3 // src, wei, bias
                     : 2; // src, wei
+            // group offsets
+            if (op.get_kind() == op_kind::dnnl_grouped_matmul) index += 1;
             if (fusion_info.with_runtime_scales(true, 0)) { index += 1; }
             if (fusion_info.with_runtime_scales(true, 1)) { index += 1; }
             if (fusion_info.with_runtime_zero_points(true, 0)) { index += 1; }
@@ -847,6 +851,133 @@ status_t memory_planner_t::prepare_execution_args_set(
 // - Assign internal allocated temporary buffer to corresponding edges.
 // - Assign internal allocated persistent buffer to corresponding edges.
 // - Prepare the memory objects which will be used in execution.
+namespace {
+// Returns true if a primitive never writes the memory passed as `arg`.
+bool is_read_only_arg(int arg) {
+    // Quantization parameters and arguments of the post-ops
+    if (arg >= DNNL_ARG_ATTR_SCALES) return true;
+    if (arg >= DNNL_ARG_MULTIPLE_DST) return false;
+    if (arg >= DNNL_ARG_MULTIPLE_SRC) return true;
+    switch (arg) {
+        case DNNL_GRAPH_ARG_POST_SRC:
+        case DNNL_ARG_SRC_0:
+        case DNNL_ARG_SRC_1:
+        case DNNL_ARG_SRC_2:
+        case DNNL_ARG_SRC_3:
+        case DNNL_ARG_WEIGHTS_0:
+        case DNNL_ARG_WEIGHTS_1:
+        case DNNL_ARG_WEIGHTS_2:
+        case DNNL_ARG_WEIGHTS_3:
+        case DNNL_ARG_BIAS:
+        case DNNL_ARG_SCALE:
+        case DNNL_ARG_SHIFT:
+        case DNNL_ARG_DIFF_DST_0:
+        case DNNL_ARG_DIFF_DST_1:
+        case DNNL_ARG_DIFF_DST_2:
+        case DNNL_ARG_ATTR_ROUNDING_SEED:
+        case DNNL_ARG_ATTR_DROPOUT_PROBABILITY:
+        case DNNL_ARG_ATTR_DROPOUT_SEED:
+        case DNNL_ARG_ATTR_PRECOMPUTED_REDUCTIONS:
+        case DNNL_ARG_ATTR_OUTPUT_SCALES: return true;
+        // Statistics, workspaces and scratchpads may be written
+        default: return false;
+    }
+}
+} // namespace
+
+std::vector<std::vector<size_t>> memory_planner_t::get_exec_stages(
+        const std::shared_ptr<subgraph_t> &sg) const {
+    // Memory objects placed into the same buffer share an id. A partition
+    // output which may be inplaced with an input gets the id of the input,
+    // as the user is allowed to pass the same buffer for both.
+    std::map<std::pair<int, size_t>, size_t> buffer_ids;
+    std::unordered_map<dnnl_memory_t, size_t> mem_buffer_ids;
+    auto bind = [&](const dnnl::memory &mem, int kind, size_t index) {
+        auto ret = buffer_ids.emplace(
+                std::make_pair(kind, index), buffer_ids.size());
+        mem_buffer_ids[mem.get()] = ret.first->second;
+    };
+
+    std::unordered_map<size_t, size_t> inplaced_outputs;
+    for (const auto &pair : inplace_pairs_) {
+        size_t in_idx = sg->ins_.size(), out_idx = sg->outs_.size();
+        for (size_t i = 0; i < sg->ins_.size(); i++) {
+            if (sg->ins_[i].id == pair.input_id) in_idx = i;
+        }
+        for (size_t i = 0; i < sg->outs_.size(); i++) {
+            if (sg->outs_[i].id == pair.output_id) out_idx = i;
+        }
+        if (in_idx < sg->ins_.size() && out_idx < sg->outs_.size())
+            inplaced_outputs[out_idx] = in_idx;
+    }
+
+    for (const auto &mem_idx : exec_args_set_.get_mems_use_external_inputs())
+        bind(mem_idx.first, external_input, mem_idx.second);
+    for (const auto &mem_idx : exec_args_set_.get_mems_use_external_outputs()) {
+        auto it = inplaced_outputs.find(mem_idx.second);
+        if (it != inplaced_outputs.end())
+            bind(mem_idx.first, external_input, it->second);
+        else
+            bind(mem_idx.first, external_output, mem_idx.second);
+    }
+    for (const auto &mem_offkey :
+            exec_args_set_.get_mems_use_internal_temporary())
+        bind(mem_offkey.first, internal_temporary, mem_offkey.second);
+    for (const auto &mem_offkey :
+            exec_args_set_.get_mems_use_internal_persistent())
+        bind(mem_offkey.first, internal_persistent, mem_offkey.second);
+
+    size_t n_buffers = buffer_ids.size();
+
+    // Each executable is placed right after the last stage it depends on: it
+    // reads a buffer written by an executable of that stage or writes a
+    // buffer accessed there.
+    const auto &exec_args = exec_args_set_.get_exec_args();
+    std::vector<size_t> stage_of(sg->execs_.size(), 0);
+    std::unordered_map<size_t, size_t> last_writer;
+    std::unordered_map<size_t, std::vector<size_t>> readers;
+    std::vector<std::vector<size_t>> stages;
+    for (size_t i = 0; i < sg->execs_.size(); i++) {
+        if (sg->is_constant_[i]) continue;
+
+        std::vector<std::pair<size_t, bool>> accesses;
+        for (const auto &arg : exec_args[i]) {
+            const dnnl_memory_t mem = arg.second.get(true);
+            if (!mem) continue;
+            auto it = mem_buffer_ids.find(mem);
+            // a memory object unknown to the planner owns its buffer
+            if (it == mem_buffer_ids.end())
+                it = mem_buffer_ids.emplace(mem, n_buffers++).first;
+            accesses.emplace_back(it->second, !is_read_only_arg(arg.first));
+        }
+
+        size_t stage = 0;
+        for (const auto &access : accesses) {
+            auto w = last_writer.find(access.first);
+            if (w != last_writer.end())
+                stage = std::max(stage, stage_of[w->second] + 1);
+            if (!access.second) continue;
+            for (size_t r : readers[access.first])
+                stage = std::max(stage, stage_of[r] + 1);
+        }
+
+        for (const auto &access : accesses) {
+            if (access.second) {
+                last_writer[access.first] = i;
+                readers[access.first].clear();
+            } else {
+                readers[access.first].emplace_back(i);
+            }
+        }
+
+        stage_of[i] = stage;
+        if (stages.size() <= stage) stages.resize(stage + 1);
+        stages[stage].emplace_back(i);
+    }
+
+    return stages;
+}
+
 status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     const auto &p_engine = *(sg->p_engine_);
     const auto &inputs = sg->ins_;
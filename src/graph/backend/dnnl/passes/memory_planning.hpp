@@ -336,6 +336,14 @@ public:
         return inplace_pairs_;
     };
 
+    // Groups the non-constant executables of the planned subgraph into stages
+    // executed one after another. An executable of a stage doesn't access a
+    // buffer written by another executable of the same stage, so the
+    // executables of a stage can run concurrently. Executables are kept in
+    // their execution order within a stage.
+    std::vector<std::vector<size_t>> get_exec_stages(
+            const std::shared_ptr<subgraph_t> &sg) const;
+
     std::string get_memory_info(const value_t *val) const {
         std::string str;
         auto pos = buffer_assignments_.find(val);
@@ -15,6 +15,7 @@
  *******************************************************************************/
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -74,6 +75,12 @@ static bool is_output_scales_supported(op_kind_t kind) {
 
 status_t check_with_bias(std::shared_ptr<subgraph_t> &sg) {
     for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() == op_kind::dnnl_grouped_matmul) {
+            // src, weights, group offsets and an optional bias
+            cur_op->set_attr<bool>(
+                    op_attr::with_bias, cur_op->num_inputs() == 4);
+            continue;
+        }
         if (!has_optional_bias(cur_op->get_kind())) continue;
         if (cur_op->num_inputs() == 3) {
             cur_op->set_attr<bool>(op_attr::with_bias, true);
@@ -2577,6 +2584,103 @@ extern "C" dnnl_status_t dnnl_memory_desc_create_with_string_tag(
         dnnl_memory_desc_t *, int, const dnnl_dims_t, dnnl_data_type_t,
         const char *);
 
+// Folds a reorder which only changes the layout into the matmul or the
+// convolution consuming it, when the consumer primitive takes the src layout
+// of the reorder as is, through the same implementation and with the same
+// dst. The consumer then absorbs the layout change in the routines copying
+// its inputs, e.g. the A and B copy kernels of brgemm matmul, instead of
+// reading a materialized copy.
+static status_t fold_reorders_into_consumers(std::shared_ptr<subgraph_t> &sg) {
+    const auto &p_engine = *(sg->p_engine_);
+    auto &pd_cache = sg->pd_cache_;
+    const auto &fpm = sg->get_fpmath_mode();
+    const bool use_block_layout = sg->can_use_blocked_layout_;
+
+    auto create_pd = [&](op_ptr &op) -> dnnl::primitive_desc {
+        if (op->get_kind() == op_kind::dnnl_matmul)
+            return matmul_executable_t::create_desc(
+                    op, p_engine, pd_cache, fpm, use_block_layout);
+        return conv_fwd_executable_t::create_desc(
+                op, p_engine, pd_cache, fpm, use_block_layout);
+    };
+
+    const auto sg_outs = sg->get_output_values();
+    subgraph_rewriter_t rewriter(sg);
+    for (auto &cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_reorder
+                || cur_op->num_inputs() != 1)
+            continue;
+        if (cur_op->has_attr(op_attr::scales)
+                || cur_op->has_attr(op_attr::src_zps)
+                || cur_op->has_attr(op_attr::dst_zps))
+            continue;
+
+        auto in_val = cur_op->get_input_value(0);
+        auto out_val = cur_op->get_output_value(0);
+        const auto in_lt = in_val->get_logical_tensor();
+        const auto out_lt = out_val->get_logical_tensor();
+        // The result of a constant reorder is kept in the constant cache,
+        // folding it would redo the layout change at each execution. The
+        // reorders inserted by the layout propagation aren't marked yet, so
+        // the property of their input is checked as well.
+        if (ltw(in_lt).is_constant()
+                || (cur_op->has_attr(op_attr::is_constant)
+                        && cur_op->get_attr<bool>(op_attr::is_constant)))
+            continue;
+        if (!ltw(in_lt).is_strided() || in_lt.data_type != out_lt.data_type)
+            continue;
+        if (out_val->get_consumers().size() != 1
+                || std::find(sg_outs.begin(), sg_outs.end(), out_val.get())
+                        != sg_outs.end())
+            continue;
+
+        const auto &csm = out_val->get_consumers()[0];
+        auto consumer = csm.get_op().shared_from_this();
+        const size_t offset = csm.get_offset();
+        const bool is_matmul = consumer->get_kind() == op_kind::dnnl_matmul;
+        const bool is_conv = consumer->get_kind() == op_kind::dnnl_convolution;
+        if (!(is_matmul && offset < 2) && !(is_conv && offset == 0)) continue;
+        if (pd_cache.find(consumer.get()) == pd_cache.end()) continue;
+
+        const auto in_md = make_dnnl_memory_desc(in_lt);
+        const auto out_md = make_dnnl_memory_desc(out_lt);
+        if (in_md.get_dims() != out_md.get_dims()) continue;
+
+        // Create the consumer pd with the src layout of the reorder, and
+        // restore the original one if it doesn't take it.
+        const auto org_cached_pd = pd_cache.at(consumer.get());
+        const dnnl::primitive_desc org_pd = create_pd(consumer);
+        pd_cache.erase(consumer.get());
+        CHECK(fill_layout_info(out_val, in_md));
+
+        bool accepted = false;
+        try {
+            const dnnl::primitive_desc pd = create_pd(consumer);
+            const auto arg_md
+                    = offset == 0 ? pd.src_desc(0) : pd.weights_desc(0);
+            accepted = arg_md == in_md && pd.dst_desc(0) == org_pd.dst_desc(0)
+                    && std::strcmp(pd.impl_info_str(), org_pd.impl_info_str())
+                            == 0;
+            if (accepted && consumer->num_outputs() > 1) {
+                CHECK(fill_layout_info(consumer->get_output_value(1),
+                        pd.scratchpad_desc()));
+            }
+        } catch (...) { accepted = false; }
+
+        if (!accepted) {
+            pd_cache.erase(consumer.get());
+            pd_cache.insert({consumer.get(), org_cached_pd});
+            CHECK(fill_layout_info(out_val, out_md));
+            continue;
+        }
+
+        rewriter.fuse_op_to_successor(cur_op);
+    }
+    rewriter.run();
+
+    return status::success;
+}
+
 status_t fuse_adjacent_reorders(std::shared_ptr<subgraph_t> &sg) {
     const static std::set<op_kind_t> reorder_op_set = {op_kind::dnnl_reorder};
 
@@ -2809,7 +2913,7 @@ status_t fuse_adjacent_reorders(std::shared_ptr<subgraph_t> &sg) {
     VCHECK_TRANSFORM(cnt <= max_num_limit + 1, status::unimplemented,
             "Reorder fusion failed.");
 
-    return status::success;
+    return fold_reorders_into_consumers(sg);
 }
 
 status_t fuse_typecast_to_mul_scales(std::shared_ptr<subgraph_t> &sg) {
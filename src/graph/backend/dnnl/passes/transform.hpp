@@ -130,7 +130,9 @@ status_t binary_canonicalization(std::shared_ptr<subgraph_t> &sg);
 // binary_canonicalization and infer_shape
 status_t binary_broadcast_swap(std::shared_ptr<subgraph_t> &sg);
 
-// This pass is used to fuse those adjacent reorders.
+// This pass is used to fuse those adjacent reorders. A remaining reorder which
+// only changes the layout is then folded into the matmul or the convolution
+// consuming it, if the consumer primitive can read the reorder's src as is.
 status_t fuse_adjacent_reorders(std::shared_ptr<subgraph_t> &sg);
 
 status_t fuse_typecast_to_mul_scales(std::shared_ptr<subgraph_t> &sg);
@@ -528,6 +528,7 @@ get_post_ops_fusible_map() {
                             {dnnl_eltwise, dnnl_binary, dnnl_convolution}},
                     {dnnl_convtranspose, {dnnl_eltwise, dnnl_binary}},
                     {dnnl_matmul, {dnnl_eltwise, dnnl_binary}},
+                    {dnnl_grouped_matmul, {dnnl_eltwise, dnnl_binary}},
                     {dnnl_pool, {dnnl_binary}},
                     {dnnl_eltwise, {dnnl_binary}},
                     {dnnl_binary, {dnnl_eltwise, dnnl_binary}},
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "graph/backend/dnnl/kernels/gated_mlp.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 
 #include "graph/backend/dnnl/patterns/fusions.hpp"
@@ -77,7 +78,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, gated_mlp)
                             in_edges_t {in_edge(0, bin, 0)});
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 // gated mlp with swish decomposed to sigmoid and multiply.
@@ -112,7 +113,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, gated_mlp_v1)
                             in_edges_t {in_edge(0, bin, 0)});
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 /*
@@ -167,7 +168,7 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, quantized_gated_mlp)
                     pgraph->append_op(graph::op_kind::MatMul, fc_down_edges);
                 })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
-            return std::make_shared<larger_partition_kernel_t>();
+            return std::make_shared<gated_mlp_base_t>();
         });
 
 // quantized gated mlp with swish decomposed to sigmoid and multiply.
@@ -208,6 +209,54 @@ DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, quantized_gated_mlp_v1)
                             = {in_edge(0, bin, 0), in_edge(1, deq_down, 0)};
                     pgraph->append_op(graph::op_kind::MatMul, fc_down_edges);
                 })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<gated_mlp_base_t>();
+        });
+
+/*
+// Gated MLP of mixture-of-experts layers: the rows of the source are routed
+// to the experts and each group of rows is multiplied by the weights of its
+// expert. All the grouped matmuls share the same group offsets.
+//        /      \
+//  grouped       grouped
+//  matmul (gt)   matmul (up)
+//     |          |
+//    unary*      |
+//        \      /
+//        multiply
+//           |
+//      grouped matmul (down)
+*/
+DNNL_BACKEND_REGISTER_PATTERN_MATCHER_PASS(dnnl, grouped_gated_mlp)
+        .set_priority(22.0f)
+        .set_kind(partition_kind_t::matmul_post_ops)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    pm::pb_op_t *fc_up = pgraph->append_op(
+                            graph::op_kind::GroupedMatMul);
+                    pm::pb_op_t *fc_gt = pgraph->append_op(
+                            graph::op_kind::GroupedMatMul);
+                    pgraph->create_input_port(0, fc_up, 0);
+                    pgraph->create_input_port(0, fc_gt, 0);
+
+                    // activations after fc_gt
+                    auto alt_graph = std::make_shared<pb_graph_t>();
+                    auto palt = alt_graph->append_alternation(get_unary_ops());
+                    alt_graph->create_input_port(0, palt, 0);
+                    alt_graph->create_output_port(0, palt, 0);
+                    // The activation is optional
+                    auto act = pgraph->append_optional(
+                            alt_graph, in_edges_t {in_edge(0, fc_gt, 0)});
+
+                    in_edges_t edges
+                            = {in_edge(0, act, 0), in_edge(1, fc_up, 0)};
+                    auto bin = pgraph->append_op(
+                            graph::op_kind::Multiply, edges);
+
+                    // fc_down
+                    pgraph->append_op(graph::op_kind::GroupedMatMul,
+                            in_edges_t {in_edge(0, bin, 0)});
+                })
         .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
             return std::make_shared<larger_partition_kernel_t>();
         });
@@ -21,6 +21,7 @@
 #include <unordered_map>
 
 #include "graph/interface/allocator.hpp"
+#include "graph/interface/scratchpad_sharing.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
 
@@ -43,7 +44,10 @@ public:
 };
 
 // The buffer is allocated when creating the temporary_scratchpad_t and
-// deallocated when destroying the temporary_scratchpad_t
+// deallocated when destroying the temporary_scratchpad_t. With scratchpad
+// sharing, partitions using the library allocator lease the buffer from the
+// shared scratchpad pool instead and give it back on destruction. The execution
+// is completed by then on CPU engines with a synchronous runtime.
 class temporary_scratchpad_t : public scratchpad_t {
 public:
     temporary_scratchpad_t(
@@ -56,7 +60,13 @@ public:
         , ocl_e_(nullptr)
 #endif
     {
-        if (size > 0) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+        // Memory of the pool doesn't come from the user allocator.
+        if (size > 0 && eng.get_kind() == dnnl::engine::kind::cpu
+                && is_scratchpad_sharing_enabled() && alloc == allocator_t())
+            buffer_ = shared_scratchpad::acquire(size, shared_capacity_);
+#endif
+        if (size > 0 && !buffer_) {
             buffer_ = reinterpret_cast<char *>(dnnl_allocator_t::malloc(
                     size, eng, &alloc, allocator_t::mem_type_t::temp));
         }
@@ -64,7 +74,9 @@ public:
     }
 
     ~temporary_scratchpad_t() override {
-        if (eng_->get_kind() == dnnl::engine::kind::cpu) {
+        if (shared_capacity_ > 0) {
+            shared_scratchpad::release(buffer_, shared_capacity_);
+        } else if (eng_->get_kind() == dnnl::engine::kind::cpu) {
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL
             dnnl_allocator_t::free(buffer_, *eng_, alloc_, e_);
 #else
@@ -103,6 +115,8 @@ private:
     size_t size_;
     const dnnl::engine *eng_;
     const allocator_t *alloc_;
+    // Size of the buffer leased from the shared scratchpad pool, 0 otherwise.
+    size_t shared_capacity_ = 0;
 #ifdef DNNL_WITH_SYCL
     ::sycl::event e_;
 #endif
@@ -397,6 +397,7 @@ public:
             CASE(GELUBackward);
             CASE(GenIndex);
             CASE(GreaterEqual);
+            CASE(GroupedMatMul);
             CASE(GroupNorm);
             CASE(HardSigmoid);
             CASE(HardSigmoidBackward);
@@ -704,6 +704,24 @@ DNNL_GRAPH_OP_SCHEMA(MatMul, 1,
                 .set_op_def_constraint_function(check_matmul_dtype)
                 .SET_MATMUL_COMMON_ATTRS)
 
+DNNL_GRAPH_OP_SCHEMA(GroupedMatMul, 1,
+        op_schema_t()
+                .set_inputs_option(op_schema_t::param_num_option::optional)
+                .set_num_inputs(std::set<size_t>({3, 4}))
+                .set_num_outputs(1)
+                .set_input(0, "src", "T")
+                .set_input(1, "weights", "T")
+                .set_input(2, "group_offsets", "T2")
+                .set_input(3, "bias", "T")
+                .set_output(0, "dst", "T1")
+                .set_type_constraints(
+                        "T", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints(
+                        "T1", {data_type::f32, data_type::bf16, data_type::f16})
+                .set_type_constraints("T2", {data_type::s32})
+                .set_shape_inference_function(
+                        infer_grouped_matmul_output_shape))
+
 DNNL_GRAPH_OP_SCHEMA(Maximum, 1,
         op_schema_t()
                 .set_num_inputs(2)
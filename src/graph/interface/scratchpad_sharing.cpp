@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl_graph.h"
+
+#include "common/utils.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/scratchpad_sharing.hpp"
+
+#include "graph/utils/alloc.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+namespace {
+std::atomic<bool> &scratchpad_sharing_flag() {
+    static std::atomic<bool> flag {
+            getenv_int_user("GRAPH_SCRATCHPAD_SHARING", 0) > 0};
+    return flag;
+}
+} // namespace
+
+bool is_scratchpad_sharing_enabled() {
+    return scratchpad_sharing_flag().load(std::memory_order_relaxed);
+}
+
+namespace shared_scratchpad {
+
+namespace {
+// Idle buffers are kept as (buffer, capacity) pairs. Their number is bounded by
+// the number of executions that ran concurrently.
+struct pool_t {
+    ~pool_t() {
+        for (auto &b : idle)
+            utils::cpu_allocator_t::free(b.first);
+    }
+
+    std::mutex mutex;
+    std::vector<std::pair<char *, size_t>> idle;
+    size_t size = 0;
+};
+
+pool_t &pool() {
+    static pool_t p;
+    return p;
+}
+} // namespace
+
+char *acquire(size_t size, size_t &capacity) {
+    pool_t &p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+
+    // Take the smallest idle buffer that fits. If none fits, the largest idle
+    // buffer is too small for this size and is replaced by the new one, so
+    // the pool doesn't keep buffers the partitions have outgrown.
+    size_t fit = p.idle.size(), largest = p.idle.size();
+    for (size_t i = 0; i < p.idle.size(); i++) {
+        const size_t cap = p.idle[i].second;
+        if (cap >= size && (fit == p.idle.size() || cap < p.idle[fit].second))
+            fit = i;
+        if (largest == p.idle.size() || cap > p.idle[largest].second)
+            largest = i;
+    }
+    if (fit == p.idle.size() && largest != p.idle.size()) {
+        utils::cpu_allocator_t::free(p.idle[largest].first);
+        p.size -= p.idle[largest].second;
+        p.idle.erase(p.idle.begin() + largest);
+    } else if (fit != p.idle.size()) {
+        char *buffer = p.idle[fit].first;
+        capacity = p.idle[fit].second;
+        p.idle.erase(p.idle.begin() + fit);
+        return buffer;
+    }
+
+    char *buffer = static_cast<char *>(utils::cpu_allocator_t::malloc(
+            size, utils::cpu_allocator_t::DEFAULT_ALIGNMENT));
+    if (!buffer) return nullptr;
+    capacity = size;
+    p.size += size;
+    return buffer;
+}
+
+void release(char *buffer, size_t capacity) {
+    if (!buffer) return;
+    pool_t &p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    p.idle.emplace_back(buffer, capacity);
+}
+
+size_t size() {
+    pool_t &p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    return p.size;
+}
+
+} // namespace shared_scratchpad
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+// API
+dnnl::impl::graph::status_t dnnl_graph_set_scratchpad_sharing(int flag) {
+    if (flag < 0) return dnnl::impl::graph::status::invalid_arguments;
+    dnnl::impl::graph::scratchpad_sharing_flag().store(flag > 0);
+    return dnnl::impl::graph::status::success;
+}
+
+dnnl::impl::graph::status_t dnnl_graph_get_scratchpad_sharing(int *flag) {
+    if (flag == nullptr) return dnnl::impl::graph::status::invalid_arguments;
+    *flag = dnnl::impl::graph::is_scratchpad_sharing_enabled() ? 1 : 0;
+    return dnnl::impl::graph::status::success;
+}
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_INTERFACE_SCRATCHPAD_SHARING_HPP
+#define GRAPH_INTERFACE_SCRATCHPAD_SHARING_HPP
+
+#include <cstddef>
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+
+// Returns true if compiled partitions take their temporary memory from the
+// pool of shared scratchpads. See dnnl_graph_set_scratchpad_sharing().
+bool is_scratchpad_sharing_enabled();
+
+// A process-wide pool of host buffers for the temporary memory of compiled
+// partitions. A buffer is leased for one execution and given back once the
+// execution returns, so partitions executed one after another reuse the same
+// buffers. The buffers are allocated by the library, never with a user
+// allocator, and are freed when the library is unloaded.
+namespace shared_scratchpad {
+
+// Leases a buffer of at least `size` bytes and returns its actual size in
+// `capacity`. Returns nullptr if the buffer can't be allocated.
+char *acquire(size_t size, size_t &capacity);
+// Gives a buffer returned by acquire() back to the pool.
+void release(char *buffer, size_t capacity);
+
+// Returns the total size of the buffers owned by the pool, leased or not.
+size_t size();
+
+} // namespace shared_scratchpad
+
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -1016,6 +1016,44 @@ status_t infer_matmul_output_shape(op_t *n,
     return status::success;
 }
 
+status_t infer_grouped_matmul_output_shape(op_t *n,
+        std::vector<logical_tensor_t *> &inputs,
+        std::vector<logical_tensor_t *> &outputs) {
+    auto in0 = logical_tensor_wrapper_t(inputs[0]);
+    auto in1 = logical_tensor_wrapper_t(inputs[1]);
+    auto in2 = logical_tensor_wrapper_t(inputs[2]);
+    auto out0 = logical_tensor_wrapper_t(outputs[0]);
+
+    // src: [M, K], weights: [G, K, N], group offsets: [G].
+    const dims input0_dims = in0.vdims();
+    const dims input1_dims = in1.vdims();
+    const dims input2_dims = in2.vdims();
+    VCHECK_INVALID_SHAPE((input0_dims.size() == 2 && input1_dims.size() == 3
+                                 && input2_dims.size() == 1),
+            "%s, src, weights and group offsets should be 2D, 3D and 1D "
+            "tensors. input 0: %s, input 1: %s, input 2: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dims2str(input0_dims).c_str(), dims2str(input1_dims).c_str(),
+            dims2str(input2_dims).c_str());
+    VCHECK_INVALID_SHAPE((input0_dims[1] == input1_dims[1]
+                                 && input2_dims[0] == input1_dims[0]),
+            "%s, arg shapes are not compatible. input 0: %s, input 1: %s, "
+            "input 2: %s",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dims2str(input0_dims).c_str(), dims2str(input1_dims).c_str(),
+            dims2str(input2_dims).c_str());
+
+    dims inferred_out_shape {input0_dims[0], input1_dims[2]};
+    if (out0.ndims() != -1) {
+        VCHECK_INVALID_SHAPE(validate(inferred_out_shape, out0.vdims()),
+                "%s, inferred out shape and output shape are not compatible",
+                op_t::kind2str(n->get_kind()).c_str());
+    }
+
+    set_shape_and_strides(*outputs[0], inferred_out_shape);
+    return status::success;
+}
+
 status_t infer_identity_output_shape(op_t *n,
         std::vector<logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
@@ -459,7 +459,11 @@ void compute_ref_fwd(
         return;
     }
 
-    if (prb->alg == WINO && prb->get_dt(SRC) == dnnl_f32) {
+    // The bf16 forward Winograd reference rounds the transformed data as the
+    // library does.
+    if (prb->alg == WINO
+            && (prb->get_dt(SRC) == dnnl_f32
+                    || prb->get_dt(SRC) == dnnl_bf16)) {
         compute_wino_ref_fwd(prb, args);
     } else {
         compute_ref_direct_fwd(prb, args);
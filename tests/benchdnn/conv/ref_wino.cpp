@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "utils/memory.hpp"
+#include "utils/numeric.hpp"
 #include "utils/parallel.hpp"
 
 #include "conv/ref_conv.hpp"
@@ -316,6 +317,9 @@ void compute_wino_ref_fwd(const prb_t *prb, const args_t &args) {
     const int64_t wp_max = prb->iw + l_pad;
     const int64_t hp_max = prb->ih + t_pad;
     const int64_t p_dim = prb->mb * sp.h_tiles * sp.w_tiles;
+    // The transformed source and weights are multiplied in the source data
+    // type.
+    const auto tr_dt = prb->get_dt(SRC);
 
     benchdnn_parallel_nd(G, MB, ICG, sp.h_tiles, sp.w_tiles,
             [&](int64_t g, int64_t img, int64_t c, int64_t hfm, int64_t wfm) {
@@ -340,7 +344,9 @@ void compute_wino_ref_fwd(const prb_t *prb, const args_t &args) {
                 /* scatter v:V */
                 for (int64_t j = 0; j < sp.alpha; j++) {
                     for (int64_t k = 0; k < sp.alpha; k++) {
-                        V(j, k, g, c, img, hfm, wfm) = _v[j][k];
+                        V(j, k, g, c, img, hfm, wfm)
+                                = round_to_nearest_representable(
+                                        tr_dt, _v[j][k]);
                     }
                 }
             });
@@ -359,7 +365,8 @@ void compute_wino_ref_fwd(const prb_t *prb, const args_t &args) {
         /* scatter u:U */
         for_(int64_t j = 0; j < sp.alpha; j++)
         for (int64_t k = 0; k < sp.alpha; k++) {
-            U(j, k, g, oc, ic) = _u[j][k];
+            U(j, k, g, oc, ic)
+                    = round_to_nearest_representable(tr_dt, _u[j][k]);
         }
     });
 
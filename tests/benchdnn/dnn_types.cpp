@@ -719,7 +719,7 @@ bool attr_t::is_def(bool skip_fpmath, bool skip_acc_mode) const {
             && IMPLICATION(
                     !skip_acc_mode, acc_mode == dnnl_accumulation_mode_strict)
             && rounding_mode.is_def() && deterministic.is_def()
-            && dropout.is_def();
+            && weights_replication.is_def() && dropout.is_def();
 }
 
 int attr_t::post_ops_t::find(pk_t kind, int start, int stop) const {
@@ -957,6 +957,12 @@ std::ostream &operator<<(std::ostream &s, const attr_t::deterministic_t &d) {
     return s;
 }
 
+std::ostream &operator<<(
+        std::ostream &s, const attr_t::weights_replication_t &wr) {
+    s << bool2str(wr.enabled);
+    return s;
+}
+
 std::ostream &operator<<(std::ostream &s, const attr_t::dropout_t &drop) {
     s << drop.p;
     if ((drop.seed != 0) || (drop.tag != tag::any)) s << ":" << drop.seed;
@@ -984,6 +990,9 @@ std::ostream &operator<<(std::ostream &s, const attr_t &attr) {
             s << "--attr-rounding-mode=" << attr.rounding_mode << " ";
         if (!attr.deterministic.is_def())
             s << "--attr-deterministic=" << attr.deterministic << " ";
+        if (!attr.weights_replication.is_def())
+            s << "--attr-weights-replication=" << attr.weights_replication
+              << " ";
         if (!attr.dropout.is_def())
             s << "--attr-dropout=" << attr.dropout << " ";
     }
@@ -1006,6 +1015,9 @@ std::ostream &operator<<(
             const int arg = args[i];
             if (!sparse_options.is_encoding_def(arg)) {
                 s << sparse_options.get_encoding(arg);
+                const auto block_dims = sparse_options.get_block_dims(arg);
+                if (!block_dims.empty())
+                    s << block_dims[0] << "x" << block_dims[1];
                 if (!sparse_options.is_sparsity_def(arg))
                     s << "+" << sparse_options.get_sparsity(arg);
             }
@@ -1412,6 +1424,9 @@ dnnl_primitive_attr_t create_dnnl_attr(
     DNN_SAFE_V(dnnl_primitive_attr_set_deterministic(
             dnnl_attr, attr.deterministic.enabled));
 
+    DNN_SAFE_V(dnnl_primitive_attr_set_weights_replication(
+            dnnl_attr, attr.weights_replication.enabled));
+
     if (!attr.dropout.is_def()) {
         const auto &drop_mask_md = attr_args.get_md(DNNL_ARG_ATTR_DROPOUT_MASK);
         DNN_SAFE_V(dnnl_primitive_attr_set_dropout(dnnl_attr, drop_mask_md));
@@ -1949,6 +1964,28 @@ int sparse_options_t::from_str(const std::string &s) {
         }
     };
 
+    // Splits `bsr4x16` into the encoding and its block dimensions.
+    const auto parse_encoding = [](const std::string &str,
+                                        dnnl_sparse_encoding_t &encoding,
+                                        block_dims_t &block_dims) {
+        const size_t dims_pos = str.find_first_of("0123456789");
+        encoding = str2sparse_encoding(str.substr(0, dims_pos).c_str());
+        if (dims_pos == std::string::npos) return OK;
+        // Only BSR encoding has blocks.
+        if (encoding != dnnl_bsr) return FAIL;
+
+        const size_t x_pos = str.find('x', dims_pos);
+        if (x_pos == std::string::npos) return FAIL;
+        const auto br_str = str.substr(dims_pos, x_pos - dims_pos);
+        const auto bc_str = str.substr(x_pos + 1);
+        if (br_str.empty() || bc_str.empty()) return FAIL;
+        const int64_t br = parser::parser_utils::stoll_safe(br_str);
+        const int64_t bc = parser::parser_utils::stoll_safe(bc_str);
+        if (br <= 0 || bc <= 0) return FAIL;
+        block_dims = {br, bc};
+        return OK;
+    };
+
     int options_count = 0;
     size_t start_pos = 0;
     while (start_pos != std::string::npos) {
@@ -1963,17 +2000,20 @@ int sparse_options_t::from_str(const std::string &s) {
             continue;
         }
 
+        dnnl_sparse_encoding_t encoding = sparse_options_t::def_encoding;
+        block_dims_t block_dims;
         if (subs.find("+") == std::string::npos) {
-            add(get_arg(options_count), str2sparse_encoding(subs.c_str()),
-                    sparse_options_t::def_sparsity);
+            SAFE(parse_encoding(subs, encoding, block_dims), WARN);
+            add(get_arg(options_count), encoding,
+                    sparse_options_t::def_sparsity, block_dims);
         } else {
             size_t subs_pos = 0;
             auto encoding_str = parser::get_substr(subs, subs_pos, '+');
             auto sparsity_str = parser::get_substr(subs, subs_pos, '+');
             if (encoding_str.empty() || sparsity_str.empty()) { return FAIL; }
-            add(get_arg(options_count),
-                    str2sparse_encoding(encoding_str.c_str()),
-                    atof(sparsity_str.c_str()));
+            SAFE(parse_encoding(encoding_str, encoding, block_dims), WARN);
+            add(get_arg(options_count), encoding, atof(sparsity_str.c_str()),
+                    block_dims);
         }
         options_count++;
     }
@@ -457,6 +457,12 @@ struct attr_t {
         bool enabled;
     };
 
+    struct weights_replication_t {
+        bool is_def() const { return !enabled; }
+
+        bool enabled = false;
+    };
+
     struct fpmath_mode_t {
         fpmath_mode_t() = default;
 
@@ -499,6 +505,9 @@ struct attr_t {
     void insert(const fpmath_mode_t &fpm) { this->fpmath_mode = fpm; }
     void insert(dnnl_accumulation_mode_t am) { this->acc_mode = am; }
     void insert(const deterministic_t &d) { this->deterministic = d; }
+    void insert(const weights_replication_t &wr) {
+        this->weights_replication = wr;
+    }
     void insert(const dropout_t &d) { this->dropout = d; }
     void insert(const rounding_mode_t &rm) { this->rounding_mode = rm; }
 
@@ -521,6 +530,7 @@ struct attr_t {
     fpmath_mode_t fpmath_mode;
     dnnl_accumulation_mode_t acc_mode;
     deterministic_t deterministic;
+    weights_replication_t weights_replication;
     dropout_t dropout;
     rounding_mode_t rounding_mode;
 
@@ -573,13 +583,19 @@ struct sparse_options_t {
             = dnnl_sparse_encoding_undef;
     static constexpr float def_sparsity = 0.9f;
 
+    // Block dimensions of BSR encoding, empty when not specified.
+    using block_dims_t = std::vector<int64_t>;
+
     sparse_options_t() = default;
-    sparse_options_t(int arg, dnnl_sparse_encoding_t encoding, float sparsity) {
-        add(arg, encoding, sparsity);
+    sparse_options_t(int arg, dnnl_sparse_encoding_t encoding, float sparsity,
+            const block_dims_t &block_dims = block_dims_t()) {
+        add(arg, encoding, sparsity, block_dims);
     }
 
-    void add(int arg, dnnl_sparse_encoding_t encoding, float sparsity) {
+    void add(int arg, dnnl_sparse_encoding_t encoding, float sparsity,
+            const block_dims_t &block_dims = block_dims_t()) {
         options_.insert({arg, {encoding, sparsity}});
+        if (!block_dims.empty()) block_dims_.insert({arg, block_dims});
     }
 
     dnnl_sparse_encoding_t get_encoding(int arg) const {
@@ -603,6 +619,11 @@ struct sparse_options_t {
         return options_.at(arg).second;
     }
 
+    block_dims_t get_block_dims(int arg) const {
+        if (block_dims_.count(arg) == 0) return block_dims_t();
+        return block_dims_.at(arg);
+    }
+
     bool is_encoding_def(int arg) const {
         return get_encoding(arg) == def_encoding;
     }
@@ -633,6 +654,7 @@ struct sparse_options_t {
 
 private:
     std::unordered_map<int, std::pair<dnnl_sparse_encoding_t, float>> options_;
+    std::unordered_map<int, block_dims_t> block_dims_;
 };
 
 std::ostream &operator<<(
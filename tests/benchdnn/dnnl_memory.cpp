@@ -680,6 +680,16 @@ benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> dnn_mem_t::init_coo_md(int ndims,
     return md;
 }
 
+benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> dnn_mem_t::init_bsr_md(int ndims,
+        const dnnl_dims_t dims, dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt) {
+    dnnl_memory_desc_t md {};
+    DNN_SAFE_V(dnnl_memory_desc_create_with_bsr_encoding(&md, ndims, dims,
+            data_type, nnz, block_dims, indices_dt, pointers_dt));
+    return md;
+}
+
 benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> dnn_mem_t::init_sparse_packed_md(
         int ndims, const dnnl_dims_t dims, dnnl_data_type_t data_type,
         dnnl_dim_t nnz) {
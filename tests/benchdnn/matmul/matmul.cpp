@@ -95,6 +95,19 @@ benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> create_md(const prb_t *prb,
                     return dnn_mem_t::init_sparse_packed_md(
                             prb->ndims, weights_rt_dims.data(), dt, nnz);
                     break;
+                case dnnl_bsr: {
+                    // Sparsity applies to blocks rather than to elements.
+                    const auto bd = prb->sparse_options.get_block_dims(
+                            DNNL_ARG_WEIGHTS);
+                    const dnnl_dims_t block_dims = {bd[0], bd[1]};
+                    const int64_t nblocks
+                            = div_up(prb->k, bd[0]) * div_up(prb->n, bd[1]);
+                    const dnnl_dim_t nnz_blocks
+                            = std::max(nblocks * (1.0f - wei_sparsity), 1.0f);
+                    return dnn_mem_t::init_bsr_md(prb->ndims,
+                            weights_rt_dims.data(), dt, nnz_blocks, block_dims,
+                            dnnl_s32, dnnl_s32);
+                }
                 default: assert(!"unsupported encoding"); return nullptr;
             }
         } else
@@ -226,8 +239,16 @@ int fill_sparse_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
 
     if (kind != SRC && kind != WEI) return FAIL;
 
-    const int64_t dim0 = kind == SRC ? prb->m : prb->k;
-    const int64_t dim1 = kind == SRC ? prb->k : prb->n;
+    // BSR encoding is CSR encoding of a matrix of blocks: `nnz`, pointers
+    // and indices refer to blocks, values hold `nnz` dense blocks.
+    const bool is_bsr = encoding == dnnl_bsr;
+    const auto block_dims = prb->sparse_options.get_block_dims(
+            kind == SRC ? DNNL_ARG_SRC : DNNL_ARG_WEIGHTS);
+    const int64_t br = is_bsr ? block_dims[0] : 1;
+    const int64_t bc = is_bsr ? block_dims[1] : 1;
+
+    const int64_t dim0 = div_up(kind == SRC ? prb->m : prb->k, br);
+    const int64_t dim1 = div_up(kind == SRC ? prb->k : prb->n, bc);
 
     // Coefficient for distribution of nnz per row.
     const int64_t coef = 3;
@@ -271,8 +292,8 @@ int fill_sparse_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
     int indices_idx = 1;
     const int pointers_idx = 2;
 
-    if (encoding == dnnl_csr) {
-        // fill pointers for CSR encoding
+    if (encoding == dnnl_csr || is_bsr) {
+        // fill pointers for CSR and BSR encodings
         mem_fp.set_elem(0, 0, pointers_idx);
         mem_dt.set_elem(0, 0, pointers_idx);
 
@@ -328,12 +349,13 @@ int fill_sparse_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
     cfg_t cfg(prb, {SRC, WEI, BIA, DST});
 
     /* Do fixed partitioning to have same filling for any number of threads */
+    const int64_t nvalues = nnz * br * bc;
     const int64_t chunk_size = 64;
-    const int64_t n_chunks = div_up(nnz, chunk_size);
+    const int64_t n_chunks = div_up(nvalues, chunk_size);
 
     benchdnn_parallel_nd(n_chunks, [&](int64_t idx_chunk) {
         int64_t idx_start = idx_chunk * chunk_size;
-        int64_t idx_end = MIN2(idx_start + chunk_size, nnz);
+        int64_t idx_end = MIN2(idx_start + chunk_size, nvalues);
 
         std::uniform_int_distribution<> values_gen(
                 cfg.get_range_min(kind), cfg.get_range_max(kind));
@@ -365,12 +387,12 @@ int fill_data(data_kind_t kind, int exec_arg, const prb_t *prb,
     bool is_any_sparse = false;
     std::vector<bool> nnz_mask;
     const auto sparse_encoding = prb->sparse_options.get_encoding(kind);
-    const bool is_sparse_csr_coo
-            = sparse_encoding == dnnl_csr || sparse_encoding == dnnl_coo;
+    const bool is_sparse_csr_coo_bsr = sparse_encoding == dnnl_csr
+            || sparse_encoding == dnnl_coo || sparse_encoding == dnnl_bsr;
     is_sparse_packed = sparse_encoding == dnnl_packed;
     is_any_sparse = sparse_encoding != sparse_options_t::def_encoding;
 
-    if (is_sparse_csr_coo) {
+    if (is_sparse_csr_coo_bsr) {
         return fill_sparse_data(
                 kind, prb, mem_dt, mem_fp, res, sparse_encoding);
     }
@@ -390,9 +412,9 @@ int fill_data(data_kind_t kind, int exec_arg, const prb_t *prb,
     // it requires metadata in addition to data. To have reasonable bitwise
     // validation for sparse, only data must be random and indices should remain
     // identical between runs. So far, simply don't support bitwise mode for
-    // sparse problems. `CSR`/`COO` will utilize their `fill_sparse_data`
-    // function, `packed` will fall back into a regular filling as it involves
-    // `nnz_mask`.
+    // sparse problems. `CSR`/`COO`/`BSR` will utilize their
+    // `fill_sparse_data` function, `packed` will fall back into a regular
+    // filling as it involves `nnz_mask`.
     if (has_bench_mode_bit(mode_bit_t::bitwise) && !is_any_sparse) {
         return fill_random_real(mem_dt, mem_fp, res);
     }
@@ -532,6 +554,27 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
         return;
     }
 
+    if (prb->sparse_options.get_encoding(DNNL_ARG_SRC) == dnnl_bsr) {
+        BENCHDNN_PRINT(2,
+                "[SKIP][%s:%d]: Source argument doesn't support BSR "
+                "encoding.\n",
+                __FILE__, __LINE__);
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
+
+    if (wei_encoding == dnnl_bsr
+            && prb->sparse_options.get_block_dims(DNNL_ARG_WEIGHTS).empty()) {
+        BENCHDNN_PRINT(2,
+                "[SKIP][%s:%d]: BSR encoding requires block dimensions, "
+                "e.g. `bsr4x16`.\n",
+                __FILE__, __LINE__);
+        res->state = SKIPPED;
+        res->reason = skip_reason::case_not_supported;
+        return;
+    }
+
     if (wei_encoding == dnnl_packed) {
         BENCHDNN_PRINT(2,
                 "[SKIP][%s:%d]: Weights argument doesn't support packed "
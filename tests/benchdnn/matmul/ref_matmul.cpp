@@ -228,8 +228,8 @@ void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
 
     const bool is_src_sparse
             = src_encoding == dnnl_csr || src_encoding == dnnl_coo;
-    const bool is_wei_sparse
-            = wei_encoding == dnnl_csr || wei_encoding == dnnl_coo;
+    const bool is_wei_sparse = wei_encoding == dnnl_csr
+            || wei_encoding == dnnl_coo || wei_encoding == dnnl_bsr;
     auto encoding = is_src_sparse ? src_encoding : wei_encoding;
 
     const int64_t M = prb->m;
@@ -248,7 +248,40 @@ void compute_ref_sparse_matmul(const prb_t *prb, const args_t &args) {
         dst_m.set_f32_elem(dst_off_f(prb, mb, m, n), 0.0f);
     });
 
-    if (is_wei_sparse) {
+    if (wei_encoding == dnnl_bsr) {
+        // BSR encoding is CSR encoding of the matrix of row-major blocks.
+        const auto block_dims
+                = prb->sparse_options.get_block_dims(DNNL_ARG_WEIGHTS);
+        const int64_t br = block_dims[0];
+        const int64_t bc = block_dims[1];
+        const int32_t *wei_indices = wei_m.get_mapped_pointer<int32_t>(1);
+        const int32_t *wei_pointers = wei_m.get_mapped_pointer<int32_t>(2);
+
+        benchdnn_parallel_nd(M, [&](int64_t m) {
+            for (int64_t kb = 0; kb < div_up(K, br); kb++) {
+                for (int64_t blk = wei_pointers[kb]; blk < wei_pointers[kb + 1];
+                        blk++) {
+                    const int64_t n_start = wei_indices[blk] * bc;
+                    const int64_t k_end = MIN2(K - kb * br, br);
+                    const int64_t n_end = MIN2(N - n_start, bc);
+                    for (int64_t k = 0; k < k_end; k++) {
+                        const int64_t src_idx
+                                = src_off_f(prb, mb, m, kb * br + k);
+                        const float src_val = src_m.get_f32_elem(src_idx);
+                        const int64_t wei_off = blk * br * bc + k * bc;
+                        for (int64_t n = 0; n < n_end; n++) {
+                            const int64_t dst_idx
+                                    = dst_off_f(prb, mb, m, n_start + n);
+                            const float wei_val = wei_m.get_elem(wei_off + n);
+                            float dst_val = dst_m.get_f32_elem(dst_idx);
+                            dst_val += src_val * wei_val;
+                            dst_m.set_f32_elem(dst_idx, dst_val);
+                        }
+                    }
+                }
+            }
+        });
+    } else if (is_wei_sparse) {
         int32_t *wei_indices = wei_m.get_mapped_pointer<int32_t>(
                 encoding == dnnl_csr ? 1 : 2);
         int32_t *wei_pointers = wei_m.get_mapped_pointer<int32_t>(2);
@@ -325,7 +358,8 @@ void compute_ref(const prb_t *prb, dir_t dir, const args_t &args,
             = prb->sparse_options.get_encoding(DNNL_ARG_WEIGHTS);
 
     if (src_encoding == dnnl_csr || wei_encoding == dnnl_csr
-            || src_encoding == dnnl_coo || wei_encoding == dnnl_coo) {
+            || src_encoding == dnnl_coo || wei_encoding == dnnl_coo
+            || wei_encoding == dnnl_bsr) {
         compute_ref_sparse_matmul(prb, args);
     } else {
         compute_ref_matmul(prb, args);
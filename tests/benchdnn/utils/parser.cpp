@@ -20,6 +20,7 @@
 #include "utils/cold_cache.hpp"
 #include "utils/fill.hpp"
 #include "utils/parser.hpp"
+#include "utils/roofline.hpp"
 #include "utils/stream_kind.hpp"
 #include "utils/summary.hpp"
 
@@ -388,6 +389,15 @@ attr_t::deterministic_t parse_attr_deterministic_func(const std::string &s) {
     return v;
 }
 
+attr_t::weights_replication_t parse_attr_weights_replication_func(
+        const std::string &s) {
+    attr_t::weights_replication_t v;
+    if (s.empty()) return v;
+
+    v.enabled = str2bool(s.c_str());
+    return v;
+}
+
 attr_t::fpmath_mode_t parse_attr_fpmath_mode_func(const std::string &s) {
     attr_t::fpmath_mode_t v;
     if (s.empty()) return v;
@@ -822,6 +832,20 @@ bool parse_attr_deterministic(
             help);
 }
 
+bool parse_attr_weights_replication(
+        std::vector<attr_t::weights_replication_t> &weights_replication,
+        const std::vector<attr_t::weights_replication_t>
+                &def_weights_replication,
+        const char *str,
+        const std::string &option_name = "attr-weights-replication") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Specifies weights replication "
+              "attribute. `BOOL` values can be `true`, or `false`.\n";
+    return parse_vector_option(weights_replication, def_weights_replication,
+            parser_utils::parse_attr_weights_replication_func, str,
+            option_name, help);
+}
+
 bool parse_attributes(
         base_settings_t &s, const base_settings_t &def, const char *str) {
     const bool parsed_attrs = parse_attr_scales(s.scales, str)
@@ -834,6 +858,8 @@ bool parse_attributes(
             || parse_attr_fpmath_mode(s.fpmath_mode, def.fpmath_mode, str)
             || parse_attr_acc_mode(s.acc_mode, def.acc_mode, str)
             || parse_attr_deterministic(s.deterministic, def.deterministic, str)
+            || parse_attr_weights_replication(
+                    s.weights_replication, def.weights_replication, str)
             || parse_attr_rounding_mode(s.rounding_mode, str);
     return parsed_attrs;
 }
@@ -1316,6 +1342,19 @@ static bool parse_max_ms_per_prb(
     return parsed;
 }
 
+static bool parse_peak_gflops(
+        const char *str, const std::string &option_name = "peak-gflops") {
+    static const std::string help
+            = "GFLOPS    (Default: `0`)\n    Specifies the peak compute "
+              "throughput of the target in `GFLOPS`.\n    The value is used to "
+              "identify compute bound problems for the roofline performance "
+              "report options.\n";
+    bool parsed = parse_single_value_option(peak_flops, default_peak_flops,
+            parser_utils::stof_safe, str, option_name, help);
+    if (parsed) peak_flops = MAX2(0., peak_flops * 1e9);
+    return parsed;
+}
+
 static bool parse_num_streams(
         const char *str, const std::string &option_name = "num-streams") {
     static const std::string help
@@ -1618,8 +1657,8 @@ bool parse_bench_settings(const char *str) {
             || parse_max_ms_per_prb(str) || parse_num_streams(str)
             || parse_repeats_per_prb(str) || parse_mem_check(str)
             || parse_memory_kind(str) || parse_mode(str)
-            || parse_mode_modifier(str) || parse_start(str)
-            || parse_stream_kind(str) || parse_summary(str)
+            || parse_mode_modifier(str) || parse_peak_gflops(str)
+            || parse_start(str) || parse_stream_kind(str) || parse_summary(str)
             || parse_verbose(str) || parse_execution_mode(str)
             || parse_buffer_prefix(str);
 
@@ -18,6 +18,7 @@
 #include "dnnl_common.hpp"
 
 #include "utils/perf_report.hpp"
+#include "utils/roofline.hpp"
 
 void base_perf_report_t::report(res_t *res, const char *prb_str) const {
     dump_perf_footer();
@@ -76,6 +77,11 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return (res->ibytes + res->obytes) / t.sec(mode) / unit;
     };
 
+    auto get_roofline_eff = [&](const timer::timer_t &t) -> double {
+        return roofline::get_efficiency(
+                ops(), res->ibytes + res->obytes, t.sec(mode));
+    };
+
     auto get_freq = [&](const timer::timer_t &t) -> double {
         if (!t.sec(mode)) return 0;
         return t.ticks(mode) / t.sec(mode) / unit;
@@ -130,6 +136,9 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("ctx-exe", s << *ctx_exe());
     // Options operating on driver independent objects, e.g. timer values.
     HANDLE("bw", s << get_bw(res->timer_map.perf_timer()));
+    HANDLE("bound",
+            s << roofline::bound2str(
+                    roofline::get_bound(ops(), res->ibytes + res->obytes)));
     HANDLE("driver", s << driver_name);
     HANDLE("flops", s << get_flops(res->timer_map.perf_timer()));
     HANDLE("clocks", s << res->timer_map.perf_timer().ticks(mode) / unit);
@@ -139,6 +148,8 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
     HANDLE("impl", s << res->impl_name);
     HANDLE("ibytes", s << res->ibytes / unit);
     HANDLE("obytes", s << res->obytes / unit);
+    HANDLE("peakbw", s << roofline::get_peak_bw() / unit);
+    HANDLE("roofeff", s << get_roofline_eff(res->timer_map.perf_timer()));
     HANDLE("iobytes", s << (res->ibytes + res->obytes) / unit);
     HANDLE("idx", s << benchdnn_stat.tests);
     HANDLE("time", s << res->timer_map.perf_timer().ms(mode) / unit);
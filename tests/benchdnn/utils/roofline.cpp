@@ -0,0 +1,122 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "dnnl_common.hpp"
+
+#include "utils/parallel.hpp"
+#include "utils/roofline.hpp"
+
+double default_peak_flops {0};
+double peak_flops {default_peak_flops};
+
+namespace roofline {
+
+const char *bound2str(bound_t bound) {
+    switch (bound) {
+        case bound_t::memory: return "memory";
+        case bound_t::compute: return "compute";
+        default: return "unknown";
+    }
+}
+
+namespace {
+// Measures the bandwidth of `a[i] = b[i] + s * c[i]` over arrays which don't
+// fit the caches. Bytes are counted as in STREAM, without write-allocate
+// traffic.
+double measure_triad_bw() {
+    cpu_cache_args_t cache_args {};
+    if (get_cpu_cache_size(cache_args) != OK) return 0;
+
+    // Each array is at least four times the size of the caches.
+    const int64_t min_nelems = 8 * 1024 * 1024;
+    const int64_t nelems = std::max(min_nelems,
+            static_cast<int64_t>(4 * cache_args.total_socket_size
+                    / sizeof(double)));
+    const int64_t chunk = 64 * 1024;
+    const int64_t nchunks = div_up(nelems, chunk);
+
+    std::unique_ptr<double[]> a(new double[nelems]);
+    std::unique_ptr<double[]> b(new double[nelems]);
+    std::unique_ptr<double[]> c(new double[nelems]);
+    double *pa = a.get(), *pb = b.get(), *pc = c.get();
+
+    // First touch by the same threads which run the kernel.
+    benchdnn_parallel_nd(nchunks, [&](int64_t ic) {
+        const int64_t end = std::min(nelems, (ic + 1) * chunk);
+        for (int64_t i = ic * chunk; i < end; i++) {
+            pa[i] = 0.;
+            pb[i] = 1.;
+            pc[i] = 2.;
+        }
+    });
+
+    const double s = 3.;
+    double best_sec = 0;
+    const int n_iters = 10;
+    for (int iter = 0; iter < n_iters; iter++) {
+        const auto start = std::chrono::steady_clock::now();
+        benchdnn_parallel_nd(nchunks, [&](int64_t ic) {
+            const int64_t end = std::min(nelems, (ic + 1) * chunk);
+            for (int64_t i = ic * chunk; i < end; i++)
+                pa[i] = pb[i] + s * pc[i];
+        });
+        const std::chrono::duration<double> sec
+                = std::chrono::steady_clock::now() - start;
+        if (iter == 0 || sec.count() < best_sec) best_sec = sec.count();
+    }
+
+    const double bytes = 3. * nelems * sizeof(double);
+    const double bw = best_sec > 0 ? bytes / best_sec : 0;
+    BENCHDNN_PRINT(2, "[ROOFLINE] Peak memory bandwidth: %g GB/s\n", bw / 1e9);
+    return bw;
+}
+} // namespace
+
+double get_peak_bw() {
+    if (!is_cpu()) return 0;
+    static const double peak_bw = measure_triad_bw();
+    return peak_bw;
+}
+
+bound_t get_bound(double ops, double bytes) {
+    const double peak_bw = get_peak_bw();
+    if (peak_bw <= 0 || bytes <= 0) return bound_t::unknown;
+    // Data movement is the only work of primitives without arithmetic
+    // operations counted.
+    if (ops <= 0) return bound_t::memory;
+    if (peak_flops <= 0) return bound_t::unknown;
+
+    // A problem is memory bound when its arithmetic intensity is below the
+    // ridge point of the roofline.
+    const double intensity = ops / bytes;
+    const double ridge_point = peak_flops / peak_bw;
+    return intensity < ridge_point ? bound_t::memory : bound_t::compute;
+}
+
+double get_efficiency(double ops, double bytes, double sec) {
+    if (sec <= 0) return 0;
+    switch (get_bound(ops, bytes)) {
+        case bound_t::memory: return 100. * bytes / sec / get_peak_bw();
+        case bound_t::compute: return 100. * ops / sec / peak_flops;
+        default: return 0;
+    }
+}
+
+} // namespace roofline
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef UTILS_ROOFLINE_HPP
+#define UTILS_ROOFLINE_HPP
+
+// Peak compute throughput of the target in FLOPS provided through
+// `--peak-gflops`. `0` means unknown.
+extern double peak_flops;
+extern double default_peak_flops;
+
+namespace roofline {
+
+enum class bound_t {
+    // The bound can't be identified, e.g. the peak compute throughput is
+    // unknown for a primitive that performs arithmetic operations.
+    unknown,
+    // Performance is limited by the memory bandwidth.
+    memory,
+    // Performance is limited by the compute throughput.
+    compute,
+};
+
+const char *bound2str(bound_t bound);
+
+// Returns the memory bandwidth of the target in bytes per second. The value is
+// measured once with a STREAM-like triad kernel, `0` is returned for non-CPU
+// engines.
+double get_peak_bw();
+
+// Identifies what limits a problem performing `ops` arithmetic operations and
+// moving `bytes` bytes from and to memory, according to the roofline model.
+bound_t get_bound(double ops, double bytes);
+
+// Returns the achieved fraction of the attainable performance in percent, or
+// `0` if the bound is unknown.
+double get_efficiency(double ops, double bytes, double sec);
+
+} // namespace roofline
+
+#endif
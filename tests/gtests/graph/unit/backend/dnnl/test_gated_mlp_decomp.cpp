@@ -0,0 +1,152 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
+#include "graph/unit/unit_test_common.hpp"
+#include "graph/unit/utils.hpp"
+
+namespace graph = dnnl::impl::graph;
+namespace utils = dnnl::graph::tests::unit::utils;
+using dim_t = dnnl_dim_t;
+
+namespace {
+
+// Builds a gated MLP with a sigmoid activation:
+//   dst = (sigmoid(src x wei_gt) * (src x wei_up)) x wei_dn
+void construct_gated_mlp(graph::graph_t *g, dim_t M, dim_t K, dim_t N) {
+    using graph::logical_tensor_t;
+    using graph::op_t;
+    namespace op_kind = graph::op_kind;
+    const auto dt = graph::data_type::f32;
+    logical_tensor_t src = utils::logical_tensor_init(0, {M, K}, dt);
+    logical_tensor_t wei_gt = utils::logical_tensor_init(1, {K, N}, dt);
+    logical_tensor_t wei_up = utils::logical_tensor_init(2, {K, N}, dt);
+    logical_tensor_t wei_dn = utils::logical_tensor_init(3, {N, K}, dt);
+    logical_tensor_t gt_dst = utils::logical_tensor_init(4, {M, N}, dt);
+    logical_tensor_t act_dst = utils::logical_tensor_init(5, {M, N}, dt);
+    logical_tensor_t up_dst = utils::logical_tensor_init(6, {M, N}, dt);
+    logical_tensor_t mul_dst = utils::logical_tensor_init(7, {M, N}, dt);
+    logical_tensor_t dst = utils::logical_tensor_init(8, {M, K}, dt);
+
+    op_t fc_gt {0, op_kind::MatMul, "fc_gt"};
+    fc_gt.add_input(src);
+    fc_gt.add_input(wei_gt);
+    fc_gt.add_output(gt_dst);
+    op_t act {1, op_kind::Sigmoid, "act"};
+    act.add_input(gt_dst);
+    act.add_output(act_dst);
+    op_t fc_up {2, op_kind::MatMul, "fc_up"};
+    fc_up.add_input(src);
+    fc_up.add_input(wei_up);
+    fc_up.add_output(up_dst);
+    op_t mul {3, op_kind::Multiply, "mul"};
+    mul.add_input(act_dst);
+    mul.add_input(up_dst);
+    mul.add_output(mul_dst);
+    op_t fc_dn {4, op_kind::MatMul, "fc_down"};
+    fc_dn.add_input(mul_dst);
+    fc_dn.add_input(wei_dn);
+    fc_dn.add_output(dst);
+
+    for (auto *op : {&fc_gt, &act, &fc_up, &mul, &fc_dn})
+        g->add_op(op);
+    g->finalize();
+}
+
+// Compiles the gated MLP partition, checks that it's computed by the
+// decomposition kernel and compares its result with the one of the ops
+// executed one by one.
+void test_gated_mlp_decomp(dim_t M, dim_t K, dim_t N) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::graph_t g(eng->kind());
+    construct_gated_mlp(&g, M, K, N);
+
+    graph::pass::pass_base_ptr apass = get_pass("gated_mlp");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 4U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+    ASSERT_EQ(cp.get_pimpl()->str(), std::string("gated_mlp_decomp_kernel_t"));
+
+    std::vector<test_tensor_t> inputs_ts, outputs_ts, ref_outputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        outputs_ts.emplace_back(compiled_output, eng);
+        ref_outputs_ts.emplace_back(compiled_output, eng);
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+    ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                      test_tensor_t::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+            /*rtol*/ 1e-4f, /*atol*/ 1e-3f));
+}
+
+} // namespace
+
+// Enough rows for blocks of rows on each thread, the weights being read by
+// each block.
+TEST(test_gated_mlp_decomp_execute, F32RowBlocks_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    test_gated_mlp_decomp(2048, 64, 512);
+}
+
+// Too few rows for blocks of rows, the intermediate dimension is split over
+// the threads instead and the partial destinations are summed.
+TEST(test_gated_mlp_decomp_execute, F32IntermediateSlices_CPU) {
+    SKIP_IF(get_engine()->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+    SKIP_IF(dnnl_get_max_threads() < 2,
+            "Slices of the intermediate dimension need several threads.");
+    test_gated_mlp_decomp(4, 64, 512);
+}
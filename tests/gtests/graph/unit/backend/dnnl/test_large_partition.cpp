@@ -14,11 +14,15 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <functional>
 #include <random>
 
 #include "gtest/gtest.h"
 
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
@@ -341,6 +345,116 @@ TEST(test_large_partition_execute, F32Resnet50Stage2Block) {
                     /*atol*/ 1e-5f));
 }
 
+TEST(test_large_partition_execute, F32Resnet50Stage2BlockInterOp) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu, "skip on gpu");
+    SKIP_IF(dnnl_get_max_threads() < 2,
+            "Concurrent execution needs several threads.");
+
+    utils::id_generator_t id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    // The convolutions of the first block's residual branch and main branch
+    // are independent and executed concurrently.
+    custom_setenv("ONEDNN_GRAPH_INTER_OP_PARALLELISM", "1", 1);
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    // Set back to avoid affecting other tests
+    custom_setenv("ONEDNN_GRAPH_INTER_OP_PARALLELISM", "0", 1);
+    graph::compiled_partition_t cp_serial(p);
+    ASSERT_EQ(p.compile(&cp_serial, inputs, outputs, eng),
+            graph::status::success);
+
+    using graph::dnnl_impl::dnnl_compiled_partition_impl_t;
+    using graph::dnnl_impl::larger_partition_kernel_t;
+    const auto get_stages = [](const graph::compiled_partition_t &c) {
+        const auto *impl = dynamic_cast<const dnnl_compiled_partition_impl_t *>(
+                c.get_pimpl());
+        EXPECT_NE(impl, nullptr);
+        const auto *kernel = dynamic_cast<const larger_partition_kernel_t *>(
+                impl->get_kernel().get());
+        EXPECT_NE(kernel, nullptr);
+        return kernel->get_exec_stages();
+    };
+    const auto stages = get_stages(cp);
+    ASSERT_TRUE(std::any_of(stages.begin(), stages.end(),
+            [](const std::vector<size_t> &s) { return s.size() > 1; }));
+    ASSERT_TRUE(get_stages(cp_serial).empty());
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    std::vector<std::vector<float>> inputs_data;
+    std::vector<std::vector<float>> outputs_data, serial_outputs_data,
+            ref_outputs_data;
+    std::vector<test_tensor_t> inputs_ts, outputs_ts, serial_outputs_ts,
+            ref_outputs_ts;
+
+    for (auto &lt : inputs) {
+        inputs_data.emplace_back(utils::product(ltw(lt).vdims()));
+        fill_data(inputs_data.back(), ltw(lt).data_type());
+        inputs_ts.emplace_back(*lt, eng, inputs_data.back());
+    }
+
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        const std::vector<int64_t> dims = ltw(compiled_output).vdims();
+        auto size = utils::product(dims);
+        outputs_data.emplace_back(size);
+        outputs_ts.emplace_back(compiled_output, eng, outputs_data.back());
+        serial_outputs_data.emplace_back(size);
+        serial_outputs_ts.emplace_back(
+                compiled_output, eng, serial_outputs_data.back());
+        ref_outputs_data.emplace_back(size);
+        ref_outputs_ts.emplace_back(
+                compiled_output, eng, ref_outputs_data.back());
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    ASSERT_EQ(cp.execute(strm, test_tensor_t::to_graph_tensor(inputs_ts),
+                      test_tensor_t::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    ASSERT_EQ(cp_serial.execute(strm,
+                      test_tensor_t::to_graph_tensor(inputs_ts),
+                      test_tensor_t::to_graph_tensor(serial_outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0], serial_outputs_ts[0],
+            /*rtol*/ 1e-6f, /*atol*/ 1e-6f));
+    ASSERT_TRUE(
+            allclose<float>(outputs_ts[0], ref_outputs_ts[0], /*rtol*/ 1e-5f,
+                    /*atol*/ 1e-5f));
+}
+
 TEST(test_large_partition_execute, ItexInt8Resnet50Stage2Block) {
     SKIP_IF_NV_GPU("not supported on NVIDIA GPU");
     graph::engine_t *eng = get_engine();
@@ -15133,3 +15133,103 @@ TEST(test_pass_system, LayernormWithSpecialAxis) {
         ASSERT_EQ(agraph.get_num_partitions(), 0U);
     }
 }
+
+TEST(test_pass, GroupedMatMul) {
+    /*
+           | (f32)
+      grouped matmul
+           | (f32)
+    */
+    const auto engine_kind = get_test_engine_kind();
+    graph_t agraph(engine_kind);
+
+    op_t gmm {0, GroupedMatMul, "grouped_matmul"};
+    logical_tensor_t src = logical_tensor_init(0, {16, 32}, data_type::f32);
+    logical_tensor_t wei = logical_tensor_init(1, {4, 32, 64}, data_type::f32);
+    logical_tensor_t off = logical_tensor_init(2, {4}, data_type::s32);
+    logical_tensor_t dst = logical_tensor_init(3, {16, 64}, data_type::f32);
+    gmm.add_input(src);
+    gmm.add_input(wei);
+    gmm.add_input(off);
+    gmm.add_output(dst);
+
+    ASSERT_EQ(agraph.add_op(&gmm), status::success);
+    agraph.finalize();
+
+    pass::pass_base_ptr apass = get_pass("grouped_matmul_pass");
+    apass->run(agraph);
+    ASSERT_EQ(agraph.get_num_partitions(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_ops().size(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 3U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id, 3U);
+}
+
+TEST(test_pass, GroupedGatedMlp) {
+    /*
+               | (f32)
+            /     \
+     grouped       grouped
+     matmul (gt)   matmul (up)
+        |          |
+      sigmoid      |
+          \       /
+           multiply
+              |
+        grouped matmul (down)
+              | (f32)
+    */
+    const auto engine_kind = get_test_engine_kind();
+    graph_t agraph(engine_kind);
+
+    const graph::dim_t G = 4, M = 16, K = 32, N = 64;
+    logical_tensor_t src = logical_tensor_init(0, {M, K}, data_type::f32);
+    logical_tensor_t off = logical_tensor_init(1, {G}, data_type::s32);
+    logical_tensor_t wei_gt
+            = logical_tensor_init(2, {G, K, N}, data_type::f32);
+    logical_tensor_t wei_up
+            = logical_tensor_init(3, {G, K, N}, data_type::f32);
+    logical_tensor_t wei_dn
+            = logical_tensor_init(4, {G, N, K}, data_type::f32);
+    logical_tensor_t gt_dst = logical_tensor_init(5, {M, N}, data_type::f32);
+    logical_tensor_t act_dst = logical_tensor_init(6, {M, N}, data_type::f32);
+    logical_tensor_t up_dst = logical_tensor_init(7, {M, N}, data_type::f32);
+    logical_tensor_t mul_dst = logical_tensor_init(8, {M, N}, data_type::f32);
+    logical_tensor_t dst = logical_tensor_init(9, {M, K}, data_type::f32);
+
+    op_t fc_gt {0, GroupedMatMul, "fc_gt"};
+    fc_gt.add_input(src);
+    fc_gt.add_input(wei_gt);
+    fc_gt.add_input(off);
+    fc_gt.add_output(gt_dst);
+    op_t act {1, Sigmoid, "act"};
+    act.add_input(gt_dst);
+    act.add_output(act_dst);
+    op_t fc_up {2, GroupedMatMul, "fc_up"};
+    fc_up.add_input(src);
+    fc_up.add_input(wei_up);
+    fc_up.add_input(off);
+    fc_up.add_output(up_dst);
+    op_t mul {3, Multiply, "mul"};
+    mul.add_input(act_dst);
+    mul.add_input(up_dst);
+    mul.add_output(mul_dst);
+    op_t fc_dn {4, GroupedMatMul, "fc_down"};
+    fc_dn.add_input(mul_dst);
+    fc_dn.add_input(wei_dn);
+    fc_dn.add_input(off);
+    fc_dn.add_output(dst);
+
+    for (auto *op : {&fc_gt, &act, &fc_up, &mul, &fc_dn})
+        ASSERT_EQ(agraph.add_op(op), status::success);
+    agraph.finalize();
+
+    pass::pass_base_ptr apass = get_pass("grouped_gated_mlp");
+    apass->run(agraph);
+    ASSERT_EQ(agraph.get_num_partitions(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_kind(),
+            partition_kind_t::matmul_post_ops);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_ops().size(), 5U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs()[0].id, 9U);
+}
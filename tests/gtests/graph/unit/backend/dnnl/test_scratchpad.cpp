@@ -144,3 +144,87 @@ TEST(test_scratchpad, RegistryMultithreading) {
     t1.join();
     t2.join();
 }
+
+TEST(test_scratchpad, SharedTemporaryScratchpad) {
+    using dnnl::impl::graph::allocator_t;
+    using dnnl::impl::graph::dnnl_impl::temporary_scratchpad_t;
+    namespace shared_scratchpad = dnnl::impl::graph::shared_scratchpad;
+
+    graph::engine_t *g_eng = get_engine();
+    SKIP_IF(g_eng->kind() != graph::engine_kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "scratchpad sharing is only supported on synchronous cpu runtimes");
+    allocator_t *alloc = static_cast<allocator_t *>(g_eng->get_allocator());
+    SKIP_IF(!(*alloc == allocator_t()),
+            "scratchpad sharing requires the library allocator");
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    int flag = 0;
+    ASSERT_EQ(dnnl_graph_get_scratchpad_sharing(&flag), dnnl_success);
+    ASSERT_EQ(dnnl_graph_set_scratchpad_sharing(-1), dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_graph_set_scratchpad_sharing(1), dnnl_success);
+
+    // Scratchpads created one after another reuse the pool buffer, which is
+    // replaced when it is too small.
+    std::vector<size_t> buf_sizes = {1024, 4096, 512, 2048};
+    char *buffer = nullptr;
+    const size_t size0 = shared_scratchpad::size();
+    for (size_t i = 0; i < buf_sizes.size(); i++) {
+        temporary_scratchpad_t scratchpad(buf_sizes[i], p_eng, *alloc);
+        ASSERT_EQ(buf_sizes[i], scratchpad.size());
+        ASSERT_NE(scratchpad.get_buffer(), nullptr);
+        if (i > 1) { ASSERT_EQ(scratchpad.get_buffer(), buffer); }
+        buffer = scratchpad.get_buffer();
+    }
+    ASSERT_LE(shared_scratchpad::size(), size0 + 4096U);
+
+    // Scratchpads alive at the same time lease different buffers.
+    {
+        temporary_scratchpad_t outer(1024, p_eng, *alloc);
+        temporary_scratchpad_t inner(1024, p_eng, *alloc);
+        ASSERT_NE(outer.get_buffer(), nullptr);
+        ASSERT_NE(inner.get_buffer(), nullptr);
+        ASSERT_NE(inner.get_buffer(), outer.get_buffer());
+    }
+
+    ASSERT_EQ(dnnl_graph_set_scratchpad_sharing(flag), dnnl_success);
+}
+
+namespace {
+// Wraps the library allocation functions, so that the allocator differs from
+// the default one.
+void *test_host_malloc(size_t size, size_t alignment) {
+    return graph::utils::cpu_allocator_t::malloc(size, alignment);
+}
+void test_host_free(void *ptr) {
+    graph::utils::cpu_allocator_t::free(ptr);
+}
+} // namespace
+
+TEST(test_scratchpad, SharedTemporaryScratchpadUserAllocator) {
+    using dnnl::impl::graph::allocator_t;
+    using dnnl::impl::graph::dnnl_impl::temporary_scratchpad_t;
+    namespace shared_scratchpad = dnnl::impl::graph::shared_scratchpad;
+
+    graph::engine_t *g_eng = get_engine();
+    SKIP_IF(g_eng->kind() != graph::engine_kind::cpu,
+            "skip the user allocator test on non-cpu engines");
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+    allocator_t alloc(test_host_malloc, test_host_free);
+
+    int flag = 0;
+    ASSERT_EQ(dnnl_graph_get_scratchpad_sharing(&flag), dnnl_success);
+    ASSERT_EQ(dnnl_graph_set_scratchpad_sharing(1), dnnl_success);
+
+    // Temporary memory of partitions with a user allocator is always
+    // allocated with it, a request larger than any pool buffer would grow
+    // the pool otherwise.
+    const size_t size0 = shared_scratchpad::size();
+    {
+        temporary_scratchpad_t scratchpad(size0 + 1024, p_eng, alloc);
+        ASSERT_NE(scratchpad.get_buffer(), nullptr);
+    }
+    ASSERT_EQ(shared_scratchpad::size(), size0);
+
+    ASSERT_EQ(dnnl_graph_set_scratchpad_sharing(flag), dnnl_success);
+}
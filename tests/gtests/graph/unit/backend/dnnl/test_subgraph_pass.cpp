@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <random>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -30,6 +31,7 @@
 #include "backend/dnnl/op_executable.hpp"
 #include "backend/dnnl/passes/constant_propagation.hpp"
 #include "backend/dnnl/passes/insert_ops.hpp"
+#include "backend/dnnl/passes/layout_assignment.hpp"
 #include "backend/dnnl/passes/layout_propagation.hpp"
 #include "backend/dnnl/passes/lower.hpp"
 #include "backend/dnnl/passes/memory_planning.hpp"
@@ -458,6 +460,114 @@ TEST(test_subgraph_pass, Conv2dNxcPlainDst) {
     }
 }
 
+TEST(test_subgraph_pass, LayoutAssignmentConvChain) {
+    using dims = graph::dnnl_impl::dims;
+    graph::engine_t *engine = get_engine();
+    dnnl::engine p_eng
+            = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*engine);
+
+    // The first convolution has a stride of 2, so that the reorder of the
+    // subgraph input costs more than running both convolutions with the nxc
+    // layout.
+    const int64_t ic = 64, oc = 64;
+    std::vector<int64_t> src_shape {2, 14, 14, ic};
+    std::vector<int64_t> weight_shape {1, 1, ic, oc};
+    std::vector<int64_t> dst_shape {2, 7, 7, oc};
+
+    auto src = logical_tensor_init(0, src_shape, graph::data_type::f32);
+    auto wei0 = logical_tensor_init(1, weight_shape, graph::data_type::f32);
+    auto mid = logical_tensor_init(2, dst_shape, graph::data_type::f32);
+    auto wei1 = logical_tensor_init(3, weight_shape, graph::data_type::f32);
+    auto dst = logical_tensor_init(4, dst_shape, graph::data_type::f32);
+
+    // Runs the layout propagation on nxc conv -> conv, with or without the
+    // layout assignment, and returns the number of inserted reorders.
+    auto count_reorders = [&](bool assign, bool use_blocked) {
+        graph::op_t conv0(0, graph::op_kind::Convolution, "conv0");
+        graph::op_t conv1(1, graph::op_kind::Convolution, "conv1");
+        conv0.set_attr<dims>(op_attr::strides, dims(2, 2));
+        conv1.set_attr<dims>(op_attr::strides, dims(2, 1));
+        for (auto *conv : {&conv0, &conv1}) {
+            conv->set_attr<dims>(op_attr::dilations, dims(2, 1));
+            conv->set_attr<dims>(op_attr::pads_begin, dims(2, 0));
+            conv->set_attr<dims>(op_attr::pads_end, dims(2, 0));
+            conv->set_attr<int64_t>(op_attr::groups, (int64_t)1);
+            conv->set_attr<std::string>(op_attr::data_format, "NXC");
+            conv->set_attr<std::string>(op_attr::weights_format, "XIO");
+        }
+        conv0.add_input(src);
+        conv0.add_input(wei0);
+        conv0.add_output(mid);
+        conv1.add_input(mid);
+        conv1.add_input(wei1);
+        conv1.add_output(dst);
+
+        graph::graph_t agraph(engine->kind());
+        agraph.add_op(&conv0);
+        agraph.add_op(&conv1);
+        agraph.finalize();
+
+        std::vector<graph::logical_tensor_t> lt_ins {src, wei0, wei1};
+        std::vector<graph::logical_tensor_t> lt_outs {dst};
+        const graph::fpmath_t fpm {fpmath_mode::strict, false};
+        auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+                agraph.get_ops(), p_eng, fpm, use_blocked, true);
+        EXPECT_EQ(
+                dnnl_impl::set_given_inputs_outputs(subgraph, lt_ins, lt_outs),
+                graph::status::success);
+        EXPECT_EQ(dnnl_impl::lower_down(subgraph), graph::status::success);
+        dnnl_impl::subgraph_validator_t validator;
+        validator.run(subgraph); // validate and set default param
+        EXPECT_EQ(dnnl_impl::infer_shape(subgraph), graph::status::success);
+        EXPECT_EQ(dnnl_impl::insert_permute_for_conv_or_deconv(subgraph),
+                graph::status::success);
+        if (assign) {
+            EXPECT_EQ(dnnl_impl::layout_assignment(subgraph),
+                    graph::status::success);
+            if (!use_blocked) {
+                for (const auto &op : subgraph->get_ops()) {
+                    EXPECT_FALSE(op->has_attr(
+                                         dnnl_impl::op_attr::use_plain_layout)
+                            && op->get_attr<bool>(
+                                    dnnl_impl::op_attr::use_plain_layout));
+                }
+            }
+        }
+        EXPECT_EQ(dnnl_impl::layout_propagation(subgraph),
+                graph::status::success);
+
+        return std::count_if(subgraph->get_ops().begin(),
+                subgraph->get_ops().end(), [](const op_ptr &op) {
+                    return op->get_kind() == dnnl_impl::op_kind::dnnl_reorder;
+                });
+    };
+
+    ASSERT_EQ(count_reorders(true, false), count_reorders(false, false));
+
+    // When the first convolution prefers a blocked layout, the layout
+    // propagation alone reorders the subgraph input and output, while the
+    // layout assignment keeps the whole chain in nxc.
+    using mdesc = dnnl::memory::desc;
+    using tag = dnnl::memory::format_tag;
+    const auto f32 = dnnl::memory::data_type::f32;
+    const dnnl::memory::dims conv0_src_dims {2, ic, 14, 14};
+    const dnnl::memory::dims conv0_wei_dims {oc, ic, 1, 1};
+    const dnnl::memory::dims conv0_dst_dims {2, oc, 7, 7};
+    auto conv0_pd = dnnl::convolution_forward::primitive_desc(p_eng,
+            dnnl::prop_kind::forward_inference,
+            dnnl::algorithm::convolution_direct,
+            mdesc(conv0_src_dims, f32, tag::any),
+            mdesc(conv0_wei_dims, f32, tag::any),
+            mdesc(conv0_dst_dims, f32, tag::any), {2, 2}, {0, 0}, {0, 0});
+    const bool prefers_blocked = conv0_pd.src_desc()
+            != mdesc(conv0_src_dims, f32, tag::nhwc);
+    if (prefers_blocked) {
+        ASSERT_LT(count_reorders(true, true), count_reorders(false, true));
+    } else {
+        ASSERT_EQ(count_reorders(true, true), count_reorders(false, true));
+    }
+}
+
 TEST(test_subgraph_pass, Int8ConvSumRelu) {
     /*
                    | (f32, constant)
@@ -2057,6 +2167,181 @@ TEST(test_subgraph_pass, CommonReorderElimination) {
     ASSERT_EQ(subgraph->get_ops().size(), 3U);
 }
 
+namespace {
+
+// Returns the implementation of the matmul of the subgraph, as set in the pd
+// cache by the layout propagation.
+std::string get_matmul_impl_info(
+        const std::shared_ptr<graph::dnnl_impl::subgraph_t> &sg) {
+    for (const auto &op : sg->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_matmul) continue;
+        const auto pd = graph::utils::any_cast<dnnl::matmul::primitive_desc>(
+                sg->pd_cache_.at(op.get()));
+        return pd.impl_info_str();
+    }
+    return std::string();
+}
+
+} // namespace
+
+TEST(test_subgraph_pass, FoldReorderIntoMatmul) {
+    graph::engine_t &g_eng = *get_engine();
+    dnnl::engine p_eng = graph::dnnl_impl::make_dnnl_engine(g_eng);
+
+    // The reorder turns a transposed src into a plain one, which the matmul
+    // can read directly.
+    const std::vector<int64_t> src_strides {1, 16};
+    auto src = logical_tensor_init(
+            0, {16, 32}, src_strides, graph::data_type::f32);
+    auto src_plain = logical_tensor_init(1, {16, 32}, graph::data_type::f32);
+    auto wei = logical_tensor_init(2, {32, 64}, graph::data_type::f32);
+    auto dst = logical_tensor_init(3, {16, 64}, graph::data_type::f32);
+
+    graph::op_t reorder {0, graph::op_kind::Reorder, "reorder"};
+    reorder.add_input(src);
+    reorder.add_output(src_plain);
+    graph::op_t matmul {1, graph::op_kind::MatMul, "matmul"};
+    matmul.add_input(src_plain);
+    matmul.add_input(wei);
+    matmul.add_output(dst);
+
+    graph::graph_t g;
+    g.add_op(&reorder);
+    g.add_op(&matmul);
+    g.finalize();
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<graph::dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, /* reset_layout */ false);
+
+    ASSERT_EQ(dnnl_impl::lower_down(subgraph), graph::status::success);
+    dnnl_impl::subgraph_validator_t validator;
+    validator.run(subgraph); // validate and set default param
+    ASSERT_EQ(dnnl_impl::infer_shape(subgraph), graph::status::success);
+    ASSERT_EQ(dnnl_impl::layout_propagation(subgraph), graph::status::success);
+    ASSERT_EQ(subgraph->get_ops().size(), 2U);
+    const std::string impl_info = get_matmul_impl_info(subgraph);
+    ASSERT_EQ(dnnl_impl::fuse_adjacent_reorders(subgraph),
+            graph::status::success);
+
+    // The A copy kernel of brgemm matmul reads a transposed src, so the
+    // reorder has to be folded with it. Other implementations may not take
+    // the transposed src and keep the reorder.
+    const bool is_brgemm = impl_info.find("brg") != std::string::npos;
+    if (is_brgemm) { ASSERT_EQ(subgraph->get_ops().size(), 1U); }
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_matmul) continue;
+        const auto in_lt = op->get_input_value(0)->get_logical_tensor();
+        if (subgraph->get_ops().size() == 1U) {
+            ASSERT_EQ(in_lt.id, src.id);
+            ASSERT_EQ(graph::logical_tensor_wrapper_t(in_lt).vstrides(),
+                    src_strides);
+            ASSERT_EQ(get_matmul_impl_info(subgraph), impl_info);
+        } else {
+            ASSERT_EQ(in_lt.id, src_plain.id);
+        }
+    }
+}
+
+TEST(test_subgraph_pass, KeepConstantReorderBeforeMatmul) {
+    graph::engine_t &g_eng = *get_engine();
+    dnnl::engine p_eng = graph::dnnl_impl::make_dnnl_engine(g_eng);
+
+    // The reorder of constant weights is computed once and cached, so it's
+    // kept even if the matmul could read the transposed weights.
+    const std::vector<int64_t> wei_strides {1, 32};
+    auto src = logical_tensor_init(0, {16, 32}, graph::data_type::f32);
+    auto wei = logical_tensor_init(
+            1, {32, 64}, wei_strides, graph::data_type::f32);
+    wei.property = graph::property_type::constant;
+    auto wei_plain = logical_tensor_init(2, {32, 64}, graph::data_type::f32);
+    wei_plain.property = graph::property_type::constant;
+    auto dst = logical_tensor_init(3, {16, 64}, graph::data_type::f32);
+
+    graph::op_t reorder {0, graph::op_kind::Reorder, "reorder"};
+    reorder.add_input(wei);
+    reorder.add_output(wei_plain);
+    graph::op_t matmul {1, graph::op_kind::MatMul, "matmul"};
+    matmul.add_input(src);
+    matmul.add_input(wei_plain);
+    matmul.add_output(dst);
+
+    graph::graph_t g;
+    g.add_op(&reorder);
+    g.add_op(&matmul);
+    g.finalize();
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<graph::dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, false, /* reset_layout */ false);
+
+    ASSERT_EQ(dnnl_impl::lower_down(subgraph), graph::status::success);
+    dnnl_impl::subgraph_validator_t validator;
+    validator.run(subgraph); // validate and set default param
+    ASSERT_EQ(dnnl_impl::constant_propagation(subgraph),
+            graph::status::success);
+    ASSERT_EQ(dnnl_impl::infer_shape(subgraph), graph::status::success);
+    ASSERT_EQ(dnnl_impl::layout_propagation(subgraph), graph::status::success);
+    ASSERT_EQ(subgraph->get_ops().size(), 2U);
+    ASSERT_EQ(dnnl_impl::fuse_adjacent_reorders(subgraph),
+            graph::status::success);
+
+    ASSERT_EQ(subgraph->get_ops().size(), 2U);
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_matmul) continue;
+        const auto wei_lt = op->get_input_value(1)->get_logical_tensor();
+        ASSERT_EQ(wei_lt.id, wei_plain.id);
+    }
+}
+
+TEST(test_subgraph_pass, KeepInsertedConstantWeightReorder) {
+    graph::engine_t &g_eng = *get_engine();
+    dnnl::engine p_eng = graph::dnnl_impl::make_dnnl_engine(g_eng);
+
+    // With blocked layouts, the layout propagation inserts a reorder of the
+    // constant weights to the layout picked by the matmul. The reorder isn't
+    // marked as constant yet when the reorders are folded, but it's computed
+    // once in the constant cache and so has to be kept.
+    auto src = logical_tensor_init(0, {16, 32}, graph::data_type::f32);
+    auto wei = logical_tensor_init(1, {32, 64}, graph::data_type::f32);
+    wei.property = graph::property_type::constant;
+    auto dst = logical_tensor_init(2, {16, 64}, graph::data_type::f32);
+
+    graph::op_t matmul {0, graph::op_kind::MatMul, "matmul"};
+    matmul.add_input(src);
+    matmul.add_input(wei);
+    matmul.add_output(dst);
+
+    graph::graph_t g;
+    g.add_op(&matmul);
+    g.finalize();
+    const graph::fpmath_t fpm {fpmath_mode::strict, false};
+    auto subgraph = std::make_shared<graph::dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, fpm, true, /* reset_layout */ false);
+
+    ASSERT_EQ(dnnl_impl::lower_down(subgraph), graph::status::success);
+    dnnl_impl::subgraph_validator_t validator;
+    validator.run(subgraph); // validate and set default param
+    ASSERT_EQ(dnnl_impl::constant_propagation(subgraph),
+            graph::status::success);
+    ASSERT_EQ(dnnl_impl::infer_shape(subgraph), graph::status::success);
+    ASSERT_EQ(dnnl_impl::layout_propagation(subgraph), graph::status::success);
+    const size_t num_ops = subgraph->get_ops().size();
+    ASSERT_EQ(dnnl_impl::fuse_adjacent_reorders(subgraph),
+            graph::status::success);
+
+    // The matmul may take the plain weights, in which case there's no
+    // reorder to keep.
+    ASSERT_EQ(subgraph->get_ops().size(), num_ops);
+    for (const auto &op : subgraph->get_ops()) {
+        if (op->get_kind() != dnnl_impl::op_kind::dnnl_matmul) continue;
+        const auto wei_lt = op->get_input_value(1)->get_logical_tensor();
+        if (num_ops > 1U) {
+            ASSERT_NE(wei_lt.id, wei.id);
+        } else {
+            ASSERT_EQ(wei_lt.id, wei.id);
+        }
+    }
+}
+
 TEST(test_subgraph_pass, CombineBinaryPostOpScales) {
     namespace utils = dnnl::graph::tests::unit::utils;
     dnnl_impl::dnnl_backend_t::get_singleton();
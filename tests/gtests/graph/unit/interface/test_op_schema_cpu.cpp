@@ -1555,6 +1555,37 @@ TEST(test_interface_op_schema, TestMaxpoolDilations) {
             expected_dilations);
 }
 
+TEST(test_interface_op_schema, InferGroupedMatmulOutputShape) {
+    const op_schema_t *op_schema
+            = op_schema_registry_t::get_op_schema(op_kind::GroupedMatMul);
+
+    op_t op {op_kind::GroupedMatMul, op_t::kind2str(op_kind::GroupedMatMul)};
+
+    logical_tensor_t lt_src = logical_tensor_init(0, {37, 64}, data_type::f32);
+    logical_tensor_t lt_wei
+            = logical_tensor_init(1, {4, 64, 96}, data_type::f32);
+    logical_tensor_t lt_off = logical_tensor_init(2, {4}, data_type::s32);
+    std::vector<logical_tensor_t *> lt_in {&lt_src, &lt_wei, &lt_off};
+    logical_tensor_t lt_dst
+            = logical_tensor_init(3, data_type::f32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_out {&lt_dst};
+
+    ASSERT_EQ(op_schema->shape_infer(&op, lt_in, lt_out), status::success);
+    const std::vector<int64_t> expected_out_shape = {37, 96};
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_dst).vdims(), expected_out_shape);
+    EXPECT_EQ(logical_tensor_wrapper_t(lt_dst).vstrides(),
+            compute_dense_strides(expected_out_shape));
+
+    // the number of groups doesn't match the weights
+    logical_tensor_t lt_off_bad = logical_tensor_init(2, {3}, data_type::s32);
+    std::vector<logical_tensor_t *> lt_in_bad {&lt_src, &lt_wei, &lt_off_bad};
+    logical_tensor_t lt_dst_bad
+            = logical_tensor_init(3, data_type::f32, layout_type::strided);
+    std::vector<logical_tensor_t *> lt_out_bad {&lt_dst_bad};
+    EXPECT_EQ(op_schema->shape_infer(&op, lt_in_bad, lt_out_bad),
+            status::invalid_shape);
+}
+
 TEST(test_interface_op_schema, InferMatmulOutputShape) {
     const op_schema_t *matmul_op_schema
             = op_schema_registry_t::get_op_schema(op_kind::MatMul);
@@ -46,6 +46,27 @@ dnnl_status_t DNNL_API sdpa_primitive_desc_create(
         const_dnnl_primitive_attr_t kq_attr,
         const_dnnl_primitive_attr_t vs_attr);
 
+/// Creates a primitive descriptor for a scaled dot product attention primitive
+/// reading keys and values from a paged K/V cache
+///
+/// @param kv_block_table_desc s32 [batch, max_pages] block table mapping
+///     logical key blocks to pages of the key and value pools.
+/// @param kv_seq_len Number of keys in every sequence.
+///
+/// Key and value memory descriptors describe the pools of pages. All other
+/// parameters have the same meaning as in sdpa_primitive_desc_create().
+
+dnnl_status_t DNNL_API sdpa_paged_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t query_desc, const_dnnl_memory_desc_t key_desc,
+        const_dnnl_memory_desc_t value_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t mask_desc, const_dnnl_memory_desc_t scale_desc,
+        const_dnnl_memory_desc_t kv_block_table_desc, dnnl_dim_t kv_seq_len,
+        bool invert_scale, dnnl_dim_t kv_head_number, int attn_mask_type,
+        dnnl_alg_kind_t softmax_alg, const_dnnl_primitive_attr_t attr,
+        const_dnnl_primitive_attr_t kq_attr,
+        const_dnnl_primitive_attr_t vs_attr);
+
 namespace dnnl {
 namespace impl {
 
@@ -81,6 +102,33 @@ struct sdpa : public dnnl::primitive {
                     "primitive");
             reset(pd);
         }
+
+        /// Constructs a primitive descriptor for a sdpa primitive with a
+        /// paged K/V cache.
+        primitive_desc(const engine &aengine, const memory::desc &query_desc,
+                const memory::desc &key_desc, const memory::desc &value_desc,
+                const memory::desc *attn_mask_desc,
+                const memory::desc &scale_desc, const memory::desc &output_desc,
+                const memory::desc &kv_block_table_desc, memory::dim kv_seq_len,
+                bool invert_scale, memory::dim kv_head_number,
+                int attn_mask_type, int softmax_alg,
+                const primitive_attr &attr = default_attr()) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = sdpa_paged_primitive_desc_create(&pd,
+                    aengine.get(), query_desc.get(), key_desc.get(),
+                    value_desc.get(), output_desc.get(),
+                    optional_arg(attn_mask_desc), scale_desc.get(),
+                    kv_block_table_desc.get(), kv_seq_len, invert_scale,
+                    kv_head_number, attn_mask_type,
+                    (dnnl_alg_kind_t)softmax_alg, attr.get(), nullptr,
+                    nullptr);
+
+            dnnl::error::wrap_c_api(status,
+                    "could not create a primitive descriptor for a sdpa "
+                    "primitive");
+            reset(pd);
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -287,4 +287,97 @@ TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
 
+TEST(brgemm_kernel_cache_test, TestKernelSharing) {
+    using namespace impl::cpu::x64;
+
+    SKIP_IF(get_primitive_cache_capacity() == 0, "Kernel cache is disabled.");
+
+    const auto init_desc = [](brgemm_desc_t &desc, impl::dim_t N) {
+        auto res = brgemm_desc_init(&desc, cpu_isa_t::isa_undef, brgemm_addr,
+                dnnl_f32, dnnl_f32, false, false, brgemm_row_major, 1.f, 0.f,
+                64, 64, 64, 16, N, 64);
+        if (res != dnnl_success) return res;
+        brgemm_attr_t attr;
+        attr.max_bs = 1;
+        res = brgemm_desc_set_attr(&desc, attr);
+        if (res != dnnl_success) return res;
+        return brgemm_desc_finalize(&desc);
+    };
+
+    brgemm_desc_t desc0, desc1, desc2;
+    SKIP_IF(init_desc(desc0, 16) != dnnl_success,
+            "Brgemm is not supported on this platform.");
+    ASSERT_EQ(init_desc(desc1, 16), dnnl_success);
+    ASSERT_EQ(init_desc(desc2, 32), dnnl_success);
+
+    // Equal descriptors share the kernel.
+    std::shared_ptr<brgemm_kernel_t> ker0, ker1, ker2;
+    ASSERT_EQ(brgemm_kernel_get_or_create(ker0, desc0), dnnl_success);
+    ASSERT_EQ(brgemm_kernel_get_or_create(ker1, desc1), dnnl_success);
+    ASSERT_EQ(brgemm_kernel_get_or_create(ker2, desc2), dnnl_success);
+    ASSERT_EQ(ker0.get(), ker1.get());
+    ASSERT_NE(ker0.get(), ker2.get());
+}
+
+TEST(brgemm_kernel_cache_test, TestGemvIsNotShared) {
+    using namespace impl::cpu::x64;
+
+    SKIP_IF(get_primitive_cache_capacity() == 0, "Kernel cache is disabled.");
+
+    // brgemv_desc_init() initializes the same descriptor as
+    // brgemm_desc_init() with N = 1 and then marks it as a gemv.
+    constexpr impl::dim_t M = 16, K = 64;
+    brgemm_attr_t attr;
+    attr.max_bs = 1;
+    brgemm_desc_t gemm_desc, gemv_desc;
+    SKIP_IF(brgemv_desc_init(&gemv_desc, cpu_isa_t::isa_undef, brgemm_addr,
+                    dnnl_f32, dnnl_f32, false, 1.f, 0.f, K, 1, M, K)
+                    != dnnl_success,
+            "Brgemv is not supported on this platform.");
+    ASSERT_EQ(brgemm_desc_set_attr(&gemv_desc, attr), dnnl_success);
+    ASSERT_EQ(brgemm_desc_finalize(&gemv_desc), dnnl_success);
+
+    ASSERT_EQ(brgemm_desc_init(&gemm_desc, cpu_isa_t::isa_undef, brgemm_addr,
+                      dnnl_f32, dnnl_f32, false, false, brgemm_row_major, 1.f,
+                      0.f, K, 1, 1, M, 1, K),
+            dnnl_success);
+    ASSERT_EQ(brgemm_desc_set_attr(&gemm_desc, attr), dnnl_success);
+    ASSERT_EQ(brgemm_desc_finalize(&gemm_desc), dnnl_success);
+
+    std::shared_ptr<brgemm_kernel_t> gemm_ker, gemv_ker;
+    ASSERT_EQ(brgemm_kernel_get_or_create(gemv_ker, gemv_desc), dnnl_success);
+    ASSERT_EQ(brgemm_kernel_get_or_create(gemm_ker, gemm_desc), dnnl_success);
+    ASSERT_NE(gemm_ker.get(), gemv_ker.get());
+}
+
+TEST(brgemm_kernel_cache_test, TestFusedCopyAIsNotShared) {
+    using namespace impl::cpu::x64;
+
+    SKIP_IF(get_primitive_cache_capacity() == 0, "Kernel cache is disabled.");
+    SKIP_IF(!dnnl::mayiuse(cpu_isa::avx512_core_amx),
+            "Fused copy of A requires AMX.");
+
+    const auto init_desc = [](brgemm_desc_t &desc, bool fused_copy_a) {
+        auto res = brgemm_desc_init(&desc, cpu_isa_t::avx512_core_amx,
+                brgemm_addr, dnnl_bf16, dnnl_bf16, false, false,
+                brgemm_row_major, 1.f, 0.f, 64, 32, 32, 32, 32, 64);
+        if (res != dnnl_success) return res;
+        brgemm_attr_t attr;
+        attr.max_bs = 1;
+        attr.hint_fused_copy_a = fused_copy_a;
+        res = brgemm_desc_set_attr(&desc, attr);
+        if (res != dnnl_success) return res;
+        return brgemm_desc_finalize(&desc);
+    };
+
+    brgemm_desc_t desc, fused_desc;
+    ASSERT_EQ(init_desc(desc, false), dnnl_success);
+    ASSERT_EQ(init_desc(fused_desc, true), dnnl_success);
+
+    std::shared_ptr<brgemm_kernel_t> ker, fused_ker;
+    ASSERT_EQ(brgemm_kernel_get_or_create(ker, desc), dnnl_success);
+    ASSERT_EQ(brgemm_kernel_get_or_create(fused_ker, fused_desc), dnnl_success);
+    ASSERT_NE(ker.get(), fused_ker.get());
+}
+
 } // namespace dnnl
@@ -160,4 +160,107 @@ CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_t,
                 np_t {{4, 1, 4, 5, 2}}, np_t {{4, 3, 0, 3, 0, 1}},
                 np_t {{2, 1, 3, 1, 2, 1}}, np_t {{4, 1, 4, 3, 2, 2}}));
 
+TEST(test_balance_weighted, Test) {
+    const float weights[] = {1.f, 1.f, 0.5f, 0.5f, 0.f, 1.f};
+    const int nthr = 6;
+    for (ptrdiff_t n : {0, 1, 7, 100, 1000003}) {
+        ptrdiff_t prev_end = 0;
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            ptrdiff_t start {0}, end {0};
+            impl::balance211(n, nthr, ithr, weights, start, end);
+            ASSERT_EQ(start, prev_end);
+            ASSERT_LE(start, end);
+            if (weights[ithr] == 0.f) { ASSERT_EQ(start, end); }
+            prev_end = end;
+        }
+        ASSERT_EQ(prev_end, n);
+    }
+
+    // Threads of the same group split the rows, groups split the columns.
+    const ptrdiff_t ny = 90, nx = 30;
+    for (ptrdiff_t nx_divider : {1, 2, 4}) {
+        std::vector<int> visits(ny * nx, 0);
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            ptrdiff_t ys {0}, ye {0}, xs {0}, xe {0};
+            impl::balance2D(
+                    nthr, ithr, ny, ys, ye, nx, xs, xe, nx_divider, weights);
+            for_(ptrdiff_t y = ys; y < ye; y++)
+            for (ptrdiff_t x = xs; x < xe; x++)
+                visits[y * nx + x]++;
+        }
+        for (int v : visits)
+            ASSERT_EQ(v, 1);
+    }
+}
+
+TEST(test_parallel_dynamic, Test) {
+    // Uneven iteration costs make threads steal chunks from each other.
+    const ptrdiff_t work_amount = 1000;
+    std::vector<int> visits(work_amount, 0);
+    impl::parallel_dynamic(0, work_amount,
+            [&](int ithr, int nthr, ptrdiff_t start, ptrdiff_t end) {
+                ASSERT_LE(0, ithr);
+                ASSERT_LT(ithr, nthr);
+                ASSERT_LE(0, start);
+                ASSERT_LT(start, end);
+                ASSERT_LE(end, work_amount);
+                for (ptrdiff_t i = start; i < end; ++i) {
+                    volatile float x = 0.f;
+                    for (ptrdiff_t j = 0; j < i * (ithr + 1); ++j)
+                        x = x + 1.f;
+                    visits[i]++;
+                }
+            });
+    for (ptrdiff_t i = 0; i < work_amount; ++i)
+        ASSERT_EQ(visits[i], 1);
+}
+
+class test_parallel_nd_dynamic_t : public test_nd_t {
+protected:
+    void emit_parallel_nd_dynamic() {
+        switch ((int)p.dims.size()) {
+            case 1:
+                impl::parallel_nd_dynamic(p.dims[0], [&](ptrdiff_t d0) {
+                    ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                    data[d0] = d0;
+                });
+                break;
+            case 2:
+                impl::parallel_nd_dynamic(
+                        p.dims[0], p.dims[1], [&](ptrdiff_t d0, ptrdiff_t d1) {
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            const ptrdiff_t idx = d0 * p.dims[1] + d1;
+                            data[idx] = idx;
+                        });
+                break;
+            case 3:
+                impl::parallel_nd_dynamic_ext(0, p.dims[0], p.dims[1],
+                        p.dims[2],
+                        [&](int ithr, int nthr, ptrdiff_t d0, ptrdiff_t d1,
+                                ptrdiff_t d2) {
+                            ASSERT_TRUE(0 <= ithr && ithr < nthr);
+                            ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
+                            ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
+                            ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
+                            const ptrdiff_t idx
+                                    = (d0 * p.dims[1] + d1) * p.dims[2] + d2;
+                            data[idx] = idx;
+                        });
+                break;
+            default: ASSERT_TRUE(false);
+        }
+    }
+};
+
+TEST_P(test_parallel_nd_dynamic_t, Test) {
+    emit_parallel_nd_dynamic();
+    CheckID();
+}
+
+CPU_INSTANTIATE_TEST_SUITE_P(Case, test_parallel_nd_dynamic_t,
+        ::testing::Values(np_t {{0}}, np_t {{1}}, np_t {{100}}, np_t {{0, 0}},
+                np_t {{1, 2}}, np_t {{10, 10}}, np_t {{0, 1, 0}},
+                np_t {{1, 2, 1}}, np_t {{4, 4, 10}}, np_t {{17, 3, 31}}));
+
 } // namespace dnnl
@@ -0,0 +1,181 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace {
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+} // namespace
+
+namespace dnnl {
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+// The wavefront mode of the brgemm-based cells is forced on and off with
+// the internal _ONEDNN_RNN_WAVEFRONT variable, read at each primitive
+// descriptor creation. Both modes have to compute the same result.
+class rnn_wavefront_test_t : public ::testing::TestWithParam<algorithm> {
+protected:
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Wavefront execution is implemented for CPU only.");
+        SKIP_IF(dnnl_get_max_threads() < 2,
+                "Wavefront execution needs several threads.");
+        // Primitives with the same descriptor would be shared by the cache
+        // regardless of the mode.
+        cache_capacity_ = get_primitive_cache_capacity();
+        set_primitive_cache_capacity(0);
+    }
+
+    void TearDown() override {
+        custom_setenv("_ONEDNN_RNN_WAVEFRONT", "-1", 1);
+        if (cache_capacity_ >= 0) set_primitive_cache_capacity(cache_capacity_);
+    }
+
+    // Creates and executes the primitive with the wavefront mode set to
+    // `mode`, returns the destination layer or an empty vector if the
+    // brgemm-based implementation isn't used.
+    std::vector<float> execute(algorithm alg, const char *mode) {
+        custom_setenv("_ONEDNN_RNN_WAVEFRONT", mode, 1);
+
+        engine eng(engine::kind::cpu, 0);
+        const bool is_lstm = alg == algorithm::vanilla_lstm;
+        const memory::dim G = is_lstm ? 4 : 1;
+        memory::desc src_layer_md({T, N, C}, dt::f32, tag::tnc);
+        memory::desc src_iter_md({L, D, N, C}, dt::f32, tag::ldnc);
+        memory::desc wei_layer_md({L, D, C, G, C}, dt::f32, tag::any);
+        memory::desc wei_iter_md({L, D, C, G, C}, dt::f32, tag::any);
+        memory::desc bias_md({L, D, G, C}, dt::f32, tag::ldgo);
+        memory::desc dst_layer_md({T, N, D * C}, dt::f32, tag::tnc);
+        memory::desc dst_iter_md({L, D, N, C}, dt::f32, tag::ldnc);
+        const auto dir = rnn_direction::bidirectional_concat;
+        const auto pk = prop_kind::forward_inference;
+
+        primitive prim;
+        memory::desc wei_layer_pd_md, wei_iter_pd_md;
+        std::string impl_info;
+        if (is_lstm) {
+            auto pd = lstm_forward::primitive_desc(eng, pk, dir, src_layer_md,
+                    src_iter_md, src_iter_md, wei_layer_md, wei_iter_md,
+                    bias_md, dst_layer_md, dst_iter_md, dst_iter_md);
+            prim = lstm_forward(pd);
+            wei_layer_pd_md = pd.weights_layer_desc();
+            wei_iter_pd_md = pd.weights_iter_desc();
+            impl_info = pd.impl_info_str();
+        } else {
+            auto pd = vanilla_rnn_forward::primitive_desc(eng, pk,
+                    algorithm::eltwise_tanh, dir, src_layer_md, src_iter_md,
+                    wei_layer_md, wei_iter_md, bias_md, dst_layer_md,
+                    dst_iter_md);
+            prim = vanilla_rnn_forward(pd);
+            wei_layer_pd_md = pd.weights_layer_desc();
+            wei_iter_pd_md = pd.weights_iter_desc();
+            impl_info = pd.impl_info_str();
+        }
+        if (impl_info.find("brgemm") == std::string::npos) return {};
+
+        stream strm(eng);
+        auto make_mem = [&](const memory::desc &md, float scale) {
+            memory mem(md, eng);
+            auto *ptr = static_cast<float *>(mem.get_data_handle());
+            const size_t nelems = md.get_size() / sizeof(float);
+            for (size_t i = 0; i < nelems; ++i)
+                ptr[i] = scale * std::sin(0.37f * static_cast<float>(i));
+            return mem;
+        };
+        auto make_weights = [&](const memory::desc &pd_md, float scale) {
+            memory::desc plain_md(pd_md.get_dims(), dt::f32, tag::ldigo);
+            auto plain = make_mem(plain_md, scale);
+            memory mem(pd_md, eng);
+            reorder(plain, mem).execute(strm, plain, mem);
+            return mem;
+        };
+
+        auto src_layer = make_mem(src_layer_md, 1.f);
+        auto src_iter = make_mem(src_iter_md, 0.5f);
+        auto src_iter_c = make_mem(src_iter_md, 0.25f);
+        auto wei_layer = make_weights(wei_layer_pd_md, 0.1f);
+        auto wei_iter = make_weights(wei_iter_pd_md, 0.1f);
+        auto bias = make_mem(bias_md, 0.2f);
+        memory dst_layer(dst_layer_md, eng);
+        memory dst_iter(dst_iter_md, eng);
+        memory dst_iter_c(dst_iter_md, eng);
+
+        std::unordered_map<int, memory> args {{DNNL_ARG_SRC_LAYER, src_layer},
+                {DNNL_ARG_SRC_ITER, src_iter},
+                {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                {DNNL_ARG_WEIGHTS_ITER, wei_iter}, {DNNL_ARG_BIAS, bias},
+                {DNNL_ARG_DST_LAYER, dst_layer}, {DNNL_ARG_DST_ITER, dst_iter}};
+        if (is_lstm) {
+            args.insert({DNNL_ARG_SRC_ITER_C, src_iter_c});
+            args.insert({DNNL_ARG_DST_ITER_C, dst_iter_c});
+        }
+        prim.execute(strm, args);
+        strm.wait();
+
+        const auto *ptr = static_cast<const float *>(
+                dst_layer.get_data_handle());
+        return std::vector<float>(ptr, ptr + T * N * D * C);
+    }
+
+    // Several layers and both directions give a grid of cells to schedule,
+    // the small batch leaves a single block per cell.
+    const memory::dim L = 3, D = 2, T = 5, N = 2, C = 32;
+    int cache_capacity_ = -1;
+};
+
+TEST_P(rnn_wavefront_test_t, TestMatchesSequential) {
+    const algorithm alg = GetParam();
+    const auto wavefront = execute(alg, "1");
+    const auto sequential = execute(alg, "0");
+    if (wavefront.empty() || sequential.empty()) return;
+
+    ASSERT_EQ(wavefront.size(), sequential.size());
+    for (size_t i = 0; i < wavefront.size(); ++i)
+        ASSERT_NEAR(wavefront[i], sequential[i], 1e-6f) << "index " << i;
+}
+
+INSTANTIATE_TEST_SUITE_P(TestRnnWavefront, rnn_wavefront_test_t,
+        ::testing::Values(algorithm::vanilla_lstm, algorithm::vanilla_rnn));
+#endif
+
+} // namespace dnnl
@@ -1805,6 +1805,29 @@ memory::format_tag no_key_transposed = memory::format_tag::abcd;
 using sdpa_test = sdpa_test_t<sdpa_dims_t>;
 using sdpa_test_datatypes = sdpa_test_t<sdpa_dims_t_tuple>;
 
+// CPU implementations are validated against the same matmul and softmax based
+// reference, but on a CPU engine.
+class sdpa_test_cpu : public sdpa_test_t<sdpa_dims_t_tuple> {
+public:
+    static void SetUpTestSuite() {}
+    static void TearDownTestSuite() {}
+
+    void SetUp() override {
+#ifdef DNNL_TEST_WITH_ENGINE_PARAM
+        SKIP_IF(get_test_engine_kind() != dnnl::engine::kind::cpu,
+                "This test requires CPU engine");
+        eng = get_test_engine();
+#else
+        eng = dnnl::engine(engine::kind::cpu, 0);
+#endif
+        strm = dnnl::stream(eng);
+        p = GetParam();
+        doubled_memory.reserve(30);
+        t = get_descriptors(eng, strm, p, doubled_memory);
+        scale_dt = t.m_query.get_desc().get_data_type();
+    }
+};
+
 // clang-format off
 
 INSTANTIATE_TEST_SUITE_P(ScaleTypes_f16, sdpa_test_datatypes,
@@ -2071,8 +2094,215 @@ INSTANTIATE_TEST_SUITE_P(phi3_mini_4k_instruct,
                     sdpa_dims_t{   1,     32,       32,   2049,       1,     96,     96,      96, mdt::f16, mdt::s8,  mdt::f16, mdt::s8,  mdt::s8, mdt::f16, mdt::s8, mdt::f16, quantize_type::per_token_with_groups,  with_key_transposed, mask_type::twoD }
     ), &print_to_string);
 
+INSTANTIATE_TEST_SUITE_P(CPU_f32, sdpa_test_cpu,
+        testing::Combine(testing::Values(1, 2), // mb
+                testing::Values(num_heads_t {2, 2}, num_heads_t {4, 2}), // hd_num
+                testing::Values(seq_len_size_t {37, 37}, seq_len_size_t {1, 97}, seq_len_size_t {70, 130}), // seq_len
+                testing::Values(head_group_size_t {64, 64, 64}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::f32)), // dt
+                testing::Values(tensor_type_t("K", mdt::f32)), // kdt
+                testing::Values(tensor_type_t("V", mdt::f32)), // vdt
+                testing::Values(quantize_type::no_quantization), // qtype
+                testing::Values(dnnl::memory::format_tag::abcd, dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::causal_tl}, mask_config_t {mask_type::causal_br}, mask_config_t {mask_type::oneD, mdt::f32}, mask_config_t {mask_type::twoD, mdt::f32}), // mask_type
+                testing::Values(scale_type::device_side, scale_type::host_side), // scale_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
+INSTANTIATE_TEST_SUITE_P(CPU_bf16, sdpa_test_cpu,
+        testing::Combine(testing::Values(1), // mb
+                testing::Values(num_heads_t {2, 2}, num_heads_t {4, 2}), // hd_num
+                testing::Values(seq_len_size_t {37, 37}, seq_len_size_t {1, 97}, seq_len_size_t {70, 130}), // seq_len
+                testing::Values(head_group_size_t {64, 64, 64}), // hd_size
+                testing::Values(tensor_type_t("Q", mdt::bf16)), // dt
+                testing::Values(tensor_type_t("K", mdt::bf16)), // kdt
+                testing::Values(tensor_type_t("V", mdt::bf16)), // vdt
+                testing::Values(quantize_type::no_quantization), // qtype
+                testing::Values(dnnl::memory::format_tag::abcd, dnnl::memory::format_tag::abdc), // key_format_tag
+                testing::Values(mask_config_t {mask_type::no_mask}, mask_config_t {mask_type::causal_br}, mask_config_t {mask_type::twoD, mdt::bf16}), // mask_type
+                testing::Values(default_scale_type), // scale_type
+                testing::Values(accumulation_t {accumulation_mode::f32, accumulation_mode::f32}) // accumulation_mode
+                ),
+        &print_to_string2);
+
 // clang-format on
 
+CPU_TEST_P(sdpa_test_cpu, compare) {
+    compare();
+}
+
+// Checks that reading K and V through a block table matches the results for
+// the same keys and values stored contiguously.
+class sdpa_paged_kv_test_cpu
+    : public ::testing::TestWithParam<std::tuple<mask_type, memory::dim>> {};
+
+CPU_TEST_P(sdpa_paged_kv_test_cpu, compare) {
+    using namespace dnnl::impl;
+    const mask_type mask = std::get<0>(GetParam());
+    const memory::dim M = std::get<1>(GetParam());
+    const memory::dim MB = 2, H = 4, H_kv = 2, N = 100, D = 64;
+    const memory::dim page_size = 16;
+    const memory::dim max_pages = (N + page_size - 1) / page_size;
+    const memory::dim pages = MB * max_pages + 3;
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+
+    using tag = memory::format_tag;
+    memory::desc q_md({MB, H, M, D}, mdt::f32, tag::abcd);
+    memory::desc k_md({MB, H_kv, D, N}, mdt::f32, tag::abdc);
+    memory::desc v_md({MB, H_kv, N, D}, mdt::f32, tag::abcd);
+    memory::desc k_pool_md({pages, H_kv, D, page_size}, mdt::f32, tag::abdc);
+    memory::desc v_pool_md({pages, H_kv, page_size, D}, mdt::f32, tag::abcd);
+    memory::desc bt_md({MB, max_pages}, mdt::s32, tag::ab);
+    memory::desc dst_md({MB, H, M, D}, mdt::f32, tag::abcd);
+    memory::desc scale_md({1, 1, 1, 1}, mdt::f32, tag::abcd);
+
+    memory q(q_md, eng), k(k_md, eng), v(v_md, eng), k_pool(k_pool_md, eng),
+            v_pool(v_pool_md, eng), bt(bt_md, eng), scale(scale_md, eng),
+            dst(dst_md, eng), dst_paged(dst_md, eng);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    auto fill = [&](memory &mem) {
+        float *ptr = static_cast<float *>(mem.get_data_handle());
+        for (size_t i = 0; i < mem.get_desc().get_size() / sizeof(float); i++)
+            ptr[i] = dist(gen);
+    };
+    fill(q);
+    fill(k);
+    fill(v);
+    fill(k_pool);
+    fill(v_pool);
+    *static_cast<float *>(scale.get_data_handle()) = 8.f;
+
+    // Scatter logical pages of every batch entry over the pool in reverse
+    // order, so that neighbouring blocks never share a page.
+    int32_t *bt_ptr = static_cast<int32_t *>(bt.get_data_handle());
+    for (memory::dim mb = 0; mb < MB; mb++)
+        for (memory::dim p = 0; p < max_pages; p++)
+            bt_ptr[mb * max_pages + p]
+                    = static_cast<int32_t>(pages - 1 - (mb * max_pages + p));
+
+    const float *k_ptr = static_cast<float *>(k.get_data_handle());
+    const float *v_ptr = static_cast<float *>(v.get_data_handle());
+    float *k_pool_ptr = static_cast<float *>(k_pool.get_data_handle());
+    float *v_pool_ptr = static_cast<float *>(v_pool.get_data_handle());
+    const auto k_str = k_md.get_strides(), v_str = v_md.get_strides();
+    const auto kp_str = k_pool_md.get_strides(),
+               vp_str = v_pool_md.get_strides();
+    for_(memory::dim mb = 0; mb < MB; mb++)
+    for_(memory::dim h = 0; h < H_kv; h++)
+    for_(memory::dim n = 0; n < N; n++)
+    for (memory::dim d = 0; d < D; d++) {
+        const memory::dim page = bt_ptr[mb * max_pages + n / page_size];
+        const memory::dim pn = n % page_size;
+        k_pool_ptr[page * kp_str[0] + h * kp_str[1] + d * kp_str[2]
+                + pn * kp_str[3]]
+                = k_ptr[mb * k_str[0] + h * k_str[1] + d * k_str[2]
+                        + n * k_str[3]];
+        v_pool_ptr[page * vp_str[0] + h * vp_str[1] + pn * vp_str[2]
+                + d * vp_str[3]]
+                = v_ptr[mb * v_str[0] + h * v_str[1] + n * v_str[2]
+                        + d * v_str[3]];
+    }
+
+    const int mask_kind = to_attn_mask_type(mask);
+    const int softmax_alg = alg_kind::softmax_accurate_inf_as_zero;
+    sdpa::primitive_desc pd, paged_pd;
+    try {
+        pd = sdpa::primitive_desc(eng, q_md, k_md, v_md, nullptr, scale_md,
+                dst_md, true, H_kv, mask_kind, softmax_alg);
+        paged_pd = sdpa::primitive_desc(eng, q_md, k_pool_md, v_pool_md,
+                nullptr, scale_md, dst_md, bt_md, N, true, H_kv, mask_kind,
+                softmax_alg);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    sdpa(pd).execute(strm,
+            {{DNNL_ARG_QUERIES, q}, {DNNL_ARG_KEYS, k}, {DNNL_ARG_VALUES, v},
+                    {DNNL_ARG_SCALE, scale}, {DNNL_ARG_DST, dst}});
+    sdpa(paged_pd).execute(strm,
+            {{DNNL_ARG_QUERIES, q}, {DNNL_ARG_KEYS, k_pool},
+                    {DNNL_ARG_VALUES, v_pool}, {DNNL_ARG_SCALE, scale},
+                    {DNNL_ARG_KV_BLOCK_TABLE, bt}, {DNNL_ARG_DST, dst_paged}});
+    strm.wait();
+
+    check_memory<float>(strm, dst, dst_paged, 1e-5f, 1e-5f);
+}
+
+INSTANTIATE_TEST_SUITE_P(PagedKV, sdpa_paged_kv_test_cpu,
+        testing::Combine(testing::Values(mask_type::no_mask,
+                                 mask_type::causal_tl, mask_type::causal_br),
+                testing::Values(1, 7, 40)));
+
+// Checks that a block table entry out of the K/V pool is rejected instead of
+// being read as a batch index.
+TEST(sdpa_paged_kv_block_table_test, BadEntry_CPU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Paged K/V cache is tested on CPU only.");
+    using namespace dnnl::impl;
+    const memory::dim MB = 2, H = 2, M = 4, N = 40, D = 32;
+    const memory::dim page_size = 16;
+    const memory::dim max_pages = (N + page_size - 1) / page_size;
+    const memory::dim pages = MB * max_pages;
+
+    dnnl::engine eng(engine::kind::cpu, 0);
+    dnnl::stream strm(eng);
+
+    using tag = memory::format_tag;
+    memory::desc q_md({MB, H, M, D}, mdt::f32, tag::abcd);
+    memory::desc k_pool_md({pages, H, D, page_size}, mdt::f32, tag::abdc);
+    memory::desc v_pool_md({pages, H, page_size, D}, mdt::f32, tag::abcd);
+    memory::desc bt_md({MB, max_pages}, mdt::s32, tag::ab);
+    memory::desc dst_md({MB, H, M, D}, mdt::f32, tag::abcd);
+    memory::desc scale_md({1, 1, 1, 1}, mdt::f32, tag::abcd);
+
+    sdpa::primitive_desc pd;
+    try {
+        pd = sdpa::primitive_desc(eng, q_md, k_pool_md, v_pool_md, nullptr,
+                scale_md, dst_md, bt_md, N, true, H,
+                to_attn_mask_type(mask_type::no_mask),
+                alg_kind::softmax_accurate_inf_as_zero);
+    } catch (const dnnl::error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Unimplemented: " << e.what();
+        throw;
+    }
+
+    memory q(q_md, eng), k_pool(k_pool_md, eng), v_pool(v_pool_md, eng),
+            bt(bt_md, eng), scale(scale_md, eng), dst(dst_md, eng);
+    for (auto *mem : {&q, &k_pool, &v_pool, &scale}) {
+        float *ptr = static_cast<float *>(mem->get_data_handle());
+        for (size_t i = 0; i < mem->get_desc().get_size() / sizeof(float);
+                i++)
+            ptr[i] = 0.5f;
+    }
+
+    const std::unordered_map<int, memory> args {{DNNL_ARG_QUERIES, q},
+            {DNNL_ARG_KEYS, k_pool}, {DNNL_ARG_VALUES, v_pool},
+            {DNNL_ARG_SCALE, scale}, {DNNL_ARG_KV_BLOCK_TABLE, bt},
+            {DNNL_ARG_DST, dst}};
+    int32_t *bt_ptr = static_cast<int32_t *>(bt.get_data_handle());
+    for (const int32_t bad_page : {static_cast<int32_t>(pages), -1}) {
+        for (memory::dim i = 0; i < MB * max_pages; i++)
+            bt_ptr[i] = static_cast<int32_t>(i);
+        // The last page of the second batch entry holds the last keys.
+        bt_ptr[MB * max_pages - 1] = bad_page;
+        try {
+            sdpa(pd).execute(strm, args);
+            strm.wait();
+            FAIL() << "Block table entry " << bad_page << " was accepted.";
+        } catch (const dnnl::error &e) {
+            ASSERT_EQ(e.status, dnnl_invalid_arguments);
+        }
+    }
+}
+
 GPU_TEST_P(sdpa_test, compare) {
     compare();
 }
@@ -0,0 +1,205 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "stdlib.h"
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#include "src/common/tuning_db.hpp"
+
+#if DNNL_X64
+#include "src/cpu/x64/matmul/brgemm_matmul_utils.hpp"
+#endif
+
+namespace {
+
+void custom_setenv(const char *name, const char *value, int overwrite) {
+#ifdef _WIN32
+    auto status = SetEnvironmentVariable(name, value);
+    EXPECT_NE(status, 0);
+#else
+    auto status = ::setenv(name, value, overwrite);
+    EXPECT_EQ(status, 0);
+#endif
+}
+
+void write_file(const char *path, const std::string &content) {
+    FILE *f = fopen(path, "w");
+    ASSERT_NE(f, nullptr);
+    fputs(content.c_str(), f);
+    fclose(f);
+}
+
+std::vector<std::string> read_lines(const char *path) {
+    std::vector<std::string> lines;
+    FILE *f = fopen(path, "r");
+    if (!f) return lines;
+    char line[2048];
+    while (fgets(line, sizeof(line), f))
+        lines.emplace_back(line);
+    fclose(f);
+    return lines;
+}
+
+} // namespace
+
+namespace dnnl {
+
+using tuning_db_t = impl::tuning_db::db_t;
+
+TEST(tuning_db_test_t, TestRoundTrip) {
+    const char *path = "test_tuning_db_round_trip.db";
+    std::remove(path);
+
+    {
+        tuning_db_t db(path);
+        int candidate = 0;
+        ASSERT_FALSE(db.lookup("key0", 4, candidate));
+        db.store("key0", 2);
+        db.store("key1", -1);
+        db.store("key0", 3);
+        ASSERT_TRUE(db.lookup("key0", 4, candidate));
+        ASSERT_EQ(candidate, 3);
+    }
+
+    // The last entry for a key wins.
+    tuning_db_t db(path);
+    int candidate = 0;
+    ASSERT_TRUE(db.lookup("key0", 4, candidate));
+    ASSERT_EQ(candidate, 3);
+    ASSERT_TRUE(db.lookup("key1", 4, candidate));
+    ASSERT_EQ(candidate, -1);
+    ASSERT_FALSE(db.lookup("key2", 4, candidate));
+
+    std::remove(path);
+}
+
+TEST(tuning_db_test_t, TestCorruptEntries) {
+    const char *path = "test_tuning_db_corrupt_entries.db";
+    write_file(path,
+            "key0 1\n"
+            "key1\n"
+            "key2 x\n"
+            "key3 2 3\n"
+            "\n"
+            "key4 7\n"
+            "key5 -2\n"
+            "key6 3");
+
+    tuning_db_t db(path);
+    int candidate = 0;
+    ASSERT_TRUE(db.lookup("key0", 4, candidate));
+    ASSERT_EQ(candidate, 1);
+    // Malformed lines are ignored.
+    for (const char *key : {"key1", "key2", "key3"})
+        ASSERT_FALSE(db.lookup(key, 4, candidate)) << key;
+    // Entries out of the range of the candidates are ignored.
+    ASSERT_FALSE(db.lookup("key4", 4, candidate));
+    ASSERT_TRUE(db.lookup("key4", 8, candidate));
+    ASSERT_EQ(candidate, 7);
+    ASSERT_FALSE(db.lookup("key5", 4, candidate));
+    // The last line doesn't need a line break.
+    ASSERT_TRUE(db.lookup("key6", 4, candidate));
+    ASSERT_EQ(candidate, 3);
+
+    // A new result replaces an ignored entry.
+    db.store("key4", 2);
+    ASSERT_TRUE(db.lookup("key4", 4, candidate));
+    ASSERT_EQ(candidate, 2);
+
+    std::remove(path);
+}
+
+TEST(tuning_db_test_t, TestMemoryOnly) {
+    tuning_db_t db("");
+    int candidate = 0;
+    db.store("key0", 1);
+    ASSERT_TRUE(db.lookup("key0", 4, candidate));
+    ASSERT_EQ(candidate, 1);
+}
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
+TEST(tuning_db_test_t, TestSelection) {
+    const char *path = "test_tuning_db_selection.db";
+    std::remove(path);
+    // The variables are read once, at the first primitive creation.
+    custom_setenv("ONEDNN_TUNING", "1", 1);
+    custom_setenv("ONEDNN_TUNING_DB", path, 1);
+
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+    const memory::dim M = 128, K = 256, N = 512;
+    engine eng(engine::kind::cpu, 0);
+    memory::desc src_md({M, K}, dt::f32, tag::ab);
+    memory::desc wei_md({K, N}, dt::f32, tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, tag::ab);
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    const std::string impl_info = pd.impl_info_str();
+    if (impl_info.find("brg_matmul") == std::string::npos) {
+        std::remove(path);
+        return;
+    }
+
+    // The search stores the selected candidate for the problem.
+    auto lines = read_lines(path);
+    ASSERT_EQ(lines.size(), 1U);
+    char key[1024];
+    int candidate = -1;
+    ASSERT_EQ(sscanf(lines[0].c_str(), "%1023s %d", key, &candidate), 2);
+    const std::string key_str(key);
+    ASSERT_EQ(key_str.find('v'), 0U) << key_str;
+    ASSERT_NE(key_str.find(impl_info), std::string::npos) << key_str;
+    // The heuristic candidate always applies.
+    ASSERT_GE(candidate, 0);
+    using impl::cpu::x64::matmul::brgemm_matmul_n_tuning_candidates;
+    ASSERT_LT(candidate, brgemm_matmul_n_tuning_candidates);
+
+    // The next creation uses the stored result.
+    auto pd2 = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    ASSERT_EQ(pd2.impl_info_str(), impl_info);
+    ASSERT_EQ(read_lines(path).size(), 1U);
+
+    // The selected blocking computes the product.
+    std::vector<float> src(M * K, 1.f), wei(K * N, 0.5f), dst(M * N, 0.f);
+    memory src_mem(src_md, eng, src.data());
+    memory wei_mem(wei_md, eng, wei.data());
+    memory dst_mem(dst_md, eng, dst.data());
+    stream strm(eng);
+    matmul(pd2).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+    for (const float d : dst)
+        ASSERT_EQ(d, 0.5f * K);
+
+    std::remove(path);
+}
+#endif
+
+} // namespace dnnl
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "src/cpu/cpu_weights_replicas.hpp"
+#include "src/cpu/platform.hpp"
+
+namespace dnnl {
+
+using impl::cpu::get_weights_replicas;
+using impl::cpu::register_weights_replicas;
+using impl::cpu::unregister_weights_replicas;
+using impl::cpu::weights_replicas_t;
+namespace platform = impl::cpu::platform;
+
+// Pretends that the system has two NUMA nodes for the duration of a test.
+class weights_replication_test_t : public ::testing::Test {
+protected:
+    void SetUp() override { platform::set_num_numa_nodes_override(2); }
+    void TearDown() override { platform::set_num_numa_nodes_override(0); }
+};
+
+TEST_F(weights_replication_test_t, TestRegistry) {
+    ASSERT_EQ(platform::get_num_numa_nodes(), 2);
+
+    std::vector<float> wei(1000);
+    for (size_t i = 0; i < wei.size(); i++)
+        wei[i] = static_cast<float>(i);
+    const size_t size = wei.size() * sizeof(float);
+
+    // Buffers without registered copies are not replicated.
+    std::shared_ptr<const weights_replicas_t> r0;
+    get_weights_replicas(wei.data(), size, r0);
+    ASSERT_EQ(r0, nullptr);
+
+    std::shared_ptr<weights_replicas_t> replicas;
+    ASSERT_EQ(weights_replicas_t::create(replicas, wei.data(), size),
+            impl::status::success);
+    register_weights_replicas(replicas);
+
+    // The primitives with weights in the buffer get the registered copies.
+    std::shared_ptr<const weights_replicas_t> r1;
+    get_weights_replicas(wei.data() + 100, 10 * sizeof(float), r1);
+    ASSERT_EQ(r1, replicas);
+    for (int node = 0; node < 2; node++) {
+        const float *copy = r1->local(wei.data(), node);
+        ASSERT_NE(copy, wei.data());
+        ASSERT_EQ(std::memcmp(copy, wei.data(), size), 0);
+    }
+
+    unregister_weights_replicas(replicas.get());
+    std::shared_ptr<const weights_replicas_t> r2;
+    get_weights_replicas(wei.data(), size, r2);
+    ASSERT_EQ(r2, nullptr);
+}
+
+TEST_F(weights_replication_test_t, TestMatmul) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Weights replication is supported only on CPU.");
+    const memory::dim M = 64, K = 256, N = 128;
+    auto eng = get_test_engine();
+    stream strm(eng);
+
+    memory::desc src_md({M, K}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, memory::format_tag::ab);
+
+    primitive_attr attr;
+    attr.set_weights_replication(true);
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    auto ref_pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    SKIP_IF(std::string(pd.impl_info_str()).find("brg") == std::string::npos,
+            "Weights replication is supported by brgemm matmul only.");
+
+    memory src(src_md, eng), wei(wei_md, eng);
+    memory dst(dst_md, eng), ref_dst(dst_md, eng);
+    fill_data<float>(M * K, src, 1.f, 0.5f);
+    fill_data<float>(K * N, wei, 0.f, 0.5f);
+
+    auto check = [&]() {
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        matmul(ref_pd).execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+        auto dst_ptr = map_memory<float>(dst);
+        auto ref_ptr = map_memory<float>(ref_dst);
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_NEAR(dst_ptr[i], ref_ptr[i],
+                    1e-4f * (1.f + std::fabs(ref_ptr[i])))
+                    << "i: " << i;
+    };
+
+    check();
+
+    // The result follows the weights updated in place, including an update
+    // of a single element which a sample of the buffer would miss.
+    {
+        auto wei_ptr = map_memory<float>(wei);
+        wei_ptr[K * N / 2 + 3] += 100.f;
+    }
+    check();
+    {
+        auto wei_ptr = map_memory<float>(wei);
+        for (memory::dim i = 0; i < K * N; i++)
+            wei_ptr[i] *= -2.f;
+    }
+    check();
+}
+
+} // namespace dnnl
@@ -103,4 +103,42 @@ HANDLE_EXCEPTIONS_FOR_TEST(global_scratchpad_t, TestGlobalScratchpad) {
     // if something goes wrong, test should return 139 on Linux.
 };
 
+HANDLE_EXCEPTIONS_FOR_TEST(global_scratchpad_t, TestScratchpadArena) {
+    const bool was_enabled = get_scratchpad_arena();
+    set_scratchpad_arena(true);
+
+    // The arena applies to primitives created after it's enabled.
+    conv_ctx_t ctx;
+    ctx.Setup({2, 16, 14, 14}, {32, 16, 3, 3}, {2, 32, 14, 14}, {1, 1},
+            {0, 0}, {1, 1}, {1, 1});
+    stream strm(ctx.eng_);
+
+    const auto before = get_scratchpad_arena_stats();
+    const int n_execs = 3;
+    for (int i = 0; i < n_execs; i++) {
+        ctx.c_.prim.execute(strm,
+                {{DNNL_ARG_SRC, ctx.c_.src_mem},
+                        {DNNL_ARG_WEIGHTS, ctx.c_.wei_mem},
+                        {DNNL_ARG_DST, ctx.c_.dst_mem}});
+        strm.wait();
+    }
+    const auto after = get_scratchpad_arena_stats();
+
+    // The implementation may not need a scratchpad at all. Otherwise, all
+    // the executions share a single buffer.
+    const uint64_t acquisitions = after.acquisitions - before.acquisitions;
+    ASSERT_TRUE(acquisitions == 0 || acquisitions == n_execs);
+    if (acquisitions != 0) {
+        ASSERT_LE(after.allocations - before.allocations, 1u);
+        ASSERT_GT(after.idle_size, 0u);
+    }
+    ASSERT_EQ(after.used_size, 0u);
+    ASSERT_GE(after.peak_size, after.idle_size);
+
+    trim_scratchpad_arena();
+    ASSERT_EQ(get_scratchpad_arena_stats().idle_size, 0u);
+
+    set_scratchpad_arena(was_enabled);
+}
+
 } // namespace dnnl
@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "tests/test_isa_common.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct grouped_matmul_test_params_t {
+    memory::dim M, K, N;
+    // End row of each group.
+    std::vector<int32_t> offsets;
+    bool with_bias;
+    bool runtime_M;
+    dt src_dt, wei_dt;
+    // Per group and per column weights scales.
+    bool with_wei_scales;
+};
+
+class grouped_matmul_test_t
+    : public ::testing::TestWithParam<grouped_matmul_test_params_t> {
+protected:
+    void SetUp() override {
+        auto p = ::testing::TestWithParam<
+                grouped_matmul_test_params_t>::GetParam();
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Grouped matmul is supported only on CPU.");
+        SKIP_IF(unsupported_data_type(p.src_dt, p.wei_dt),
+                "Engine does not support this data type.");
+        catch_expected_failures([&]() { Test(); }, false, dnnl_success);
+    }
+
+    // Returns a memory of `dt` data type filled from `f32_mem`, and replaces
+    // the values of `f32_mem` with the converted ones.
+    static memory convert(
+            memory &f32_mem, const memory::desc &md, stream &strm) {
+        if (md == f32_mem.get_desc()) return f32_mem;
+        memory mem(md, f32_mem.get_engine());
+        reorder(f32_mem, mem).execute(strm, f32_mem, mem);
+        reorder(mem, f32_mem).execute(strm, mem, f32_mem);
+        strm.wait();
+        return mem;
+    }
+
+    void Test() {
+        auto p = ::testing::TestWithParam<
+                grouped_matmul_test_params_t>::GetParam();
+        const memory::dim G = static_cast<memory::dim>(p.offsets.size());
+        const memory::dim M = p.M, K = p.K, N = p.N;
+
+        auto eng = get_test_engine();
+        stream strm(eng);
+
+        const memory::dim pd_M = p.runtime_M ? DNNL_RUNTIME_DIM_VAL : M;
+        memory::desc src_md({pd_M, K}, p.src_dt, tag::ab);
+        memory::desc wei_md({G, K, N}, p.wei_dt, tag::any);
+        memory::desc bia_md({G, N}, dt::f32, tag::ab);
+        memory::desc off_md({G}, dt::s32, tag::a);
+        memory::desc dst_md({pd_M, N}, dt::f32, tag::ab);
+
+        primitive_attr attr;
+        if (p.with_wei_scales)
+            attr.set_scales_mask(DNNL_ARG_WEIGHTS, (1 << 0) | (1 << 2));
+
+        auto pd = p.with_bias
+                ? grouped_matmul::primitive_desc(
+                        eng, src_md, wei_md, bia_md, off_md, dst_md, attr)
+                : grouped_matmul::primitive_desc(
+                        eng, src_md, wei_md, off_md, dst_md, attr);
+        ASSERT_EQ(pd.group_offsets_desc(), off_md);
+
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+        // The JIT implementation covers u8 sources starting with avx512_core
+        // and floating-point ones with the native ISA of the data type.
+        const auto brgemm_isa = p.src_dt == dt::u8 ? cpu_isa::avx512_core
+                : p.src_dt == dt::bf16             ? cpu_isa::avx512_core_bf16
+                                                   : cpu_isa::avx2;
+        if (dnnl::mayiuse(brgemm_isa)) {
+            const std::string impl_info = pd.impl_info_str();
+            ASSERT_NE(impl_info.find("brg_grouped"), std::string::npos)
+                    << impl_info;
+        }
+#endif
+
+        memory src_f32(memory::desc({M, K}, dt::f32, tag::ab), eng);
+        memory wei_f32(memory::desc({G, K, N}, dt::f32, tag::abc), eng);
+        memory bia(bia_md, eng);
+        memory off(off_md, eng);
+        memory wei_sc(memory::desc({G * N}, dt::f32, tag::a), eng);
+        memory dst(memory::desc({M, N}, dt::f32, tag::ab), eng);
+
+        fill_data<float>(M * K, src_f32, 1.f, 0.5f);
+        fill_data<float>(G * K * N, wei_f32, 0.f, 0.5f);
+        fill_data<float>(G * N, bia, 0.f, 1.f);
+        fill_data<float>(G * N, wei_sc, 1.f, 0.5f);
+        {
+            auto off_ptr = map_memory<int32_t>(off);
+            for (memory::dim g = 0; g < G; g++)
+                off_ptr[g] = p.offsets[g];
+            // Rows outside of the groups must stay untouched.
+            auto dst_ptr = map_memory<float>(dst);
+            for (memory::dim i = 0; i < M * N; i++)
+                dst_ptr[i] = -1.f;
+        }
+
+        // The reference is computed from the values rounded to the data
+        // types of the primitive.
+        memory src = convert(
+                src_f32, memory::desc({M, K}, p.src_dt, tag::ab), strm);
+        memory wei = convert(wei_f32, pd.weights_desc(), strm);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_GROUP_OFFSETS, off},
+                {DNNL_ARG_DST, dst}};
+        if (p.with_bias) args.insert({DNNL_ARG_BIAS, bia});
+        if (p.with_wei_scales)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, wei_sc});
+        grouped_matmul(pd).execute(strm, args);
+        strm.wait();
+
+        auto src_ptr = map_memory<float>(src_f32);
+        auto wei_ptr = map_memory<float>(wei_f32);
+        auto bia_ptr = map_memory<float>(bia);
+        auto sc_ptr = map_memory<float>(wei_sc);
+        auto dst_ptr = map_memory<float>(dst);
+
+        const float eps = p.src_dt == dt::f32 ? 1e-4f : 1e-3f;
+        int32_t row_start = 0;
+        for (memory::dim g = 0; g < G; g++) {
+            const int32_t row_end = p.offsets[g];
+            for (int32_t m = row_start; m < row_end; m++)
+                for (memory::dim n = 0; n < N; n++) {
+                    float ref = 0.f;
+                    for (memory::dim k = 0; k < K; k++)
+                        ref += src_ptr[m * K + k]
+                                * wei_ptr[(g * K + k) * N + n];
+                    if (p.with_wei_scales) ref *= sc_ptr[g * N + n];
+                    if (p.with_bias) ref += bia_ptr[g * N + n];
+                    const float got = dst_ptr[m * N + n];
+                    ASSERT_NEAR(got, ref, eps * (1.f + std::fabs(ref)))
+                            << "g: " << g << " m: " << m << " n: " << n;
+                }
+            row_start = row_end;
+        }
+        for (memory::dim i = row_start * N; i < M * N; i++)
+            ASSERT_EQ(dst_ptr[i], -1.f);
+    }
+};
+
+TEST_P(grouped_matmul_test_t, TestsGroupedMatMul) {}
+
+INSTANTIATE_TEST_SUITE_P(TestGroupedMatMul, grouped_matmul_test_t,
+        ::testing::Values(
+                grouped_matmul_test_params_t {16, 32, 64, {4, 8, 12, 16},
+                        false, false, dt::f32, dt::f32, false},
+                grouped_matmul_test_params_t {37, 48, 80, {5, 5, 30, 33},
+                        true, false, dt::f32, dt::f32, false},
+                grouped_matmul_test_params_t {100, 64, 130, {1, 70, 71, 100},
+                        false, true, dt::f32, dt::f32, true},
+                grouped_matmul_test_params_t {9, 17, 3, {0, 0, 9}, true, true,
+                        dt::f32, dt::f32, false}));
+
+INSTANTIATE_TEST_SUITE_P(TestGroupedMatMulBf16, grouped_matmul_test_t,
+        ::testing::Values(
+                grouped_matmul_test_params_t {16, 32, 64, {4, 8, 12, 16},
+                        false, false, dt::bf16, dt::bf16, false},
+                grouped_matmul_test_params_t {100, 64, 130, {1, 70, 71, 100},
+                        true, true, dt::bf16, dt::bf16, true}));
+
+INSTANTIATE_TEST_SUITE_P(TestGroupedMatMulInt8, grouped_matmul_test_t,
+        ::testing::Values(
+                grouped_matmul_test_params_t {16, 32, 64, {4, 8, 12, 16},
+                        false, false, dt::u8, dt::s8, false},
+                grouped_matmul_test_params_t {37, 48, 80, {5, 5, 30, 33},
+                        true, false, dt::u8, dt::s8, true},
+                grouped_matmul_test_params_t {100, 64, 130, {1, 70, 71, 100},
+                        true, true, dt::s8, dt::s8, true}));
+
+TEST(grouped_matmul_iface_test_t, TestsBadOffsets) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Grouped matmul is supported only on CPU.");
+    auto eng = get_test_engine();
+
+    // Group offsets must be a 1D s32 tensor with an entry per group.
+    EXPECT_ANY_THROW(grouped_matmul::primitive_desc(eng,
+            memory::desc({8, 4}, dt::f32, tag::ab),
+            memory::desc({2, 4, 4}, dt::f32, tag::abc),
+            memory::desc({3}, dt::s32, tag::a),
+            memory::desc({8, 4}, dt::f32, tag::ab)));
+    EXPECT_ANY_THROW(grouped_matmul::primitive_desc(eng,
+            memory::desc({8, 4}, dt::f32, tag::ab),
+            memory::desc({2, 4, 4}, dt::f32, tag::abc),
+            memory::desc({2}, dt::f32, tag::a),
+            memory::desc({8, 4}, dt::f32, tag::ab)));
+}
+
+} // namespace dnnl
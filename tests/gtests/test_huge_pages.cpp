@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.h"
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class huge_pages_test_t : public ::testing::Test {};
+
+TEST(huge_pages_test_t, TestInvalidArguments) {
+    ASSERT_EQ(dnnl_set_huge_pages_policy((dnnl_huge_pages_policy_t)3, 0),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_get_huge_pages_policy(nullptr, nullptr),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_get_huge_pages_stats(nullptr), dnnl_invalid_arguments);
+}
+
+// Memory debug mode allocates the buffers on its own.
+#ifndef DNNL_ENABLE_MEM_DEBUG
+HANDLE_EXCEPTIONS_FOR_TEST(huge_pages_test_t, TestMadvise) {
+    const auto old_policy = get_huge_pages_policy();
+    const size_t old_threshold = get_huge_pages_threshold();
+
+    const size_t threshold = 2 * 1024 * 1024;
+    const dnnl_status_t st
+            = dnnl_set_huge_pages_policy(dnnl_huge_pages_madvise, threshold);
+    if (st == dnnl_unimplemented) return;
+    ASSERT_EQ(st, dnnl_success);
+    ASSERT_EQ(get_huge_pages_policy(), huge_pages_policy::madvise);
+    ASSERT_EQ(get_huge_pages_threshold(), threshold);
+
+    engine eng(engine::kind::cpu, 0);
+    const auto before = get_huge_pages_stats();
+    {
+        // 4 MiB of f32, above the threshold.
+        memory::desc md({1024, 1024}, memory::data_type::f32,
+                memory::format_tag::ab);
+        memory mem(md, eng);
+        std::memset(mem.get_data_handle(), 0, md.get_size());
+
+        const auto during = get_huge_pages_stats();
+        ASSERT_EQ(during.madvise_allocations, before.madvise_allocations + 1);
+        ASSERT_GE(during.size, before.size + md.get_size());
+        ASSERT_LE(during.resident_size, during.size);
+
+        // Buffers below the threshold are allocated as usual.
+        memory::desc small_md(
+                {16, 16}, memory::data_type::f32, memory::format_tag::ab);
+        memory small_mem(small_md, eng);
+        ASSERT_EQ(get_huge_pages_stats().madvise_allocations,
+                during.madvise_allocations);
+    }
+    ASSERT_EQ(get_huge_pages_stats().size, before.size);
+
+    set_huge_pages_policy(old_policy, old_threshold);
+}
+#endif
+
+} // namespace dnnl
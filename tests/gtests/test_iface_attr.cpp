@@ -127,6 +127,17 @@ TEST_F(attr_test_t, TestDeterministic) {
     }
 }
 
+TEST_F(attr_test_t, TestWeightsReplication) {
+    dnnl::primitive_attr attr;
+    // Check the default value
+    ASSERT_EQ(false, attr.get_weights_replication());
+
+    for (auto b : {true, false}) {
+        attr.set_weights_replication(b);
+        ASSERT_EQ(b, attr.get_weights_replication());
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     engine eng = get_test_engine();
 
@@ -281,6 +292,23 @@ TEST_F(attr_test_t, TestPrecomputedReductionsWithGroups) {
     }
 }
 
+TEST_F(attr_test_t, TestDynamicQuantization) {
+    dnnl::primitive_attr attr;
+
+    // per-token quantization of a 2D source
+    attr.set_dynamic_quantization(DNNL_ARG_SRC, 1 << 0);
+    attr.set_dynamic_quantization(DNNL_ARG_SRC, 1 << 0, data_type::s8);
+
+    // only symmetric s8 quantization is supported so far
+    EXPECT_ANY_THROW(attr.set_dynamic_quantization(
+            DNNL_ARG_SRC, 1 << 0, data_type::u8));
+    EXPECT_ANY_THROW(attr.set_dynamic_quantization(DNNL_ARG_SRC, -1));
+
+    for (auto arg : {DNNL_ARG_WEIGHTS, DNNL_ARG_DST, DNNL_ARG_BIAS}) {
+        EXPECT_ANY_THROW(attr.set_dynamic_quantization(arg, 0));
+    }
+}
+
 HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScales) {
     dnnl::primitive_attr attr;
     const std::vector<int> supported_args = {DNNL_ARG_SRC_0, DNNL_ARG_SRC_1,
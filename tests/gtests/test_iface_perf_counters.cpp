@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2025 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class perf_counters_test_t : public ::testing::Test {
+public:
+    engine e;
+
+protected:
+    void SetUp() override { e = get_test_engine(); }
+};
+
+TEST_F(perf_counters_test_t, TestQuery) {
+    memory::desc md({2, 16, 7, 7}, memory::data_type::f32,
+            memory::format_tag::nchw);
+    auto pd = eltwise_forward::primitive_desc(e, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    auto p = eltwise_forward(pd);
+
+    memory m(md, e);
+    stream s(e);
+    const int n_execs = 2;
+    for (int i = 0; i < n_execs; i++)
+        p.execute(s, {{DNNL_ARG_SRC, m}, {DNNL_ARG_DST, m}});
+    s.wait();
+
+    ASSERT_EQ(dnnl_primitive_get_perf_counters(p.get(), nullptr),
+            dnnl_invalid_arguments);
+
+    dnnl_perf_counters_t counters {};
+    const dnnl_status_t st
+            = dnnl_primitive_get_perf_counters(p.get(), &counters);
+#ifdef DNNL_ENABLE_PERF_COUNTERS
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        ASSERT_EQ(st, dnnl_success);
+        // Executions are not counted once the system refuses to open the
+        // counters, e.g. because of the perf_event_paranoid setting.
+        ASSERT_LE(counters.executions, (uint64_t)n_execs);
+        ASSERT_EQ(counters.bytes, counters.llc_misses * 64);
+        ASSERT_NO_THROW(p.get_perf_counters());
+        return;
+    }
+#endif
+    ASSERT_EQ(st, dnnl_unimplemented);
+    ASSERT_ANY_THROW(p.get_perf_counters());
+}
+
+} // namespace dnnl
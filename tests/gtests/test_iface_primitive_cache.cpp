@@ -1,5 +1,5 @@
 /*******************************************************************************
-* Copyright 2020-2023 Intel Corporation
+* Copyright 2020-2025 Intel Corporation
 *
 * Licensed under the Apache License, Version 2.0 (the "License");
 * you may not use this file except in compliance with the License.
@@ -116,6 +116,45 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestStats) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    // Only regular CPU engines created by each fill are considered equal.
+    if (get_test_engine_kind() != engine::kind::cpu) return;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(3);
+    const auto s0 = get_primitive_cache_stats();
+
+    fill_primitive_cache(3);
+    const auto s1 = get_primitive_cache_stats();
+    ASSERT_EQ(s1.hits - s0.hits, 0u);
+    ASSERT_EQ(s1.misses - s0.misses, 3u);
+    ASSERT_EQ(s1.evictions - s0.evictions, 0u);
+
+    fill_primitive_cache(3);
+    const auto s2 = get_primitive_cache_stats();
+    ASSERT_EQ(s2.hits - s1.hits, 3u);
+    ASSERT_EQ(s2.misses - s1.misses, 0u);
+
+    set_primitive_cache_capacity(1);
+    const auto s3 = get_primitive_cache_stats();
+    ASSERT_EQ(s3.evictions - s2.evictions, 2u);
+
+    // The most recently used primitive is the only one left.
+    fill_primitive_cache(3);
+    const auto s4 = get_primitive_cache_stats();
+    ASSERT_EQ(s4.hits - s3.hits, 0u);
+    ASSERT_EQ(s4.misses - s3.misses, 3u);
+    ASSERT_EQ(s4.evictions - s3.evictions, 3u);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+
+    // Kernel cache counters never decrease.
+    ASSERT_GE(s4.kernel_hits, s0.kernel_hits);
+    ASSERT_GE(s4.kernel_misses, s0.kernel_misses);
+    ASSERT_GE(s4.kernel_evictions, s0.kernel_evictions);
+#endif
+}
 #endif
 
 } // namespace dnnl
@@ -14,10 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdint>
+#include <cstring>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
+#include "tests/test_isa_common.hpp"
 
 namespace dnnl {
 
@@ -35,6 +39,12 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
     ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
     // Packed.
     ASSERT_NO_THROW(md = memory::desc::packed({64, 128}, dt::f32, nnz));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz, {4, 16},
+                            dt::s32, dt::s32));
+    // Non-positive block dimensions.
+    EXPECT_ANY_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz, {0, 16},
+                             dt::s32, dt::s32));
 }
 
 TEST(iface_sparse_test_t, TestSparseMDComparison) {
@@ -94,6 +104,20 @@ TEST(iface_sparse_test_t, TestSparseMDComparison) {
     ASSERT_NO_THROW(md1 = memory::desc::packed({64, 128}, dt::f32, nnz));
     ASSERT_NO_THROW(md2 = memory::desc::packed({64, 128}, dt::f32, nnz + 1));
     ASSERT_NE(md1, md2);
+
+    // BSR.
+
+    // Equal memory descriptors.
+    ASSERT_NO_THROW(md1 = memory::desc::bsr({64, 128}, dt::f32, nnz, {4, 16},
+                            dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, nnz, {4, 16},
+                            dt::s32, dt::s32));
+    ASSERT_EQ(md1, md2);
+
+    // Different block dimensions.
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, nnz, {16, 4},
+                            dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDQueries) {
@@ -139,6 +163,19 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
 
     ASSERT_EQ(md.get_nnz(), nnz);
     ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::packed);
+
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, nnz, {4, 16},
+                            indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_data_type(), data_type);
+    ASSERT_EQ(md.get_data_type(0), data_type);
+    ASSERT_EQ(md.get_format_kind(), memory::format_kind::sparse);
+
+    ASSERT_EQ(md.get_nnz(), nnz);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDSize) {
@@ -194,6 +231,22 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
 
     // Size of bitmask.
     ASSERT_EQ(md.get_size(2), 0u);
+
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz, {4, 16},
+                            dt::s32, dt::s32));
+    // Size of values of the stored blocks.
+    exp_values_size = nnz * 4 * 16 * memory::data_type_size(md.get_data_type());
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of block column indices.
+    exp_indices_size = nnz * memory::data_type_size(md.get_data_type(1));
+    ASSERT_EQ(md.get_size(1), exp_indices_size);
+
+    // Size of block row pointers.
+    exp_pointers_size = (md.get_dims()[0] / 4 + 1)
+            * memory::data_type_size(md.get_data_type(2));
+    ASSERT_EQ(md.get_size(2), exp_pointers_size);
 }
 
 HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestSparseMemoryCreation) {
@@ -405,4 +458,207 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_col_indices, 2));
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestBSRReorderAndMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    stream strm(eng);
+
+    // 3 x 2 blocks of 2 x 4 elements, the bottom ones being padded. Two of
+    // the blocks are non-zero.
+    const memory::dim M = 3, K = 5, N = 8;
+    const memory::dim nnz = 2;
+    std::vector<float> wei(K * N, 0.f);
+    wei[0 * N + 1] = 1.f; // Block (0, 0).
+    wei[4 * N + 6] = 2.f; // Block (2, 1).
+
+    memory::desc wei_md({K, N}, dt::f32, memory::format_tag::ab);
+    memory::desc wei_bsr_md;
+    ASSERT_NO_THROW(wei_bsr_md = memory::desc::bsr(
+                            {K, N}, dt::f32, nnz, {2, 4}, dt::s32, dt::s32));
+
+    memory wei_mem(wei_md, eng, wei.data());
+    memory wei_bsr_mem(wei_bsr_md, eng);
+    reorder(wei_mem, wei_bsr_mem).execute(strm, wei_mem, wei_bsr_mem);
+    strm.wait();
+
+    float *values = wei_bsr_mem.map_data<float>(0);
+    int *indices = wei_bsr_mem.map_data<int>(1);
+    int *pointers = wei_bsr_mem.map_data<int>(2);
+
+    const std::vector<int> exp_pointers = {0, 1, 1, 2};
+    for (size_t i = 0; i < exp_pointers.size(); i++)
+        ASSERT_EQ(pointers[i], exp_pointers[i]);
+    ASSERT_EQ(indices[0], 0);
+    ASSERT_EQ(indices[1], 1);
+    // The second element of the first block and the third element of the
+    // second one.
+    for (int i = 0; i < nnz * 2 * 4; i++)
+        ASSERT_EQ(values[i], i == 1 ? 1.f : i == 8 + 2 ? 2.f : 0.f);
+
+    ASSERT_NO_THROW(wei_bsr_mem.unmap_data(values, 0));
+    ASSERT_NO_THROW(wei_bsr_mem.unmap_data(indices, 1));
+    ASSERT_NO_THROW(wei_bsr_mem.unmap_data(pointers, 2));
+
+    std::vector<float> src(M * K), dst(M * N);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 7) - 3.f;
+    memory::desc src_md({M, K}, dt::f32, memory::format_tag::ab);
+    memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+    memory src_mem(src_md, eng, src.data());
+    memory dst_mem(dst_md, eng, dst.data());
+
+    auto pd = matmul::primitive_desc(eng, src_md, wei_bsr_md, dst_md);
+    matmul(pd).execute(strm,
+            {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_bsr_mem},
+                    {DNNL_ARG_DST, dst_mem}});
+    strm.wait();
+
+    for_(memory::dim m = 0; m < M; m++)
+    for (memory::dim n = 0; n < N; n++) {
+        float exp_dst = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            exp_dst += src[m * K + k] * wei[k * N + n];
+        ASSERT_EQ(dst[m * N + n], exp_dst);
+    }
+}
+
+
+HANDLE_EXCEPTIONS_FOR_TEST(iface_sparse_test_t, TestBSRMatmulBrgemm) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    stream strm(eng);
+
+    // Block dimensions divide the weights dimensions, the case taken by the
+    // JIT implementation.
+    const memory::dim M = 37, K = 64, N = 64;
+    const memory::dim BK = 4, BN = 16;
+    std::vector<dt> dts = {dt::f32};
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    if (dnnl::mayiuse(cpu_isa::avx512_core_bf16)) dts.push_back(dt::bf16);
+#endif
+
+    // Every other block row keeps a single block, all the values being small
+    // integers exact in any data type.
+    std::vector<float> wei(K * N, 0.f);
+    memory::dim nnz = 0;
+    for (memory::dim kb = 0; kb < K / BK; kb += 2, nnz++) {
+        const memory::dim nb = kb % (N / BN);
+        for_(memory::dim k = kb * BK; k < (kb + 1) * BK; k++)
+        for (memory::dim n = nb * BN; n < (nb + 1) * BN; n++)
+            wei[k * N + n] = static_cast<float>((k + n) % 5) - 2.f;
+    }
+    std::vector<float> src(M * K);
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 7) - 3.f;
+
+    for (const auto data_type : dts) {
+        memory::desc src_md({M, K}, data_type, memory::format_tag::ab);
+        memory::desc wei_md({K, N}, data_type, memory::format_tag::ab);
+        memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+        memory::desc wei_bsr_md = memory::desc::bsr(
+                {K, N}, data_type, nnz, {BK, BN}, dt::s32, dt::s32);
+
+        auto pd = matmul::primitive_desc(eng, src_md, wei_bsr_md, dst_md);
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+        if (dnnl::mayiuse(cpu_isa::avx2)) {
+            const std::string impl_info = pd.impl_info_str();
+            ASSERT_NE(impl_info.find("brg_bsr"), std::string::npos)
+                    << impl_info;
+        }
+#endif
+
+        memory src_f32_mem({{M, K}, dt::f32, memory::format_tag::ab}, eng,
+                src.data());
+        memory src_mem(src_md, eng);
+        reorder(src_f32_mem, src_mem).execute(strm, src_f32_mem, src_mem);
+        memory wei_bsr_mem(wei_bsr_md, eng);
+        memory dst_mem(dst_md, eng);
+        matmul prim(pd);
+
+        auto check = [&](const std::vector<float> &wei_ref) {
+            prim.execute(strm,
+                    {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_bsr_mem},
+                            {DNNL_ARG_DST, dst_mem}});
+            strm.wait();
+
+            const float *dst = dst_mem.map_data<float>();
+            for_(memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float exp_dst = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    exp_dst += src[m * K + k] * wei_ref[k * N + n];
+                ASSERT_EQ(dst[m * N + n], exp_dst);
+            }
+            dst_mem.unmap_data(const_cast<float *>(dst));
+        };
+
+        // The second run updates the weights in place, the result must follow
+        // the new weights.
+        std::vector<float> wei_alpha;
+        for (float alpha : {1.f, 2.f}) {
+            wei_alpha = wei;
+            for (auto &w : wei_alpha)
+                w *= alpha;
+            memory wei_f32_mem({{K, N}, dt::f32, memory::format_tag::ab}, eng,
+                    wei_alpha.data());
+            memory wei_mem(wei_md, eng);
+            reorder(wei_f32_mem, wei_mem).execute(strm, wei_f32_mem, wei_mem);
+            reorder(wei_mem, wei_bsr_mem).execute(strm, wei_mem, wei_bsr_mem);
+            check(wei_alpha);
+        }
+
+        // A single value updated in place is picked up as well. The value is
+        // 3, exact in f32 and bf16.
+        {
+            const memory::dim blk = nnz / 2, i = 1, j = 5;
+            const memory::dim kb = 2 * blk, nb = kb % (N / BN);
+            const memory::dim off = blk * BK * BN + i * BN + j;
+            wei_alpha[(kb * BK + i) * N + nb * BN + j] = 3.f;
+            char *values = wei_bsr_mem.map_data<char>(0);
+            if (data_type == dt::f32) {
+                const float v = 3.f;
+                std::memcpy(values + off * sizeof(float), &v, sizeof(v));
+            } else {
+                const uint16_t v = 0x4040;
+                std::memcpy(values + off * sizeof(v), &v, sizeof(v));
+            }
+            wei_bsr_mem.unmap_data(values, 0);
+            check(wei_alpha);
+        }
+
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+        // Block columns out of the weights are rejected by the brgemm
+        // implementation.
+        if (dnnl::mayiuse(cpu_isa::avx2)) {
+            int32_t *indices = wei_bsr_mem.map_data<int32_t>(1);
+            const int32_t index = indices[0];
+            indices[0] = static_cast<int32_t>(N / BN);
+            wei_bsr_mem.unmap_data(indices, 1);
+            dnnl_status_t status = dnnl_success;
+            try {
+                prim.execute(strm,
+                        {{DNNL_ARG_SRC, src_mem},
+                                {DNNL_ARG_WEIGHTS, wei_bsr_mem},
+                                {DNNL_ARG_DST, dst_mem}});
+                strm.wait();
+            } catch (const dnnl::error &e) { status = e.status; }
+            ASSERT_EQ(status, dnnl_invalid_arguments);
+
+            indices = wei_bsr_mem.map_data<int32_t>(1);
+            indices[0] = index;
+            wei_bsr_mem.unmap_data(indices, 1);
+            check(wei_alpha);
+        }
+#endif
+    }
+}
+
 } // namespace dnnl
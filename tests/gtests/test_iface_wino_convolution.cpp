@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -53,6 +55,11 @@ protected:
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         input_f32.wino_supported = is_gpu;
         input_f16.wino_supported = is_gpu;
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        // The x64 CPU implementation covers f32 forward starting with avx2.
+        if (get_test_engine_kind() == engine::kind::cpu)
+            input_f32.wino_supported = dnnl::mayiuse(cpu_isa::avx2);
+#endif
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
 #if DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_THREADPOOL
         const bool is_cpu = get_test_engine_kind() == engine::kind::cpu;
@@ -113,6 +120,10 @@ TEST_F(wino_conv_test_t, TestLargePadding) {
 
         bool large_pad_is_supported
                 = (get_test_engine_kind() == engine::kind::gpu);
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        large_pad_is_supported = large_pad_is_supported
+                || get_test_engine_kind() == engine::kind::cpu;
+#endif
         if (input.wino_supported && large_pad_is_supported) {
             EXPECT_NO_THROW(convolution_forward::primitive_desc(eng,
                     prop_kind::forward, algorithm::convolution_winograd, src_md,
@@ -143,4 +154,106 @@ TEST_F(wino_conv_test_t, TestUnsupportedKernel) {
     }
 }
 
+
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+TEST_F(wino_conv_test_t, TestX64Auto) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test targets the x64 CPU implementation.");
+    SKIP_IF(!dnnl::mayiuse(cpu_isa::avx512_core_bf16),
+            "The bf16 implementation requires avx512_core_bf16.");
+
+    memory::desc wei_md {{64, 64, 3, 3}, data_type::f32, tag::any};
+    memory::desc src_md {{1, 64, 56, 56}, data_type::f32, tag::any};
+    memory::desc dst_md {{1, 64, 56, 56}, data_type::f32, tag::any};
+
+    // bf16 Winograd is less accurate than a direct convolution and is only
+    // used when requested.
+    memory::desc wei_bf16_md {{64, 64, 3, 3}, data_type::bf16, tag::any};
+    memory::desc src_bf16_md {{1, 64, 56, 56}, data_type::bf16, tag::any};
+    EXPECT_NO_THROW(convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_winograd,
+            src_bf16_md, wei_bf16_md, dst_md, {1, 1}, {1, 1}, {1, 1}));
+    auto auto_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_auto,
+            src_bf16_md, wei_bf16_md, dst_md, {1, 1}, {1, 1}, {1, 1});
+    const std::string impl_info = auto_pd.impl_info_str();
+    EXPECT_EQ(impl_info.find("wino"), std::string::npos) << impl_info;
+    EXPECT_EQ(auto_pd.get_algorithm(), algorithm::convolution_direct);
+}
+
+TEST_F(wino_conv_test_t, TestX64PostOps) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "The test targets the x64 CPU implementation.");
+    SKIP_IF(!dnnl::mayiuse(cpu_isa::avx2),
+            "The implementation requires avx2.");
+
+    const memory::dim MB = 2, IC = 24, OC = 40, H = 13, W = 11;
+    memory::desc wei_md {{OC, IC, 3, 3}, data_type::f32, tag::any};
+    memory::desc src_md {{MB, IC, H, W}, data_type::f32, tag::nhwc};
+    memory::desc dst_md {{MB, OC, H, W}, data_type::f32, tag::nhwc};
+    memory::desc bia_md {{OC}, data_type::f32, tag::a};
+    memory::desc user_wei_md {{OC, IC, 3, 3}, data_type::f32, tag::oihw};
+    memory::desc rhs_md {{1, OC, 1, 1}, data_type::f32, tag::nhwc};
+    memory::desc scalar_md {{1, 1, 1, 1}, data_type::f32, tag::nhwc};
+
+    // The post-ops are applied by the output transform.
+    post_ops ops;
+    ops.append_binary(algorithm::binary_mul, rhs_md);
+    ops.append_eltwise(algorithm::eltwise_relu, 0.1f, 0.f);
+    ops.append_binary(algorithm::binary_add, scalar_md);
+    ops.append_eltwise(algorithm::eltwise_tanh, 0.f, 0.f);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    auto pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_winograd,
+            src_md, wei_md, dst_md, bia_md, {1, 1}, {1, 1}, {1, 1}, attr);
+    auto ref_pd = convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, user_wei_md, dst_md, bia_md, {1, 1}, {1, 1}, {1, 1},
+            attr);
+
+    stream strm(eng);
+    memory src(src_md, eng), user_wei(user_wei_md, eng), bia(bia_md, eng);
+    memory rhs(rhs_md, eng), scalar(scalar_md, eng);
+    memory wei(pd.weights_desc(), eng);
+    memory dst(dst_md, eng), ref_dst(dst_md, eng);
+    fill_data<float>(MB * IC * H * W, src, 1.f, 0.5f);
+    fill_data<float>(OC * IC * 9, user_wei, 0.f, 0.25f);
+    fill_data<float>(OC, bia, 0.5f, 0.5f);
+    fill_data<float>(OC, rhs, 1.f, 0.5f);
+    fill_data<float>(1, scalar, 0.f, 0.5f);
+    reorder(user_wei, wei).execute(strm, user_wei, wei);
+
+    const int rhs_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_SRC_1;
+    const int scalar_arg = DNNL_ARG_ATTR_MULTIPLE_POST_OP(2) | DNNL_ARG_SRC_1;
+    convolution_forward(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst},
+                    {rhs_arg, rhs}, {scalar_arg, scalar}});
+    convolution_forward(ref_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, user_wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, ref_dst},
+                    {rhs_arg, rhs}, {scalar_arg, scalar}});
+    strm.wait();
+
+    auto dst_ptr = map_memory<float>(dst);
+    auto ref_ptr = map_memory<float>(ref_dst);
+    for (memory::dim i = 0; i < MB * OC * H * W; i++) {
+        const float eps = 1e-4f * (1.f + std::fabs(ref_ptr[i]));
+        ASSERT_NEAR(dst_ptr[i], ref_ptr[i], eps) << "i: " << i;
+    }
+
+    // A sum post-op would read the destination before the output transform
+    // writes it, and is not supported.
+    post_ops sum_ops;
+    sum_ops.append_sum();
+    primitive_attr sum_attr;
+    sum_attr.set_post_ops(sum_ops);
+    EXPECT_ANY_THROW(convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_winograd,
+            src_md, wei_md, dst_md, {1, 1}, {1, 1}, {1, 1}, sum_attr));
+}
+#endif
+
 } // namespace dnnl
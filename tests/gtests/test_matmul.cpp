@@ -19,6 +19,8 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace dnnl {
@@ -389,6 +391,72 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(
     ASSERT_EQ(impl_info_no_postops, impl_info_with_postops);
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(matmul_dynamic_quantization_test_t, TestPerToken) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Dynamic quantization is supported on CPU only.");
+    engine e {engine_kind, 0};
+    stream s {e};
+
+    const memory::dim M = 19, K = 77, N = 35;
+    memory::desc src_md({M, K}, memory::data_type::f32, tag::ab);
+    memory::desc wei_md({K, N}, memory::data_type::s8, tag::ab);
+    memory::desc dst_md({M, N}, memory::data_type::f32, tag::ab);
+
+    primitive_attr attr;
+    attr.set_dynamic_quantization(DNNL_ARG_SRC, 1 << 0);
+    attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+    auto pd = matmul::primitive_desc(e, src_md, wei_md, dst_md, attr);
+
+    memory src_m(src_md, e), wei_m(wei_md, e), dst_m(dst_md, e);
+    memory wei_scales_m({{N}, memory::data_type::f32, tag::a}, e);
+    std::vector<float> src(M * K), wei_scales(N);
+    std::vector<int8_t> wei(K * N);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = ((i * 13) % 29 - 14) * 0.37f * (1 + i / K);
+    // A row of zeros gets a zero scale.
+    for (memory::dim k = 0; k < K; k++)
+        src[3 * K + k] = 0.f;
+    for (memory::dim i = 0; i < K * N; i++)
+        wei[i] = static_cast<int8_t>((i * 7) % 255 - 127);
+    for (memory::dim n = 0; n < N; n++)
+        wei_scales[n] = 0.01f * (n % 5 + 1);
+    {
+        auto src_ptr = map_memory<float>(src_m);
+        auto wei_ptr = map_memory<int8_t>(wei_m);
+        auto wei_scales_ptr = map_memory<float>(wei_scales_m);
+        std::copy(src.begin(), src.end(), &src_ptr[0]);
+        std::copy(wei.begin(), wei.end(), &wei_ptr[0]);
+        std::copy(wei_scales.begin(), wei_scales.end(), &wei_scales_ptr[0]);
+    }
+
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, wei_scales_m}});
+    s.wait();
+
+    auto dst = map_memory<float>(dst_m);
+    for (memory::dim m = 0; m < M; m++) {
+        float absmax = 0.f;
+        for (memory::dim k = 0; k < K; k++)
+            absmax = std::max(absmax, std::fabs(src[m * K + k]));
+        const float scale = absmax / 127.f;
+        const float inv_scale = absmax > 0.f ? 127.f / absmax : 0.f;
+        for (memory::dim n = 0; n < N; n++) {
+            int32_t acc = 0;
+            for (memory::dim k = 0; k < K; k++) {
+                const auto q = static_cast<int32_t>(
+                        std::nearbyint(src[m * K + k] * inv_scale));
+                acc += q * wei[k * N + n];
+            }
+            const float expected = acc * scale * wei_scales[n];
+            ASSERT_NEAR(dst[m * N + n], expected,
+                    1e-5f * std::max(1.f, std::fabs(expected)));
+        }
+    }
+}
+
 /********************************* TEST CASES *********************************/
 
 using iface = matmul_iface_test_t;
@@ -24,6 +24,13 @@
 #include "oneapi/dnnl/dnnl_ocl.hpp"
 #endif
 
+#ifdef __linux__
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
 namespace dnnl {
 
 class persistent_cache_api_test_t : public ::testing::Test {};
@@ -136,4 +143,80 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+#ifdef __linux__
+namespace {
+std::vector<std::string> list_dir(const std::string &dir) {
+    std::vector<std::string> files;
+    DIR *d = opendir(dir.c_str());
+    if (!d) return files;
+    while (const dirent *e = readdir(d)) {
+        const std::string name = e->d_name;
+        if (name != "." && name != "..") files.push_back(dir + "/" + name);
+    }
+    closedir(d);
+    return files;
+}
+} // namespace
+
+HANDLE_EXCEPTIONS_FOR_TEST(persistent_cache_api_test_t, TestJitCacheDir) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Persistent JIT cache is CPU only.");
+    SKIP_IF(get_primitive_cache_capacity() == 0,
+            "Primitive cache is required to force kernels re-creation.");
+
+    char dir_template[] = "/tmp/dnnl_jit_cache_XXXXXX";
+    ASSERT_NE(mkdtemp(dir_template), nullptr);
+    const std::string dir = dir_template;
+
+    engine e = get_test_engine();
+    stream s(e);
+    const memory::dims src_dims = {16, 64}, wei_dims = {64, 48},
+                       dst_dims = {16, 48};
+    auto pd = matmul::primitive_desc(e,
+            {src_dims, memory::data_type::f32, memory::format_tag::ab},
+            {wei_dims, memory::data_type::f32, memory::format_tag::ab},
+            {dst_dims, memory::data_type::f32, memory::format_tag::ab});
+    memory src(pd.src_desc(), e), wei(pd.weights_desc(), e);
+    fill_data<float>(src.get_desc().get_size() / sizeof(float), src);
+    fill_data<float>(wei.get_desc().get_size() / sizeof(float), wei);
+
+    // Generates the kernels (`store`) or copies them from the cache (`load`)
+    // depending on the directory content and returns the result.
+    const int capacity = get_primitive_cache_capacity();
+    auto run = [&]() {
+        set_primitive_cache_capacity(0);
+        set_primitive_cache_capacity(capacity);
+        memory dst(pd.dst_desc(), e);
+        matmul(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        s.wait();
+        const float *ptr = static_cast<const float *>(dst.get_data_handle());
+        return std::vector<float>(
+                ptr, ptr + dst.get_desc().get_size() / sizeof(float));
+    };
+
+    const auto ref = run();
+    ASSERT_EQ(list_dir(dir).size(), 0u);
+
+    ASSERT_EQ(set_jit_cache_dir(dir), status::success);
+    const auto stored = run();
+    const auto files = list_dir(dir);
+    const bool is_brgemm
+            = std::string(pd.impl_info_str()).find("brg") != std::string::npos;
+    if (is_brgemm) { ASSERT_GT(files.size(), 0u); }
+
+    const auto loaded = run();
+    ASSERT_EQ(list_dir(dir).size(), files.size());
+    ASSERT_EQ(set_jit_cache_dir(""), status::success);
+
+    ASSERT_EQ(stored, ref);
+    ASSERT_EQ(loaded, ref);
+
+    for (const auto &f : files)
+        ::remove(f.c_str());
+    ::rmdir(dir.c_str());
+}
+#endif
+
 } // namespace dnnl